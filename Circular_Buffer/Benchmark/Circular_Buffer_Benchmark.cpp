@@ -0,0 +1,220 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Circular_Buffer_Benchmark.cpp
+ *  Date: November 30, 2024
+ *  Description: Benchmark Cases For Circular_Buffer Against std::deque And boost::circular_buffer
+ *  Class Name:  None
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#ifdef BENCHMARK_WITH_BOOST
+#include <boost/circular_buffer.hpp>
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Element Larger Than A Register "64 Bytes" */
+struct Sample_64
+{
+    uint64_t m_Values[8]{};
+};
+/* Builds The Element Pushed By Every Benchmark "Strings Are Past Small String Storage" */
+template <typename Type>
+static Type Make_Element(size_t Value)
+{
+    if constexpr(std::is_same_v<Type,std::string>){return std::string(32,static_cast<char>('a'+Value%26));}
+    else if constexpr(std::is_same_v<Type,Sample_64>){return Sample_64{{Value}};}
+    else{return static_cast<Type>(Value);}
+}
+/*****************************************
+-----------    Adapters     --------------
+*****************************************/
+/* Every Container Behaves As A Bounded Ring That Drops The Oldest Element When Full */
+template <typename Type,size_t TOTAL_SIZE>
+struct Ring_Adapter
+{
+    using value_type=Type;
+    static constexpr size_t CAPACITY{TOTAL_SIZE};
+    void Push(const Type& Element){m_Buffer.Push(Element);}
+    Type Pop(void){return m_Buffer.Pop();}
+    void Push_N(std::span<const Type> Elements){m_Buffer.Push_N(Elements);}
+    size_t Pop_N(std::span<Type> Elements){return m_Buffer.Pop_N(Elements);}
+    auto begin(void){return m_Buffer.begin();}
+    auto end(void){return m_Buffer.end();}
+    Data_Structure::Circular_Buffer<Type,TOTAL_SIZE> m_Buffer{};
+};
+template <typename Type,size_t TOTAL_SIZE>
+struct Deque_Adapter
+{
+    using value_type=Type;
+    static constexpr size_t CAPACITY{TOTAL_SIZE};
+    void Push(const Type& Element)
+    {
+        if(m_Buffer.size()==TOTAL_SIZE){m_Buffer.pop_front();}
+        m_Buffer.push_back(Element);
+    }
+    Type Pop(void)
+    {
+        Type Element{std::move(m_Buffer.front())};
+        m_Buffer.pop_front();
+        return Element;
+    }
+    void Push_N(std::span<const Type> Elements)
+    {
+        m_Buffer.insert(m_Buffer.end(),Elements.begin(),Elements.end());
+        if(m_Buffer.size()>TOTAL_SIZE){m_Buffer.erase(m_Buffer.begin(),m_Buffer.end()-TOTAL_SIZE);}
+    }
+    size_t Pop_N(std::span<Type> Elements)
+    {
+        const size_t Total_Elements{std::min(Elements.size(),m_Buffer.size())};
+        std::move(m_Buffer.begin(),m_Buffer.begin()+Total_Elements,Elements.begin());
+        m_Buffer.erase(m_Buffer.begin(),m_Buffer.begin()+Total_Elements);
+        return Total_Elements;
+    }
+    auto begin(void){return m_Buffer.begin();}
+    auto end(void){return m_Buffer.end();}
+    std::deque<Type> m_Buffer{};
+};
+#ifdef BENCHMARK_WITH_BOOST
+template <typename Type,size_t TOTAL_SIZE>
+struct Boost_Adapter
+{
+    using value_type=Type;
+    static constexpr size_t CAPACITY{TOTAL_SIZE};
+    void Push(const Type& Element){m_Buffer.push_back(Element);}
+    Type Pop(void)
+    {
+        Type Element{std::move(m_Buffer.front())};
+        m_Buffer.pop_front();
+        return Element;
+    }
+    void Push_N(std::span<const Type> Elements){m_Buffer.insert(m_Buffer.end(),Elements.begin(),Elements.end());}
+    size_t Pop_N(std::span<Type> Elements)
+    {
+        const size_t Total_Elements{std::min(Elements.size(),m_Buffer.size())};
+        std::move(m_Buffer.begin(),m_Buffer.begin()+Total_Elements,Elements.begin());
+        m_Buffer.erase_begin(Total_Elements);
+        return Total_Elements;
+    }
+    auto begin(void){return m_Buffer.begin();}
+    auto end(void){return m_Buffer.end();}
+    boost::circular_buffer<Type> m_Buffer{TOTAL_SIZE};
+};
+#endif
+/*****************************************
+---------    Push_Pop_Benchmark     ------
+*****************************************/
+/* Pushes And Pops Half A Buffer One Element At A Time Through The Wrap Point */
+template <typename Adapter>
+static void Push_Pop_Benchmark(benchmark::State& State)
+{
+    using Type=typename Adapter::value_type;
+    constexpr size_t BATCH{Adapter::CAPACITY/2};
+    auto Buffer{std::make_unique<Adapter>()};
+    const Type Element{Make_Element<Type>(1)};
+    for(auto _:State)
+    {
+        for(size_t Counter{};Counter<BATCH;Counter++){Buffer->Push(Element);}
+        for(size_t Counter{};Counter<BATCH;Counter++){benchmark::DoNotOptimize(Buffer->Pop());}
+    }
+    State.SetItemsProcessed(State.iterations()*BATCH*2);
+}
+/*****************************************
+-------    Bulk_Push_Pop_Benchmark     ----
+*****************************************/
+/* Same Traffic As Push_Pop_Benchmark Moved In Half Buffer Batches */
+template <typename Adapter>
+static void Bulk_Push_Pop_Benchmark(benchmark::State& State)
+{
+    using Type=typename Adapter::value_type;
+    constexpr size_t BATCH{Adapter::CAPACITY/2};
+    auto Buffer{std::make_unique<Adapter>()};
+    const std::vector<Type> Input(BATCH,Make_Element<Type>(1));
+    std::vector<Type> Output(BATCH);
+    for(auto _:State)
+    {
+        Buffer->Push_N(Input);
+        benchmark::DoNotOptimize(Buffer->Pop_N(Output));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations()*BATCH*2);
+}
+/*****************************************
+--------    Iterate_Benchmark     --------
+*****************************************/
+/* Walks A Full Buffer Whose Head Sits In The Middle Of The Storage */
+template <typename Adapter>
+static void Iterate_Benchmark(benchmark::State& State)
+{
+    using Type=typename Adapter::value_type;
+    auto Buffer{std::make_unique<Adapter>()};
+    for(size_t Counter{};Counter<Adapter::CAPACITY+Adapter::CAPACITY/2;Counter++){Buffer->Push(Make_Element<Type>(Counter));}
+    for(auto _:State)
+    {
+        for(auto &Element:*Buffer){benchmark::DoNotOptimize(Element);}
+    }
+    State.SetItemsProcessed(State.iterations()*Adapter::CAPACITY);
+}
+/*****************************************
+-------    Overwrite_Benchmark     -------
+*****************************************/
+/* Keeps Pushing Into A Full Buffer So Every Push Drops The Oldest Element */
+template <typename Adapter>
+static void Overwrite_Benchmark(benchmark::State& State)
+{
+    using Type=typename Adapter::value_type;
+    auto Buffer{std::make_unique<Adapter>()};
+    const Type Element{Make_Element<Type>(1)};
+    for(size_t Counter{};Counter<Adapter::CAPACITY;Counter++){Buffer->Push(Element);}
+    for(auto _:State)
+    {
+        for(size_t Counter{};Counter<Adapter::CAPACITY;Counter++){Buffer->Push(Element);}
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations()*Adapter::CAPACITY);
+}
+/*****************************************
+---------    Registration     ------------
+*****************************************/
+/* Same Four Cases For Every Container, Type And Capacity */
+#define REGISTER_CASES(ADAPTER,TYPE,SIZE)                              \
+    BENCHMARK_TEMPLATE(Push_Pop_Benchmark,ADAPTER<TYPE,SIZE>);         \
+    BENCHMARK_TEMPLATE(Bulk_Push_Pop_Benchmark,ADAPTER<TYPE,SIZE>);    \
+    BENCHMARK_TEMPLATE(Iterate_Benchmark,ADAPTER<TYPE,SIZE>);          \
+    BENCHMARK_TEMPLATE(Overwrite_Benchmark,ADAPTER<TYPE,SIZE>)
+#ifdef BENCHMARK_WITH_BOOST
+#define REGISTER_CONTAINERS(TYPE,SIZE)                                 \
+    REGISTER_CASES(Ring_Adapter,TYPE,SIZE);                            \
+    REGISTER_CASES(Deque_Adapter,TYPE,SIZE);                           \
+    REGISTER_CASES(Boost_Adapter,TYPE,SIZE)
+#else
+#define REGISTER_CONTAINERS(TYPE,SIZE)                                 \
+    REGISTER_CASES(Ring_Adapter,TYPE,SIZE);                            \
+    REGISTER_CASES(Deque_Adapter,TYPE,SIZE)
+#endif
+/* Capacity 1023 Uses Branch Wrap, Power Of Two Capacities Use Mask */
+#define REGISTER_CAPACITIES(TYPE)                                      \
+    REGISTER_CONTAINERS(TYPE,64);                                      \
+    REGISTER_CONTAINERS(TYPE,1023);                                    \
+    REGISTER_CONTAINERS(TYPE,1024);                                    \
+    REGISTER_CONTAINERS(TYPE,16384)
+REGISTER_CAPACITIES(int);
+REGISTER_CAPACITIES(Sample_64);
+REGISTER_CAPACITIES(std::string);
+/********************************************************************
+ *  END OF FILE:  Circular_Buffer_Benchmark.cpp
+********************************************************************/
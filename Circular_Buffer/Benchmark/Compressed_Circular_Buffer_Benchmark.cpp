@@ -0,0 +1,71 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Compressed_Circular_Buffer_Benchmark.cpp
+ *  Date: November 30, 2024
+ *  Description: Benchmark Cases For Compressed_Circular_Buffer Pushing And Decoding At Each Instruction Set
+ *  Class Name:  None
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Compressed_Circular_Buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Jittered Microsecond Clock, Mostly One Byte Per Sample */
+static int64_t Clock_Sample(uint64_t Counter)
+{
+    return static_cast<int64_t>(Counter*1000+(Counter*2654435761U)%61);
+}
+/*****************************************
+-----    Compressed_Push_Benchmark     ---
+*****************************************/
+/* Cost Of Encoding One Sample, Block Evictions Included */
+static void Compressed_Push_Benchmark(benchmark::State& State)
+{
+    auto Buffer{std::make_unique<Data_Structure::Compressed_Circular_Buffer<64,256>>()};
+    uint64_t Counter{};
+    for(auto _:State){Buffer->Push(Clock_Sample(Counter++));}
+    State.SetItemsProcessed(State.iterations());
+}
+/*****************************************
+----    Compressed_Decode_Benchmark     --
+*****************************************/
+/* Whole Ring Decoded At A Given Instruction Set */
+template <Data_Structure::Simd_Level LEVEL>
+static void Compressed_Decode_Benchmark(benchmark::State& State)
+{
+    if(LEVEL>Data_Structure::Best_Simd_Level())
+    {
+        State.SkipWithError("Simd Level Not Supported By This Cpu");
+        return;
+    }
+    auto Buffer{std::make_unique<Data_Structure::Compressed_Circular_Buffer<64,256>>()};
+    for(uint64_t Counter{};Counter<64*257;Counter++){Buffer->Push(Clock_Sample(Counter));}
+    std::vector<int64_t> Output(Buffer->Size());
+    for(auto _:State)
+    {
+        benchmark::DoNotOptimize(Buffer->Decode(Output,LEVEL));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations()*static_cast<int64_t>(Output.size()));
+    State.counters["Bytes_Per_Sample"]=static_cast<double>(Buffer->Encoded_Bytes())/static_cast<double>(Buffer->Size());
+}
+/*****************************************
+---------    Registration     ------------
+*****************************************/
+BENCHMARK(Compressed_Push_Benchmark);
+BENCHMARK_TEMPLATE(Compressed_Decode_Benchmark,Data_Structure::Simd_Level::Scalar);
+BENCHMARK_TEMPLATE(Compressed_Decode_Benchmark,Data_Structure::Simd_Level::SSE);
+BENCHMARK_TEMPLATE(Compressed_Decode_Benchmark,Data_Structure::Simd_Level::AVX2);
+/********************************************************************
+ *  END OF FILE:  Compressed_Circular_Buffer_Benchmark.cpp
+********************************************************************/
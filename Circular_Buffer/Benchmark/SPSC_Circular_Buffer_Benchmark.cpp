@@ -0,0 +1,65 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: SPSC_Circular_Buffer_Benchmark.cpp
+ *  Date: November 30, 2024
+ *  Description: Benchmark Cases For SPSC_Circular_Buffer Moving Elements Between Two Threads
+ *  Class Name:  None
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <thread>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Elements Moved Per Iteration By Each Side */
+inline constexpr uint64_t BATCH_SIZE{1024};
+/*****************************************
+---    Cross_Thread_Benchmark     --------
+*****************************************/
+/* Thread Zero Produces And Thread One Consumes Through One Shared Ring */
+template <size_t SIZE>
+static void Cross_Thread_Benchmark(benchmark::State& State)
+{
+    static std::unique_ptr<Data_Structure::SPSC_Circular_Buffer<uint64_t,SIZE>> Buffer{};
+    /* Setup And Teardown Run Before And After Every Thread Of The Benchmark */
+    if(State.thread_index()==0){Buffer=std::make_unique<Data_Structure::SPSC_Circular_Buffer<uint64_t,SIZE>>();}
+    uint64_t Counter{};
+    for(auto _:State)
+    {
+        if(State.thread_index()==0)
+        {
+            for(uint64_t Pushed{};Pushed<BATCH_SIZE;)
+            {
+                if(Buffer->Push(Counter)){Counter++;Pushed++;}
+                else{std::this_thread::yield();}
+            }
+        }
+        else
+        {
+            uint64_t Value{};
+            for(uint64_t Popped{};Popped<BATCH_SIZE;)
+            {
+                if(Buffer->Pop(Value)){benchmark::DoNotOptimize(Value);Popped++;}
+                else{std::this_thread::yield();}
+            }
+        }
+    }
+    State.SetItemsProcessed(static_cast<int64_t>(State.iterations()*BATCH_SIZE));
+}
+/*****************************************
+---------    Registration     ------------
+*****************************************/
+BENCHMARK_TEMPLATE(Cross_Thread_Benchmark,1024)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(Cross_Thread_Benchmark,16384)->Threads(2)->UseRealTime();
+/********************************************************************
+ *  END OF FILE:  SPSC_Circular_Buffer_Benchmark.cpp
+********************************************************************/
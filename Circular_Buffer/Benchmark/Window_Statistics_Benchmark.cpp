@@ -0,0 +1,105 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Window_Statistics_Benchmark.cpp
+ *  Date: November 30, 2024
+ *  Description: Benchmark Cases For Window Statistics Walking Iterators, Reducing Segments And Rolling
+ *  Class Name:  None
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Window_Statistics.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Fills A Window Whose Head Sits In The Middle Of The Storage "Both Segments In Use" */
+template <size_t SIZE>
+static std::unique_ptr<Data_Structure::Circular_Buffer<float,SIZE>> Make_Window(void)
+{
+    auto Buffer{std::make_unique<Data_Structure::Circular_Buffer<float,SIZE>>()};
+    for(size_t Counter{};Counter<SIZE+SIZE/2;Counter++){Buffer->Push(static_cast<float>(Counter%97));}
+    return Buffer;
+}
+/*****************************************
+-----    Iterator_Walk_Benchmark     -----
+*****************************************/
+/* Recomputes Every Statistic Element By Element Through Buffer_Iterator */
+template <size_t SIZE>
+static void Iterator_Walk_Benchmark(benchmark::State& State)
+{
+    auto Buffer{Make_Window<SIZE>()};
+    for(auto _:State)
+    {
+        double Sum{};
+        float Minimum{(*Buffer)[0]};
+        float Maximum{(*Buffer)[0]};
+        for(const float Sample:*Buffer)
+        {
+            Sum+=Sample;
+            Minimum=std::min(Minimum,Sample);
+            Maximum=std::max(Maximum,Sample);
+        }
+        const double Mean{Sum/SIZE};
+        double Squared_Deviation{};
+        for(const float Sample:*Buffer){Squared_Deviation+=(Sample-Mean)*(Sample-Mean);}
+        benchmark::DoNotOptimize(Minimum);
+        benchmark::DoNotOptimize(Maximum);
+        benchmark::DoNotOptimize(Squared_Deviation);
+    }
+    State.SetItemsProcessed(State.iterations()*SIZE);
+}
+/*****************************************
+----    Segment_Reduce_Benchmark     -----
+*****************************************/
+/* Same Statistics Reduced Over The Two Storage Segments At A Given Instruction Set */
+template <size_t SIZE,Data_Structure::Simd_Level LEVEL>
+static void Segment_Reduce_Benchmark(benchmark::State& State)
+{
+    if(LEVEL>Data_Structure::Best_Simd_Level())
+    {
+        State.SkipWithError("Simd Level Not Supported By This Cpu");
+        return;
+    }
+    auto Buffer{Make_Window<SIZE>()};
+    for(auto _:State){benchmark::DoNotOptimize(Data_Structure::Window_Statistics(*Buffer,LEVEL));}
+    State.SetItemsProcessed(State.iterations()*SIZE);
+}
+/*****************************************
+--------    Rolling_Benchmark     --------
+*****************************************/
+/* Cost Of Keeping Every Statistic Current On Each New Sample */
+template <size_t SIZE>
+static void Rolling_Benchmark(benchmark::State& State)
+{
+    auto Rolling{std::make_unique<Data_Structure::Rolling_Window_Statistics<float,SIZE>>()};
+    uint64_t Counter{};
+    for(auto _:State)
+    {
+        Rolling->Push(static_cast<float>(Counter++%97));
+        benchmark::DoNotOptimize(Rolling->Summary());
+    }
+    State.SetItemsProcessed(State.iterations());
+}
+/*****************************************
+---------    Registration     ------------
+*****************************************/
+#define REGISTER_WINDOW(SIZE)                                                                      \
+    BENCHMARK_TEMPLATE(Iterator_Walk_Benchmark,SIZE);                                              \
+    BENCHMARK_TEMPLATE(Segment_Reduce_Benchmark,SIZE,Data_Structure::Simd_Level::Scalar);          \
+    BENCHMARK_TEMPLATE(Segment_Reduce_Benchmark,SIZE,Data_Structure::Simd_Level::SSE);             \
+    BENCHMARK_TEMPLATE(Segment_Reduce_Benchmark,SIZE,Data_Structure::Simd_Level::AVX2);            \
+    BENCHMARK_TEMPLATE(Rolling_Benchmark,SIZE)
+REGISTER_WINDOW(64);
+REGISTER_WINDOW(1024);
+REGISTER_WINDOW(16384);
+/********************************************************************
+ *  END OF FILE:  Window_Statistics_Benchmark.cpp
+********************************************************************/
@@ -0,0 +1,342 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Latency_Harness.cpp
+ *  Date: November 30, 2024
+ *  Description: Thread to thread handoff latency and throughput of the concurrent ring variants
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include "Blocking_Circular_Buffer.hpp"
+#include "Latency_Histogram.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#if defined(__x86_64__)||defined(__i386__)
+#include <x86intrin.h>
+#define HARNESS_HAS_RDTSC
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Slots Of Every Ring Under Test */
+constexpr size_t CAPACITY{1024};
+/* Pushed Once By Every Producer, Stops One Consumer "Never A Valid Timestamp" */
+constexpr uint64_t END_OF_STREAM{UINT64_MAX};
+/* Command Line Settings */
+struct Harness_Options
+{
+    /* Messages Sent By All Producers Of One Case Together */
+    uint64_t m_Messages{1000000};
+    /* Producer Count Of Each Case, Consumers Match It */
+    std::vector<size_t> m_Threads{1,2,4};
+    /* Cores Threads Are Pinned To In Turn, Empty Means No Pinning */
+    std::vector<int> m_Cores{};
+    /* Ring Variants To Run */
+    std::vector<std::string> m_Variants{"spsc","mpmc","blocking"};
+    /* Gap Between Two Sends Of One Producer, Zero Sends Flat Out */
+    uint64_t m_Interval_Nanoseconds{};
+    /* Time Stamp Counter Or steady_clock */
+    bool m_Use_Rdtsc{true};
+};
+/*****************************************
+------------    Tick_Clock     -----------
+*****************************************/
+/* Cheap Time Stamps Taken On Both Sides Of The Ring */
+class Tick_Clock
+{
+public:
+    explicit Tick_Clock(bool Use_Rdtsc):m_Use_Rdtsc{Use_Rdtsc}
+    {
+#ifdef HARNESS_HAS_RDTSC
+        /* Measure Tick Rate Against steady_clock Once "Needs Invariant TSC" */
+        if(m_Use_Rdtsc)
+        {
+            const auto Start_Time{std::chrono::steady_clock::now()};
+            const uint64_t Start_Ticks{__rdtsc()};
+            std::this_thread::sleep_for(std::chrono::milliseconds{100});
+            const uint64_t Ticks{__rdtsc()-Start_Ticks};
+            const auto Elapsed{std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now()-Start_Time)};
+            m_Nanoseconds_Per_Tick=Elapsed.count()/static_cast<double>(Ticks);
+        }
+#else
+        m_Use_Rdtsc=false;
+#endif
+    }
+    uint64_t Now(void)const
+    {
+#ifdef HARNESS_HAS_RDTSC
+        if(m_Use_Rdtsc){return __rdtsc();}
+#endif
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    uint64_t To_Nanoseconds(uint64_t Ticks)const{return static_cast<uint64_t>(static_cast<double>(Ticks)*m_Nanoseconds_Per_Tick);}
+    uint64_t To_Ticks(uint64_t Nanoseconds)const{return static_cast<uint64_t>(static_cast<double>(Nanoseconds)/m_Nanoseconds_Per_Tick);}
+    const char* Name(void)const{return m_Use_Rdtsc?"rdtsc":"steady_clock";}
+private:
+    bool m_Use_Rdtsc{};
+    double m_Nanoseconds_Per_Tick{1.0};
+};
+/****************************************************************************************************
+* Function Name   : Relax
+* Type            : Global
+* Description     : Tells the core a spin loop is running.
+* Parameters (in) : None
+* Parameters (out): None
+* Return value    : None
+* Notes           : - Lets the sibling hyper thread run and saves power while spinning.
+*                   - Yields every few calls so a peer sharing the core can make progress.
+*****************************************************************************************************/
+static inline void Relax(void)
+{
+    thread_local uint32_t Spins{};
+    if((++Spins%64)==0){std::this_thread::yield();return;}
+#ifdef HARNESS_HAS_RDTSC
+    _mm_pause();
+#endif
+}
+/*****************************************
+------------    Variants     -------------
+*****************************************/
+/* Same Push And Pop Shape For Every Ring, Pop Returns False When Nothing Is Ready */
+struct SPSC_Variant
+{
+    static constexpr const char* NAME{"spsc"};
+    static constexpr size_t MAX_THREADS{1};
+    using Buffer=Data_Structure::SPSC_Circular_Buffer<uint64_t,CAPACITY>;
+    static void Push(Buffer& Ring,uint64_t Value){while(!Ring.Push(Value)){Relax();}}
+    static bool Pop(Buffer& Ring,uint64_t& Value){return Ring.Pop(Value);}
+};
+struct MPMC_Variant
+{
+    static constexpr const char* NAME{"mpmc"};
+    static constexpr size_t MAX_THREADS{SIZE_MAX};
+    using Buffer=Data_Structure::MPMC_Circular_Buffer<uint64_t,CAPACITY>;
+    static void Push(Buffer& Ring,uint64_t Value){while(!Ring.Try_Push(Value)){Relax();}}
+    static bool Pop(Buffer& Ring,uint64_t& Value){return Ring.Try_Pop(Value);}
+};
+struct Blocking_Variant
+{
+    static constexpr const char* NAME{"blocking"};
+    static constexpr size_t MAX_THREADS{SIZE_MAX};
+    using Buffer=Data_Structure::Blocking_Circular_Buffer<uint64_t,CAPACITY>;
+    static void Push(Buffer& Ring,uint64_t Value){Ring.Push_Wait(Value);}
+    static bool Pop(Buffer& Ring,uint64_t& Value)
+    {
+        const auto Element{Ring.Pop_Wait()};
+        if(Element){Value=*Element;}
+        return Element.has_value();
+    }
+};
+/****************************************************************************************************
+* Function Name   : Pin_To_Core
+* Type            : Global
+* Description     : Binds the calling thread to one core.
+* Parameters (in) : Core - Core number, negative leaves the thread unpinned.
+* Parameters (out): None
+* Return value    : None
+* Notes           : Prints a warning and keeps running unpinned if the core cannot be used.
+*****************************************************************************************************/
+static void Pin_To_Core(int Core)
+{
+    if(Core<0){return;}
+    cpu_set_t Set{};
+    CPU_ZERO(&Set);
+    CPU_SET(Core,&Set);
+    if(pthread_setaffinity_np(pthread_self(),sizeof(Set),&Set)!=0)
+    {
+        std::cerr<<"Warning : Cannot Pin Thread To Core "<<Core<<std::endl;
+    }
+}
+/****************************************************************************************************
+* Function Name   : Run_Case
+* Type            : Global
+* Description     : Streams time stamps through one ring variant and prints one result row.
+* Parameters (in) : Options - Command line settings.
+*                   Clock   - Time stamp source shared by every thread.
+*                   Threads - Number of producers, the same number of consumers is started.
+* Parameters (out): None
+* Return value    : None
+* Notes           : - Producer k uses core 2k and consumer k core 2k+1 of the core list, wrapping.
+*                   - Latency is taken from the send stamp to the moment the consumer holds it.
+*                   - Every consumer fills its own histogram, they are merged after the run.
+*****************************************************************************************************/
+template <typename Variant>
+static void Run_Case(const Harness_Options& Options,const Tick_Clock& Clock,size_t Threads)
+{
+    auto Ring{std::make_unique<typename Variant::Buffer>()};
+    std::vector<Data_Structure::Latency_Histogram> Histograms(Threads);
+    std::atomic<bool> Start{false};
+    std::atomic<size_t> Ready{0};
+    const uint64_t Messages_Per_Producer{Options.m_Messages/Threads};
+    const uint64_t Interval_Ticks{Clock.To_Ticks(Options.m_Interval_Nanoseconds)};
+    auto Core_For=[&Options](size_t Slot){return Options.m_Cores.empty()?-1:Options.m_Cores[Slot%Options.m_Cores.size()];};
+    std::vector<std::thread> Workers{};
+    for(size_t Thread{};Thread<Threads;Thread++)
+    {
+        Workers.emplace_back([&,Thread]()
+        {
+            Pin_To_Core(Core_For(2*Thread+1));
+            Data_Structure::Latency_Histogram &Histogram{Histograms[Thread]};
+            Ready++;
+            while(!Start.load(std::memory_order_acquire)){Relax();}
+            uint64_t Value{};
+            while(true)
+            {
+                if(!Variant::Pop(*Ring,Value)){Relax();continue;}
+                if(Value==END_OF_STREAM){break;}
+                /* Unsynchronized Counters Across Sockets May Run Backwards "Count As Zero" */
+                const uint64_t Now{Clock.Now()};
+                Histogram.Record(Clock.To_Nanoseconds((Now>Value)?(Now-Value):0));
+            }
+        });
+        Workers.emplace_back([&,Thread]()
+        {
+            Pin_To_Core(Core_For(2*Thread));
+            Ready++;
+            while(!Start.load(std::memory_order_acquire)){Relax();}
+            uint64_t Next_Send{Clock.Now()};
+            for(uint64_t Counter{};Counter<Messages_Per_Producer;Counter++)
+            {
+                /* Paced Sends Show Latency Without Queueing Delay */
+                if(Interval_Ticks)
+                {
+                    while(Clock.Now()<Next_Send){Relax();}
+                    Next_Send+=Interval_Ticks;
+                }
+                Variant::Push(*Ring,Clock.Now());
+            }
+            Variant::Push(*Ring,END_OF_STREAM);
+        });
+    }
+    /* Release Every Thread Together Once All Are Pinned */
+    while(Ready.load()<Workers.size()){std::this_thread::yield();}
+    const auto Start_Time{std::chrono::steady_clock::now()};
+    Start.store(true,std::memory_order_release);
+    for(auto &Worker:Workers){Worker.join();}
+    const std::chrono::duration<double> Elapsed{std::chrono::steady_clock::now()-Start_Time};
+    for(size_t Thread{1};Thread<Threads;Thread++){Histograms[0].Merge(Histograms[Thread]);}
+    const Data_Structure::Latency_Histogram &Total{Histograms[0]};
+    std::cout<<std::left<<std::setw(10)<<Variant::NAME<<std::right
+             <<std::setw(8)<<(std::to_string(Threads)+"x"+std::to_string(Threads))
+             <<std::setw(16)<<std::fixed<<std::setprecision(0)<<static_cast<double>(Total.Count())/Elapsed.count()
+             <<std::setw(12)<<Total.Percentile(50.0)
+             <<std::setw(12)<<Total.Percentile(99.0)
+             <<std::setw(12)<<Total.Percentile(99.9)
+             <<std::setw(14)<<Total.Max()<<std::endl;
+}
+/****************************************************************************************************
+* Function Name   : Split_List
+* Type            : Global
+* Description     : Splits a comma separated command line value.
+* Parameters (in) : Text - Value after the equal sign.
+* Parameters (out): None
+* Return value    : std::vector<std::string> - Items in order, empty items dropped.
+* Notes           : None
+*****************************************************************************************************/
+static std::vector<std::string> Split_List(std::string_view Text)
+{
+    std::vector<std::string> Items{};
+    while(!Text.empty())
+    {
+        const size_t Comma{Text.find(',')};
+        if(Comma!=0){Items.emplace_back(Text.substr(0,Comma));}
+        if(Comma==std::string_view::npos){break;}
+        Text.remove_prefix(Comma+1);
+    }
+    return Items;
+}
+/****************************************************************************************************
+* Function Name   : Parse_Options
+* Type            : Global
+* Description     : Reads the command line into harness settings.
+* Parameters (in) : Count     - Number of arguments.
+*                   Arguments - Argument strings.
+* Parameters (out): Options   - Settings given on the command line, others keep defaults.
+* Return value    : bool - False if an argument is unknown or malformed.
+* Notes           : None
+*****************************************************************************************************/
+static bool Parse_Options(int Count,char** Arguments,Harness_Options& Options)
+{
+    try
+    {
+        for(int Index{1};Index<Count;Index++)
+        {
+            const std::string_view Argument{Arguments[Index]};
+            const size_t Equal{Argument.find('=')};
+            if(Equal==std::string_view::npos){return false;}
+            const std::string_view Name{Argument.substr(0,Equal)};
+            const std::string_view Value{Argument.substr(Equal+1)};
+            if(Name=="--messages"){Options.m_Messages=std::stoull(std::string{Value});}
+            else if(Name=="--interval"){Options.m_Interval_Nanoseconds=std::stoull(std::string{Value});}
+            else if(Name=="--clock"){Options.m_Use_Rdtsc=(Value=="rdtsc");if(!Options.m_Use_Rdtsc&&Value!="steady"){return false;}}
+            else if(Name=="--variants"){Options.m_Variants=Split_List(Value);}
+            else if(Name=="--threads")
+            {
+                Options.m_Threads.clear();
+                for(const auto &Item:Split_List(Value)){Options.m_Threads.push_back(std::stoul(Item));}
+            }
+            else if(Name=="--cores")
+            {
+                Options.m_Cores.clear();
+                for(const auto &Item:Split_List(Value)){Options.m_Cores.push_back(std::stoi(Item));}
+            }
+            else{return false;}
+        }
+    }
+    catch(const std::exception&){return false;}
+    return true;
+}
+/****************************************************************************************************
+* Function Name   : main
+* Type            : Global
+* Description     : Runs every requested variant at every requested thread count.
+* Parameters (in) : Count     - Number of arguments.
+*                   Arguments - Argument strings.
+* Parameters (out): None
+* Return value    : int - Zero on success, one on a bad command line.
+* Notes           : spsc only runs with one producer and one consumer.
+*****************************************************************************************************/
+int main(int Count,char** Arguments)
+{
+    Harness_Options Options{};
+    if(!Parse_Options(Count,Arguments,Options))
+    {
+        std::cerr<<"Usage : "<<Arguments[0]<<" [--messages=N] [--threads=1,2,4] [--cores=0,1,2,3]"
+                 <<" [--variants=spsc,mpmc,blocking] [--interval=NANOSECONDS] [--clock=rdtsc|steady]"<<std::endl;
+        return 1;
+    }
+    const Tick_Clock Clock{Options.m_Use_Rdtsc};
+    std::cout<<"Clock : "<<Clock.Name()<<" , Messages Per Case : "<<Options.m_Messages
+             <<" , Capacity : "<<CAPACITY<<std::endl;
+    std::cout<<std::left<<std::setw(10)<<"Variant"<<std::right<<std::setw(8)<<"P x C"<<std::setw(16)<<"Ops/Sec"
+             <<std::setw(12)<<"p50 (ns)"<<std::setw(12)<<"p99 (ns)"<<std::setw(12)<<"p99.9 (ns)"
+             <<std::setw(14)<<"Max (ns)"<<std::endl;
+    for(const auto &Name:Options.m_Variants)
+    {
+        for(const size_t Threads:Options.m_Threads)
+        {
+            if(Threads==0){continue;}
+            if(Name==SPSC_Variant::NAME&&Threads<=SPSC_Variant::MAX_THREADS){Run_Case<SPSC_Variant>(Options,Clock,Threads);}
+            else if(Name==MPMC_Variant::NAME){Run_Case<MPMC_Variant>(Options,Clock,Threads);}
+            else if(Name==Blocking_Variant::NAME){Run_Case<Blocking_Variant>(Options,Clock,Threads);}
+        }
+    }
+    return 0;
+}
+/********************************************************************
+ *  END OF FILE:  Latency_Harness.cpp
+********************************************************************/
@@ -0,0 +1,552 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Asio_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Bounded circular buffer with boost::asio asynchronous push and pop operations
+ *  Class Name:  Asio_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _ASIO_CIRCULAR_BUFFER_HPP_
+#define _ASIO_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/associated_allocator.hpp>
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/execution/outstanding_work.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/prefer.hpp>
+#include <boost/system/error_code.hpp>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+-----    Asio_Circular_Buffer     --------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=16,typename Executor_Type=boost::asio::any_io_executor>
+class Asio_Circular_Buffer
+{
+static_assert(std::is_default_constructible_v<Type>,"Asio_Circular_Buffer Completes Failed Pops With A Default Constructed Element");
+public:
+    using executor_type=Executor_Type;
+/****************************************************************************************************
+* Constructor Name : Asio_Circular_Buffer
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs an open and empty buffer bound to an executor.
+* Parameters (in)  : Executor - Every state change runs on it, pass a strand when the io_context is
+*                               run by more than one thread.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+explicit Asio_Circular_Buffer(const Executor_Type& Executor);
+Asio_Circular_Buffer(const Asio_Circular_Buffer&)=delete;
+Asio_Circular_Buffer& operator=(const Asio_Circular_Buffer&)=delete;
+/****************************************************************************************************
+* Destructor Name  : ~Asio_Circular_Buffer
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Completes every pending operation with operation_aborted.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Must not run concurrently with other operations, destroy the buffer before the
+*                    io_context it posts to.
+*****************************************************************************************************/
+~Asio_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : get_executor
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the executor the buffer state lives on.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : executor_type - The executor given at construction.
+* Notes            : Named after the asio I/O object convention.
+*****************************************************************************************************/
+executor_type get_executor(void)const noexcept;
+/****************************************************************************************************
+* Function Name    : async_pop
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Starts an asynchronous pop of the oldest element.
+* Parameters (in)  : Completion_Token - Callback, use_awaitable, use_future or any other token with
+*                                       signature void(boost::system::error_code, Type).
+* Parameters (out) : None
+* Return value     : Whatever the token produces.
+* Notes            : - Waits without polling while the buffer is empty.
+*                    - Completes with boost::asio::error::eof once closed and drained.
+*                    - The handler never runs inside this call, it is posted to its associated
+*                      executor.
+*****************************************************************************************************/
+template <typename Token_Type>
+auto async_pop(Token_Type&& Completion_Token);
+/****************************************************************************************************
+* Function Name    : async_push
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Starts an asynchronous push of an element.
+* Parameters (in)  : Element          - The element to be pushed.
+*                    Completion_Token - Callback, use_awaitable, use_future or any other token with
+*                                       signature void(boost::system::error_code).
+* Parameters (out) : None
+* Return value     : Whatever the token produces.
+* Notes            : - Waits without polling while the buffer is full.
+*                    - A waiting pop gets the element directly, skipping the ring.
+*                    - Completes with boost::asio::error::broken_pipe once closed.
+*****************************************************************************************************/
+template <typename Token_Type>
+auto async_push(Type Element,Token_Type&& Completion_Token);
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Refuses further elements and completes every waiting operation.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Runs on the buffer executor, right away when called from it.
+*                    - Elements pushed before Close are still delivered.
+*****************************************************************************************************/
+void Close(void);
+private:
+    /* Type Erased Waiting Pop "Completion Handler Lives In The Derived Node" */
+    struct Pop_Operation
+    {
+        Pop_Operation* m_Next{};
+        void (*m_Complete)(Pop_Operation*,boost::system::error_code,Type&&){};
+    };
+    /* Type Erased Waiting Push, Element Waits Here Until A Slot Frees */
+    struct Push_Operation
+    {
+        Push_Operation* m_Next{};
+        void (*m_Complete)(Push_Operation*,boost::system::error_code){};
+        Type m_Value{};
+    };
+    /* Node Memory Comes From The Handler Associated Allocator */
+    template <typename Operation_Type,typename Handler_Type>
+    using Operation_Allocator=typename std::allocator_traits<boost::asio::associated_allocator_t<Handler_Type>>::template rebind_alloc<Operation_Type>;
+    /* Keeps The Buffer io_context Running While An Operation Waits */
+    using Work_Executor=std::decay_t<decltype(boost::asio::prefer(std::declval<const Executor_Type&>(),boost::asio::execution::outstanding_work.tracked))>;
+    template <typename Handler_Type>
+    struct Pop_Handler;
+    template <typename Handler_Type>
+    struct Push_Handler;
+/****************************************************************************************************
+* Function Name    : Pop_Or_Wait
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Completes a pop from the ring or queues it until an element arrives.
+* Parameters (in)  : Operation - The pop to serve.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Runs on the buffer executor only.
+*****************************************************************************************************/
+void Pop_Or_Wait(Pop_Operation* Operation);
+/****************************************************************************************************
+* Function Name    : Push_Or_Wait
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Completes a push into a waiting pop or the ring, or queues it until a slot frees.
+* Parameters (in)  : Operation - The push to serve.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Runs on the buffer executor only.
+*****************************************************************************************************/
+void Push_Or_Wait(Push_Operation* Operation);
+/****************************************************************************************************
+* Function Name    : Complete_Waiters
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Completes every queued operation with an error.
+* Parameters (in)  : Pop_Error  - Error given to waiting pops.
+*                    Push_Error - Error given to waiting pushes.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Complete_Waiters(boost::system::error_code Pop_Error,boost::system::error_code Push_Error);
+/****************************************************************************************************
+* Function Name    : Enqueue
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Appends an operation to an intrusive queue.
+* Parameters (in)  : First     - Oldest operation of the queue.
+*                    Last      - Newest operation of the queue.
+*                    Operation - Operation to be appended.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Operation_Type>
+static void Enqueue(Operation_Type*& First,Operation_Type*& Last,Operation_Type* Operation);
+/****************************************************************************************************
+* Function Name    : Dequeue
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Removes the oldest operation of an intrusive queue.
+* Parameters (in)  : First - Oldest operation of the queue.
+*                    Last  - Newest operation of the queue.
+* Parameters (out) : None
+* Return value     : Operation_Type* - The removed operation, nullptr if the queue is empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Operation_Type>
+static Operation_Type* Dequeue(Operation_Type*& First,Operation_Type*& Last);
+private:
+    Executor_Type m_Executor;
+    /* Reject Policy "A Full Buffer Makes Pushes Wait Instead Of Losing Data" */
+    Circular_Buffer<Type,TOTAL_SIZE,Overflow_Policy::Reject> m_Buffer;
+    /* Pops Waiting On An Empty Buffer, Oldest First */
+    Pop_Operation* m_First_Consumer{};
+    Pop_Operation* m_Last_Consumer{};
+    /* Pushes Waiting On A Full Buffer, Oldest First */
+    Push_Operation* m_First_Producer{};
+    Push_Operation* m_Last_Producer{};
+    bool m_Closed{};
+};
+/*****************************************
+-------------    Pop_Handler     ---------
+*****************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+template <typename Handler_Type>
+struct Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Pop_Handler : Pop_Operation
+{
+    using Allocator_Type=Operation_Allocator<Pop_Handler,Handler_Type>;
+    Pop_Handler(Handler_Type&& Handler,const Executor_Type& Executor):
+    Pop_Operation{nullptr,&Complete},m_Handler{std::move(Handler)},m_Work{boost::asio::prefer(Executor,boost::asio::execution::outstanding_work.tracked)}
+    {}
+    /* Allocates The Node With The Handler Allocator */
+    static Pop_Operation* Create(Handler_Type&& Handler,const Executor_Type& Executor)
+    {
+        Allocator_Type Allocator{boost::asio::get_associated_allocator(Handler)};
+        Pop_Handler* Memory{std::allocator_traits<Allocator_Type>::allocate(Allocator,1)};
+        try{return new(Memory) Pop_Handler{std::move(Handler),Executor};}
+        catch(...){std::allocator_traits<Allocator_Type>::deallocate(Allocator,Memory,1);throw;}
+    }
+    /* Frees The Node Before The Upcall, Then Posts The Handler To Its Own Executor */
+    static void Complete(Pop_Operation* Base,boost::system::error_code Error,Type&& Value)
+    {
+        Pop_Handler* Self{static_cast<Pop_Handler*>(Base)};
+        Handler_Type Handler{std::move(Self->m_Handler)};
+        Work_Executor Work{std::move(Self->m_Work)};
+        Allocator_Type Allocator{boost::asio::get_associated_allocator(Handler)};
+        Self->~Pop_Handler();
+        std::allocator_traits<Allocator_Type>::deallocate(Allocator,Self,1);
+        const auto Executor{boost::asio::get_associated_executor(Handler,Work)};
+        boost::asio::post(Executor,[Handler=std::move(Handler),Error,Value=std::move(Value)]()mutable{std::move(Handler)(Error,std::move(Value));});
+    }
+    Handler_Type m_Handler;
+    Work_Executor m_Work;
+};
+/*****************************************
+------------    Push_Handler     ---------
+*****************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+template <typename Handler_Type>
+struct Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Push_Handler : Push_Operation
+{
+    using Allocator_Type=Operation_Allocator<Push_Handler,Handler_Type>;
+    Push_Handler(Handler_Type&& Handler,const Executor_Type& Executor,Type&& Element):
+    Push_Operation{nullptr,&Complete,std::move(Element)},m_Handler{std::move(Handler)},m_Work{boost::asio::prefer(Executor,boost::asio::execution::outstanding_work.tracked)}
+    {}
+    /* Allocates The Node With The Handler Allocator */
+    static Push_Operation* Create(Handler_Type&& Handler,const Executor_Type& Executor,Type&& Element)
+    {
+        Allocator_Type Allocator{boost::asio::get_associated_allocator(Handler)};
+        Push_Handler* Memory{std::allocator_traits<Allocator_Type>::allocate(Allocator,1)};
+        try{return new(Memory) Push_Handler{std::move(Handler),Executor,std::move(Element)};}
+        catch(...){std::allocator_traits<Allocator_Type>::deallocate(Allocator,Memory,1);throw;}
+    }
+    /* Frees The Node Before The Upcall, Then Posts The Handler To Its Own Executor */
+    static void Complete(Push_Operation* Base,boost::system::error_code Error)
+    {
+        Push_Handler* Self{static_cast<Push_Handler*>(Base)};
+        Handler_Type Handler{std::move(Self->m_Handler)};
+        Work_Executor Work{std::move(Self->m_Work)};
+        Allocator_Type Allocator{boost::asio::get_associated_allocator(Handler)};
+        Self->~Push_Handler();
+        std::allocator_traits<Allocator_Type>::deallocate(Allocator,Self,1);
+        const auto Executor{boost::asio::get_associated_executor(Handler,Work)};
+        boost::asio::post(Executor,[Handler=std::move(Handler),Error]()mutable{std::move(Handler)(Error);});
+    }
+    Handler_Type m_Handler;
+    Work_Executor m_Work;
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Asio_Circular_Buffer
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs an open and empty buffer bound to an executor.
+* Parameters (in)  : Executor - Every state change runs on it, pass a strand when the io_context is
+*                               run by more than one thread.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Asio_Circular_Buffer(const Executor_Type& Executor):
+m_Executor{Executor},m_Buffer{},m_First_Consumer{},m_Last_Consumer{},m_First_Producer{},m_Last_Producer{},m_Closed{}
+{}
+/****************************************************************************************************
+* Destructor Name  : ~Asio_Circular_Buffer
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Completes every pending operation with operation_aborted.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Must not run concurrently with other operations, destroy the buffer before the
+*                    io_context it posts to.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::~Asio_Circular_Buffer()
+{
+    Complete_Waiters(boost::asio::error::operation_aborted,boost::asio::error::operation_aborted);
+}
+/****************************************************************************************************
+* Function Name    : get_executor
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the executor the buffer state lives on.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : executor_type - The executor given at construction.
+* Notes            : Named after the asio I/O object convention.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+typename Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::executor_type Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::get_executor(void)const noexcept
+{
+    return m_Executor;
+}
+/****************************************************************************************************
+* Function Name    : async_pop
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Starts an asynchronous pop of the oldest element.
+* Parameters (in)  : Completion_Token - Callback, use_awaitable, use_future or any other token with
+*                                       signature void(boost::system::error_code, Type).
+* Parameters (out) : None
+* Return value     : Whatever the token produces.
+* Notes            : - Waits without polling while the buffer is empty.
+*                    - Completes with boost::asio::error::eof once closed and drained.
+*                    - The handler never runs inside this call, it is posted to its associated
+*                      executor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+template <typename Token_Type>
+auto Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::async_pop(Token_Type&& Completion_Token)
+{
+    return boost::asio::async_initiate<Token_Type,void(boost::system::error_code,Type)>([this](auto Handler)
+    {
+        Pop_Operation* Operation{Pop_Handler<decltype(Handler)>::Create(std::move(Handler),m_Executor)};
+        /* State Only Changes On The Buffer Executor "Strand Safe" */
+        boost::asio::dispatch(m_Executor,[this,Operation]{Pop_Or_Wait(Operation);});
+    },Completion_Token);
+}
+/****************************************************************************************************
+* Function Name    : async_push
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Starts an asynchronous push of an element.
+* Parameters (in)  : Element          - The element to be pushed.
+*                    Completion_Token - Callback, use_awaitable, use_future or any other token with
+*                                       signature void(boost::system::error_code).
+* Parameters (out) : None
+* Return value     : Whatever the token produces.
+* Notes            : - Waits without polling while the buffer is full.
+*                    - A waiting pop gets the element directly, skipping the ring.
+*                    - Completes with boost::asio::error::broken_pipe once closed.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+template <typename Token_Type>
+auto Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::async_push(Type Element,Token_Type&& Completion_Token)
+{
+    return boost::asio::async_initiate<Token_Type,void(boost::system::error_code)>([this](auto Handler,Type&& Value)
+    {
+        Push_Operation* Operation{Push_Handler<decltype(Handler)>::Create(std::move(Handler),m_Executor,std::move(Value))};
+        boost::asio::dispatch(m_Executor,[this,Operation]{Push_Or_Wait(Operation);});
+    },Completion_Token,std::move(Element));
+}
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Refuses further elements and completes every waiting operation.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Runs on the buffer executor, right away when called from it.
+*                    - Elements pushed before Close are still delivered.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+void Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Close(void)
+{
+    boost::asio::dispatch(m_Executor,[this]
+    {
+        if(m_Closed){return;}
+        m_Closed=true;
+        /* Waiting Pops Only Exist While The Ring Is Empty, So They See End Of Data */
+        Complete_Waiters(boost::asio::error::eof,boost::asio::error::broken_pipe);
+    });
+}
+/****************************************************************************************************
+* Function Name    : Pop_Or_Wait
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Completes a pop from the ring or queues it until an element arrives.
+* Parameters (in)  : Operation - The pop to serve.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Runs on the buffer executor only.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+void Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Pop_Or_Wait(Pop_Operation* Operation)
+{
+    if(std::optional<Type> Element{m_Buffer.Try_Pop()})
+    {
+        /* Freed Slot Goes To The Oldest Waiting Push So Order Is Kept */
+        if(Push_Operation* Producer{Dequeue(m_First_Producer,m_Last_Producer)})
+        {
+            m_Buffer.Push(std::move(Producer->m_Value));
+            Producer->m_Complete(Producer,{});
+        }
+        Operation->m_Complete(Operation,{},std::move(*Element));
+    }
+    else if(m_Closed){Operation->m_Complete(Operation,boost::asio::error::eof,Type{});}
+    else{Enqueue(m_First_Consumer,m_Last_Consumer,Operation);}
+}
+/****************************************************************************************************
+* Function Name    : Push_Or_Wait
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Completes a push into a waiting pop or the ring, or queues it until a slot frees.
+* Parameters (in)  : Operation - The push to serve.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Runs on the buffer executor only.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+void Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Push_Or_Wait(Push_Operation* Operation)
+{
+    if(m_Closed){Operation->m_Complete(Operation,boost::asio::error::broken_pipe);}
+    /* Direct Handoff "Ring Is Empty Whenever A Pop Waits" */
+    else if(Pop_Operation* Consumer{Dequeue(m_First_Consumer,m_Last_Consumer)})
+    {
+        Consumer->m_Complete(Consumer,{},std::move(Operation->m_Value));
+        Operation->m_Complete(Operation,{});
+    }
+    else if(m_Buffer.Size()<TOTAL_SIZE)
+    {
+        m_Buffer.Push(std::move(Operation->m_Value));
+        Operation->m_Complete(Operation,{});
+    }
+    else{Enqueue(m_First_Producer,m_Last_Producer,Operation);}
+}
+/****************************************************************************************************
+* Function Name    : Complete_Waiters
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Completes every queued operation with an error.
+* Parameters (in)  : Pop_Error  - Error given to waiting pops.
+*                    Push_Error - Error given to waiting pushes.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+void Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Complete_Waiters(boost::system::error_code Pop_Error,boost::system::error_code Push_Error)
+{
+    while(Pop_Operation* Consumer{Dequeue(m_First_Consumer,m_Last_Consumer)}){Consumer->m_Complete(Consumer,Pop_Error,Type{});}
+    while(Push_Operation* Producer{Dequeue(m_First_Producer,m_Last_Producer)}){Producer->m_Complete(Producer,Push_Error);}
+}
+/****************************************************************************************************
+* Function Name    : Enqueue
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Appends an operation to an intrusive queue.
+* Parameters (in)  : First     - Oldest operation of the queue.
+*                    Last      - Newest operation of the queue.
+*                    Operation - Operation to be appended.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+template <typename Operation_Type>
+void Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Enqueue(Operation_Type*& First,Operation_Type*& Last,Operation_Type* Operation)
+{
+    Operation->m_Next=nullptr;
+    if(Last){Last->m_Next=Operation;}
+    else{First=Operation;}
+    Last=Operation;
+}
+/****************************************************************************************************
+* Function Name    : Dequeue
+* Class            : Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Removes the oldest operation of an intrusive queue.
+* Parameters (in)  : First - Oldest operation of the queue.
+*                    Last  - Newest operation of the queue.
+* Parameters (out) : None
+* Return value     : Operation_Type* - The removed operation, nullptr if the queue is empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename Executor_Type>
+template <typename Operation_Type>
+Operation_Type* Asio_Circular_Buffer<Type, TOTAL_SIZE, Executor_Type>::Dequeue(Operation_Type*& First,Operation_Type*& Last)
+{
+    Operation_Type* Operation{First};
+    if(Operation)
+    {
+        First=Operation->m_Next;
+        if(!First){Last=nullptr;}
+    }
+    return Operation;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Asio_Circular_Buffer.hpp
+********************************************************************/
+#endif
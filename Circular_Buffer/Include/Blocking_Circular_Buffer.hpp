@@ -0,0 +1,493 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Blocking_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Thread safe circular buffer whose waiters sleep on a futex instead of spinning
+ *  Class Name:  Blocking_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _BLOCKING_CIRCULAR_BUFFER_HPP_
+#define _BLOCKING_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+-----    Blocking_Circular_Buffer     ----
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=10>
+class Blocking_Circular_Buffer
+{
+/* Top Bit Of Push Gate, Lower Bits Count Pushes In Flight */
+static constexpr uint32_t GATE_CLOSED{1U<<31};
+static_assert(sizeof(std::atomic<uint32_t>)==sizeof(uint32_t)&&std::atomic<uint32_t>::is_always_lock_free,
+              "Blocking_Circular_Buffer Needs A Plain 32 Bit Atomic To Use As Futex Word");
+public:
+/****************************************************************************************************
+* Constructor Name : Blocking_Circular_Buffer
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Blocking_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Buffer starts open and empty.
+*****************************************************************************************************/
+Blocking_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : Try_Push
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the buffer without blocking.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full or closed.
+* Notes            : - Wakes one sleeping consumer, no syscall is made when nobody sleeps.
+*                    - Holds the push gate while storing so Close cannot finish in between, an
+*                      accepted element is always delivered.
+*****************************************************************************************************/
+bool Try_Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Push_Wait
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element, sleeping while the buffer is full.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is closed.
+* Notes            : Sleeps on a futex until a consumer frees a slot or Close is called.
+*****************************************************************************************************/
+bool Push_Wait(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Try_Pop
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element at the head of the buffer without blocking.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty if the buffer is empty.
+* Notes            : - Wakes one sleeping producer, no syscall is made when nobody sleeps.
+*                    - Moves the element out, Type needs no default constructor.
+*****************************************************************************************************/
+std::optional<Type> Try_Pop(void);
+/****************************************************************************************************
+* Function Name    : Pop_Wait
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element at the head of the buffer, sleeping while it is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty once the buffer is closed
+*                    and drained.
+* Notes            : Elements pushed before Close are still delivered.
+*****************************************************************************************************/
+std::optional<Type> Pop_Wait(void);
+/****************************************************************************************************
+* Function Name    : Pop_For
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element at the head of the buffer, sleeping at most Timeout.
+* Parameters (in)  : Timeout - Longest time to wait for an element.
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty on timeout or once the buffer
+*                    is closed and drained.
+* Notes            : Timeout is measured on std::chrono::steady_clock.
+*****************************************************************************************************/
+template <typename Rep_Type,typename Period_Type>
+std::optional<Type> Pop_For(const std::chrono::duration<Rep_Type,Period_Type>& Timeout);
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Shuts the buffer down and wakes every sleeping thread.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Pushes fail from now on, pops drain what is left then return empty.
+*                    - Waits for pushes already past the gate to land before consumers are told.
+*                    - Closing twice is harmless.
+*****************************************************************************************************/
+void Close(void);
+/****************************************************************************************************
+* Function Name    : Is_Closed
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if Close was called.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is closed, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Closed(void)const;
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the current size of the buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Wait_For_Change
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Sleeps until a sequence moves away from a value it was seen holding.
+* Parameters (in)  : Sequence - Futex word bumped by the other side after every transfer.
+*                    Seen     - Value of Sequence read before the failed attempt.
+*                    Waiting  - Sleeper counter of this side, tells the other side to wake it.
+*                    Timeout  - Longest time to sleep, null to sleep until woken.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Returns at once if Sequence already changed "No Lost Wakeups".
+*                    - Spurious returns are fine, callers always retry.
+*****************************************************************************************************/
+static void Wait_For_Change(std::atomic<uint32_t>& Sequence,uint32_t Seen,std::atomic<uint32_t>& Waiting,const timespec* Timeout);
+/****************************************************************************************************
+* Function Name    : Publish_Change
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Bumps a sequence and wakes sleepers of the other side if there are any.
+* Parameters (in)  : Sequence - Futex word to bump.
+*                    Waiting  - Sleeper counter of the other side.
+*                    Count    - Number of sleepers to wake.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Only enters the kernel when Waiting is not zero.
+*****************************************************************************************************/
+static void Publish_Change(std::atomic<uint32_t>& Sequence,std::atomic<uint32_t>& Waiting,int Count);
+private:
+    /* Thread Safe Storage "Lock Free Bounded Queue" */
+    MPMC_Circular_Buffer<Type,TOTAL_SIZE> m_Buffer{};
+    /* Bumped After Every Push, Consumers Sleep On It */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_Push_Sequence{};
+    /* Consumers Currently Sleeping */
+    std::atomic<uint32_t> m_Consumers_Waiting{};
+    /* Bumped After Every Pop, Producers Sleep On It */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_Pop_Sequence{};
+    /* Producers Currently Sleeping */
+    std::atomic<uint32_t> m_Producers_Waiting{};
+    /* Closed Bit Plus Number Of Pushes In Flight "Close Waits For Them" */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_Push_Gate{};
+    /* Set By Close Once No Push Can Land Anymore, Consumers Stop On It */
+    std::atomic<bool> m_Closed{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Blocking_Circular_Buffer
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Blocking_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Buffer starts open and empty.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Blocking_Circular_Buffer():
+m_Buffer{},m_Push_Sequence{},m_Consumers_Waiting{},m_Pop_Sequence{},m_Producers_Waiting{},m_Push_Gate{},m_Closed{}
+{
+}
+/****************************************************************************************************
+* Function Name    : Try_Push
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the buffer without blocking.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full or closed.
+* Notes            : - Wakes one sleeping consumer, no syscall is made when nobody sleeps.
+*                    - Holds the push gate while storing so Close cannot finish in between, an
+*                      accepted element is always delivered.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Try_Push(const Type& Element)
+{
+    /* Enter Gate, Closed Buffer Refuses New Elements */
+    if(m_Push_Gate.fetch_add(1,std::memory_order_seq_cst)&GATE_CLOSED)
+    {
+        m_Push_Gate.fetch_sub(1,std::memory_order_release);
+        return false;
+    }
+    const bool Stored{m_Buffer.Try_Push(Element)};
+    if(Stored){Publish_Change(m_Push_Sequence,m_Consumers_Waiting,1);}
+    /* Leave Gate Only Once Element Is Visible */
+    m_Push_Gate.fetch_sub(1,std::memory_order_release);
+    return Stored;
+}
+/****************************************************************************************************
+* Function Name    : Push_Wait
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element, sleeping while the buffer is full.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is closed.
+* Notes            : Sleeps on a futex until a consumer frees a slot or Close is called.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Push_Wait(const Type& Element)
+{
+    while(true)
+    {
+        /* Read Sequence Before Trying So A Pop In Between Is Never Missed */
+        const uint32_t Seen{m_Pop_Sequence.load(std::memory_order_seq_cst)};
+        if(Is_Closed()){return false;}
+        if(Try_Push(Element)){return true;}
+        Wait_For_Change(m_Pop_Sequence,Seen,m_Producers_Waiting,nullptr);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Try_Pop
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element at the head of the buffer without blocking.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty if the buffer is empty.
+* Notes            : - Wakes one sleeping producer, no syscall is made when nobody sleeps.
+*                    - Moves the element out, Type needs no default constructor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+std::optional<Type> Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Try_Pop(void)
+{
+    std::optional<Type> Return_Data{m_Buffer.Try_Pop()};
+    if(Return_Data){Publish_Change(m_Pop_Sequence,m_Producers_Waiting,1);}
+    return Return_Data;
+}
+/****************************************************************************************************
+* Function Name    : Pop_Wait
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element at the head of the buffer, sleeping while it is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty once the buffer is closed
+*                    and drained.
+* Notes            : Elements pushed before Close are still delivered.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+std::optional<Type> Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Pop_Wait(void)
+{
+    while(true)
+    {
+        /* Read Sequence Before Trying So A Push In Between Is Never Missed */
+        const uint32_t Seen{m_Push_Sequence.load(std::memory_order_seq_cst)};
+        /* Read Close Before Trying, Every Accepted Push Is Visible Once It Is Set */
+        const bool Closed{m_Closed.load(std::memory_order_acquire)};
+        std::optional<Type> Return_Data{Try_Pop()};
+        if(Return_Data){return Return_Data;}
+        /* Closed And Drained */
+        if(Closed){return std::nullopt;}
+        Wait_For_Change(m_Push_Sequence,Seen,m_Consumers_Waiting,nullptr);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Pop_For
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element at the head of the buffer, sleeping at most Timeout.
+* Parameters (in)  : Timeout - Longest time to wait for an element.
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty on timeout or once the buffer
+*                    is closed and drained.
+* Notes            : Timeout is measured on std::chrono::steady_clock.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+template <typename Rep_Type,typename Period_Type>
+std::optional<Type> Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Pop_For(const std::chrono::duration<Rep_Type,Period_Type>& Timeout)
+{
+    const auto Deadline{std::chrono::steady_clock::now()+std::chrono::ceil<std::chrono::steady_clock::duration>(Timeout)};
+    while(true)
+    {
+        /* Read Sequence Before Trying So A Push In Between Is Never Missed */
+        const uint32_t Seen{m_Push_Sequence.load(std::memory_order_seq_cst)};
+        /* Read Close Before Trying, Every Accepted Push Is Visible Once It Is Set */
+        const bool Closed{m_Closed.load(std::memory_order_acquire)};
+        std::optional<Type> Return_Data{Try_Pop()};
+        if(Return_Data){return Return_Data;}
+        /* Closed And Drained */
+        if(Closed){return std::nullopt;}
+        /* Sleep For What Is Left Of Timeout Only */
+        const auto Remaining{std::chrono::duration_cast<std::chrono::nanoseconds>(Deadline-std::chrono::steady_clock::now())};
+        if(Remaining.count()<=0){return std::nullopt;}
+        const timespec Relative{static_cast<time_t>(Remaining.count()/1'000'000'000),static_cast<long>(Remaining.count()%1'000'000'000)};
+        Wait_For_Change(m_Push_Sequence,Seen,m_Consumers_Waiting,&Relative);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Shuts the buffer down and wakes every sleeping thread.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Pushes fail from now on, pops drain what is left then return empty.
+*                    - Waits for pushes already past the gate to land before consumers are told.
+*                    - Closing twice is harmless.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Close(void)
+{
+    /* Shut Gate Then Wait For Pushes Already Inside "They Never Block" */
+    m_Push_Gate.fetch_or(GATE_CLOSED,std::memory_order_seq_cst);
+    while(m_Push_Gate.load(std::memory_order_acquire)!=GATE_CLOSED){std::this_thread::yield();}
+    m_Closed.store(true,std::memory_order_release);
+    /* Move Both Sequences So Sleepers Cannot Miss The Close */
+    Publish_Change(m_Push_Sequence,m_Consumers_Waiting,INT_MAX);
+    Publish_Change(m_Pop_Sequence,m_Producers_Waiting,INT_MAX);
+}
+/****************************************************************************************************
+* Function Name    : Is_Closed
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if Close was called.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is closed, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Is_Closed(void)const
+{
+    return m_Push_Gate.load(std::memory_order_acquire)&GATE_CLOSED;
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the current size of the buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+size_t Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Size(void)const
+{
+    return m_Buffer.Size();
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Is_Empty(void)const
+{
+    return m_Buffer.Is_Empty();
+}
+/****************************************************************************************************
+* Function Name    : Wait_For_Change
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Sleeps until a sequence moves away from a value it was seen holding.
+* Parameters (in)  : Sequence - Futex word bumped by the other side after every transfer.
+*                    Seen     - Value of Sequence read before the failed attempt.
+*                    Waiting  - Sleeper counter of this side, tells the other side to wake it.
+*                    Timeout  - Longest time to sleep, null to sleep until woken.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Returns at once if Sequence already changed "No Lost Wakeups".
+*                    - Spurious returns are fine, callers always retry.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Wait_For_Change(std::atomic<uint32_t>& Sequence,uint32_t Seen,std::atomic<uint32_t>& Waiting,const timespec* Timeout)
+{
+    /* Announce Sleeper Before Kernel Compares Sequence "Publisher Reads It After Bumping" */
+    Waiting.fetch_add(1,std::memory_order_seq_cst);
+    syscall(SYS_futex,reinterpret_cast<uint32_t*>(&Sequence),FUTEX_WAIT_PRIVATE,Seen,Timeout,nullptr,0);
+    Waiting.fetch_sub(1,std::memory_order_relaxed);
+}
+/****************************************************************************************************
+* Function Name    : Publish_Change
+* Class            : Blocking_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Bumps a sequence and wakes sleepers of the other side if there are any.
+* Parameters (in)  : Sequence - Futex word to bump.
+*                    Waiting  - Sleeper counter of the other side.
+*                    Count    - Number of sleepers to wake.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Only enters the kernel when Waiting is not zero.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Blocking_Circular_Buffer<Type, TOTAL_SIZE>::Publish_Change(std::atomic<uint32_t>& Sequence,std::atomic<uint32_t>& Waiting,int Count)
+{
+    Sequence.fetch_add(1,std::memory_order_seq_cst);
+    /* Uncontended Path Stays In User Space */
+    if(Waiting.load(std::memory_order_seq_cst)!=0)
+    {
+        syscall(SYS_futex,reinterpret_cast<uint32_t*>(&Sequence),FUTEX_WAKE_PRIVATE,Count,nullptr,nullptr,0);
+    }
+}
+}
+/********************************************************************
+ *  END OF FILE:  Blocking_Circular_Buffer.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,581 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Broadcast_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Single writer ring read by many independent readers, each with its own cursor
+ *  Class Name:  Broadcast_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _BROADCAST_CIRCULAR_BUFFER_HPP_
+#define _BROADCAST_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* What The Writer Does When The Slowest Reader Is A Full Lap Behind */
+enum class Broadcast_Policy
+{
+    /* Writer Never Waits, Lapped Readers Skip Ahead And Are Told How Much They Missed */
+    Lapping,
+    /* Writer Waits For The Slowest Subscribed Reader, Nothing Is Lost */
+    Backpressure
+};
+/* Outcome Of One Read */
+enum class Read_Status
+{
+    /* An Element Was Copied Out */
+    Element,
+    /* Reader Is Caught Up With The Writer */
+    Empty,
+    /* Writer Closed The Ring And The Reader Has Read Everything */
+    Closed
+};
+/*****************************************
+----    Broadcast_Circular_Buffer     ----
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=16,Broadcast_Policy POLICY=Broadcast_Policy::Lapping,size_t MAX_READERS=16>
+class Broadcast_Circular_Buffer
+{
+static_assert(TOTAL_SIZE>0&&(TOTAL_SIZE&(TOTAL_SIZE-1))==0,"Broadcast_Circular_Buffer Size Must Be A Power Of Two \"Sequence To Slot Is A Mask\"");
+static_assert(std::is_trivially_copyable_v<Type>,"Broadcast_Circular_Buffer Readers Copy Slots Optimistically And Retry On A Torn Read");
+static_assert(MAX_READERS>0,"Broadcast_Circular_Buffer Needs Room For At Least One Reader");
+public:
+    /* Result Of One Read, Missed Counts Elements Overwritten Before This Reader Got To Them */
+    struct Read_Result
+    {
+        Read_Status m_Status{Read_Status::Empty};
+        uint64_t m_Sequence{};
+        uint64_t m_Missed{};
+    };
+    /*****************************************
+    ----------    Reader     -----------
+    *****************************************/
+    class Reader
+    {
+    public:
+        Reader(const Reader&)=delete;
+        Reader& operator=(const Reader&)=delete;
+/****************************************************************************************************
+* Constructor Name : Reader
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes over a subscription from another handle.
+* Parameters (in)  : Object - Handle left without a subscription.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+Reader(Reader&& Object)noexcept;
+/****************************************************************************************************
+* Function Name    : operator=
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Drops the current subscription and takes over another one.
+* Parameters (in)  : Object - Handle left without a subscription.
+* Parameters (out) : None
+* Return value     : Reader& - This handle.
+* Notes            : None
+*****************************************************************************************************/
+Reader& operator=(Reader&& Object)noexcept;
+/****************************************************************************************************
+* Destructor Name  : ~Reader
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Unsubscribes, the writer stops waiting for this reader.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+~Reader();
+/****************************************************************************************************
+* Function Name    : Try_Read
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the next element for this reader without waiting.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element when the status is Element.
+* Return value     : Read_Result - Status, sequence of the element and elements missed before it.
+* Notes            : - A lapped reader jumps to the oldest element still in the ring, the gap is
+*                      reported with the next element it reads.
+*                    - Must be called from one thread at a time.
+*****************************************************************************************************/
+Read_Result Try_Read(Type& Element);
+/****************************************************************************************************
+* Function Name    : Read
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Same as Try_Read but waits while the reader is caught up.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element when the status is Element.
+* Return value     : Read_Result - Element, or Closed once the writer closed and all is read.
+* Notes            : Waits by yielding the core, suited to dedicated reader threads.
+*****************************************************************************************************/
+Read_Result Read(Type& Element);
+/****************************************************************************************************
+* Function Name    : Lag
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many published elements this reader has not read yet.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Published minus cursor, above TOTAL_SIZE means already lapped.
+* Notes            : Only a snapshot while the writer is active.
+*****************************************************************************************************/
+uint64_t Lag(void)const;
+    private:
+        friend class Broadcast_Circular_Buffer;
+        Reader(Broadcast_Circular_Buffer* Owner,size_t Index,uint64_t Cursor):
+        m_Owner{Owner},m_Index{Index},m_Cursor{Cursor},m_Missed{}
+        {
+        }
+        /* Buffer This Reader Is Subscribed To, nullptr Once Moved From */
+        Broadcast_Circular_Buffer* m_Owner{};
+        /* Slot Of The Shared Cursor The Writer Gates On */
+        size_t m_Index{};
+        /* Next Sequence To Read "Reader Local, Mirrored To The Shared Slot Under Backpressure" */
+        uint64_t m_Cursor{};
+        /* Elements Skipped Since The Last Element Returned */
+        uint64_t m_Missed{};
+    };
+/****************************************************************************************************
+* Constructor Name : Broadcast_Circular_Buffer
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Broadcast_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Every slot is built once and rewritten in place.
+*****************************************************************************************************/
+Broadcast_Circular_Buffer();
+Broadcast_Circular_Buffer(const Broadcast_Circular_Buffer&)=delete;
+Broadcast_Circular_Buffer& operator=(const Broadcast_Circular_Buffer&)=delete;
+/****************************************************************************************************
+* Function Name    : Subscribe
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Registers a new reader starting after the newest published element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Reader - Handle owning the subscription until destroyed.
+* Notes            : - Any thread, any time, readers never receive elements published earlier.
+*                    - Throws std::runtime_error if MAX_READERS readers are already subscribed.
+*****************************************************************************************************/
+Reader Subscribe(void);
+/****************************************************************************************************
+* Function Name    : Try_Write
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes an element to every reader without waiting.
+* Parameters (in)  : Element - The element to be published.
+* Parameters (out) : None
+* Return value     : bool - False only under Backpressure while the slowest reader is a lap behind.
+* Notes            : Single writer only, the element is written once whatever the reader count.
+*****************************************************************************************************/
+bool Try_Write(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Write
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes an element to every reader.
+* Parameters (in)  : Element - The element to be published.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Under Backpressure waits by yielding the core until the slowest reader moves.
+*****************************************************************************************************/
+void Write(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Tells readers no more elements will be published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Readers still get everything published before Close.
+*****************************************************************************************************/
+void Close(void);
+/****************************************************************************************************
+* Function Name    : Published
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many elements the writer has published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence the next element will get.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Published(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Has_Room
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks if every subscribed reader is past the slot a sequence reuses.
+* Parameters (in)  : Sequence - Sequence about to be written.
+* Parameters (out) : None
+* Return value     : bool - True if no subscribed reader still needs the slot.
+* Notes            : Scans the reader cursors only when the cached minimum is not enough.
+*****************************************************************************************************/
+bool Has_Room(uint64_t Sequence);
+private:
+    /* Sequence Mask "Size Is A Power Of Two" */
+    static constexpr uint64_t MASK{TOTAL_SIZE-1};
+    /* Version Is 2*Sequence+1 While Written And 2*Sequence+2 Once Complete */
+    struct Slot
+    {
+        std::atomic<uint64_t> m_Version{};
+        Type m_Value{};
+    };
+    /* Shared Cursor Of One Subscription, Own Line So Readers Do Not Disturb Each Other */
+    struct alignas(CACHE_LINE_SIZE) Reader_Slot
+    {
+        std::atomic<uint64_t> m_Cursor{};
+        std::atomic<bool> m_Active{};
+    };
+    /* Elements Up To Here Are Readable, Written By Writer Only */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Published{};
+    /* Set Once By Close */
+    std::atomic<bool> m_Closed{};
+    /* Slowest Reader Cursor Last Seen By Writer */
+    alignas(CACHE_LINE_SIZE) uint64_t m_Cached_Slowest{};
+    /* One Cursor Per Possible Subscription "Memory Does Not Grow With Readers" */
+    std::array<Reader_Slot,MAX_READERS> m_Readers{};
+    /* Elements Written Once And Shared By Every Reader */
+    alignas(CACHE_LINE_SIZE) std::array<Slot,TOTAL_SIZE> m_Slots{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Broadcast_Circular_Buffer
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Broadcast_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Every slot is built once and rewritten in place.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Broadcast_Circular_Buffer():
+m_Published{},m_Closed{},m_Cached_Slowest{},m_Readers{},m_Slots{}
+{
+}
+/****************************************************************************************************
+* Function Name    : Subscribe
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Registers a new reader starting after the newest published element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Reader - Handle owning the subscription until destroyed.
+* Notes            : - Any thread, any time, readers never receive elements published earlier.
+*                    - Throws std::runtime_error if MAX_READERS readers are already subscribed.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+typename Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Subscribe(void)
+{
+    for(size_t Index{};Index<MAX_READERS;Index++)
+    {
+        bool Free{false};
+        if(m_Readers[Index].m_Active.compare_exchange_strong(Free,true,std::memory_order_acq_rel))
+        {
+            /* Stale Cursor Left By An Old Reader Is Lower, Writer Only Waits Longer Until This Store */
+            const uint64_t Start{m_Published.load(std::memory_order_acquire)};
+            m_Readers[Index].m_Cursor.store(Start,std::memory_order_release);
+            return Reader{this,Index,Start};
+        }
+    }
+    throw std::runtime_error("Too Many Broadcast Readers");
+}
+/****************************************************************************************************
+* Function Name    : Try_Write
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes an element to every reader without waiting.
+* Parameters (in)  : Element - The element to be published.
+* Parameters (out) : None
+* Return value     : bool - False only under Backpressure while the slowest reader is a lap behind.
+* Notes            : Single writer only, the element is written once whatever the reader count.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+bool Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Try_Write(const Type& Element)
+{
+    /* Only The Writer Stores It, Relaxed Read Is Enough */
+    const uint64_t Sequence{m_Published.load(std::memory_order_relaxed)};
+    if constexpr(POLICY==Broadcast_Policy::Backpressure){if(!Has_Room(Sequence)){return false;}}
+    Slot& Target{m_Slots[Sequence&MASK]};
+    /* Odd Version First So A Reader Copying This Slot Sees The Change And Retries */
+    Target.m_Version.store(2*Sequence+1,std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(static_cast<void*>(&Target.m_Value),&Element,sizeof(Type));
+    Target.m_Version.store(2*Sequence+2,std::memory_order_release);
+    m_Published.store(Sequence+1,std::memory_order_release);
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Write
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes an element to every reader.
+* Parameters (in)  : Element - The element to be published.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Under Backpressure waits by yielding the core until the slowest reader moves.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+void Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Write(const Type& Element)
+{
+    while(!Try_Write(Element)){std::this_thread::yield();}
+}
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Tells readers no more elements will be published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Readers still get everything published before Close.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+void Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Close(void)
+{
+    m_Closed.store(true,std::memory_order_release);
+}
+/****************************************************************************************************
+* Function Name    : Published
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many elements the writer has published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence the next element will get.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+uint64_t Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Published(void)const
+{
+    return m_Published.load(std::memory_order_acquire);
+}
+/****************************************************************************************************
+* Function Name    : Has_Room
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks if every subscribed reader is past the slot a sequence reuses.
+* Parameters (in)  : Sequence - Sequence about to be written.
+* Parameters (out) : None
+* Return value     : bool - True if no subscribed reader still needs the slot.
+* Notes            : Scans the reader cursors only when the cached minimum is not enough.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+bool Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Has_Room(uint64_t Sequence)
+{
+    if(Sequence<m_Cached_Slowest+TOTAL_SIZE){return true;}
+    /* No Subscribed Reader Means Nobody To Wait For */
+    uint64_t Slowest{Sequence};
+    for(const Reader_Slot& Subscription:m_Readers)
+    {
+        if(Subscription.m_Active.load(std::memory_order_acquire))
+        {
+            Slowest=std::min(Slowest,Subscription.m_Cursor.load(std::memory_order_acquire));
+        }
+    }
+    m_Cached_Slowest=Slowest;
+    return Sequence<m_Cached_Slowest+TOTAL_SIZE;
+}
+/****************************************************************************************************
+* Constructor Name : Reader
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes over a subscription from another handle.
+* Parameters (in)  : Object - Handle left without a subscription.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader::Reader(Reader&& Object)noexcept:
+m_Owner{std::exchange(Object.m_Owner,nullptr)},m_Index{Object.m_Index},m_Cursor{Object.m_Cursor},m_Missed{Object.m_Missed}
+{
+}
+/****************************************************************************************************
+* Function Name    : operator=
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Drops the current subscription and takes over another one.
+* Parameters (in)  : Object - Handle left without a subscription.
+* Parameters (out) : None
+* Return value     : Reader& - This handle.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+typename Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader& Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader::operator=(Reader&& Object)noexcept
+{
+    if(this!=&Object)
+    {
+        if(m_Owner){m_Owner->m_Readers[m_Index].m_Active.store(false,std::memory_order_release);}
+        m_Owner=std::exchange(Object.m_Owner,nullptr);
+        m_Index=Object.m_Index;
+        m_Cursor=Object.m_Cursor;
+        m_Missed=Object.m_Missed;
+    }
+    return *this;
+}
+/****************************************************************************************************
+* Destructor Name  : ~Reader
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Unsubscribes, the writer stops waiting for this reader.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader::~Reader()
+{
+    if(m_Owner){m_Owner->m_Readers[m_Index].m_Active.store(false,std::memory_order_release);}
+}
+/****************************************************************************************************
+* Function Name    : Try_Read
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the next element for this reader without waiting.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element when the status is Element.
+* Return value     : Read_Result - Status, sequence of the element and elements missed before it.
+* Notes            : - A lapped reader jumps to the oldest element still in the ring, the gap is
+*                      reported with the next element it reads.
+*                    - Must be called from one thread at a time.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+typename Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Read_Result Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader::Try_Read(Type& Element)
+{
+    if(!m_Owner){throw std::runtime_error("Reader Is Not Subscribed");}
+    /* Read Close First, Every Element Published Before It Is Then Visible */
+    const bool Closed{m_Owner->m_Closed.load(std::memory_order_acquire)};
+    uint64_t Published{m_Owner->m_Published.load(std::memory_order_acquire)};
+    while(m_Cursor<Published)
+    {
+        /* Writer Is More Than A Lap Ahead, Oldest Surviving Element Is A Lap Behind It */
+        if(Published-m_Cursor>TOTAL_SIZE)
+        {
+            m_Missed+=Published-TOTAL_SIZE-m_Cursor;
+            m_Cursor=Published-TOTAL_SIZE;
+        }
+        const Slot& Source{m_Owner->m_Slots[m_Cursor&MASK]};
+        const uint64_t Expected{2*m_Cursor+2};
+        if(Source.m_Version.load(std::memory_order_acquire)==Expected)
+        {
+            std::memcpy(&Element,static_cast<const void*>(&Source.m_Value),sizeof(Type));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            /* Unchanged Version Means The Copy Was Not Torn */
+            if(Source.m_Version.load(std::memory_order_relaxed)==Expected)
+            {
+                const Read_Result Result{Read_Status::Element,m_Cursor,std::exchange(m_Missed,0)};
+                m_Cursor++;
+                if constexpr(POLICY==Broadcast_Policy::Backpressure)
+                {
+                    m_Owner->m_Readers[m_Index].m_Cursor.store(m_Cursor,std::memory_order_release);
+                }
+                return Result;
+            }
+        }
+        /* Slot Reused While Copying, Writer Is Now Writing At Least A Lap Ahead */
+        Published=m_Owner->m_Published.load(std::memory_order_acquire);
+        const uint64_t Oldest{Published+1>TOTAL_SIZE?Published+1-TOTAL_SIZE:0};
+        const uint64_t Next{std::max(m_Cursor+1,Oldest)};
+        m_Missed+=Next-m_Cursor;
+        m_Cursor=Next;
+    }
+    return Read_Result{Closed?Read_Status::Closed:Read_Status::Empty,m_Cursor,0};
+}
+/****************************************************************************************************
+* Function Name    : Read
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Same as Try_Read but waits while the reader is caught up.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element when the status is Element.
+* Return value     : Read_Result - Element, or Closed once the writer closed and all is read.
+* Notes            : Waits by yielding the core, suited to dedicated reader threads.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+typename Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Read_Result Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader::Read(Type& Element)
+{
+    while(true)
+    {
+        const Read_Result Result{Try_Read(Element)};
+        if(Result.m_Status!=Read_Status::Empty){return Result;}
+        std::this_thread::yield();
+    }
+}
+/****************************************************************************************************
+* Function Name    : Lag
+* Class            : Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many published elements this reader has not read yet.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Published minus cursor, above TOTAL_SIZE means already lapped.
+* Notes            : Only a snapshot while the writer is active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Broadcast_Policy POLICY, size_t MAX_READERS>
+uint64_t Broadcast_Circular_Buffer<Type, TOTAL_SIZE, POLICY, MAX_READERS>::Reader::Lag(void)const
+{
+    if(!m_Owner){return 0;}
+    return m_Owner->m_Published.load(std::memory_order_acquire)-m_Cursor;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Broadcast_Circular_Buffer.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,426 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Buffer_Statistics.hpp
+ *  Date: November 30, 2024
+ *  Description: Compile time statistics policies counting what happens to a Circular_Buffer
+ *  Class Name:  No_Statistics, Atomic_Statistics
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _BUFFER_STATISTICS_HPP_
+#define _BUFFER_STATISTICS_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Counters Read Out Of A Buffer At One Point In Time */
+struct Buffer_Statistics
+{
+    /* Elements Accepted, Including Ones That Overwrote Older Elements */
+    uint64_t m_Pushes{};
+    /* Elements Removed By Pop, Pop_N Or Commit_Read */
+    uint64_t m_Pops{};
+    /* Oldest Elements Lost To Overwrite */
+    uint64_t m_Overwrites{};
+    /* New Elements Refused By A Full Reject Buffer */
+    uint64_t m_Drops{};
+    /* Largest Size Ever Reached */
+    size_t m_High_Water_Mark{};
+    /* Total Time Spent Full, Including A Full Period Still Running */
+    std::chrono::nanoseconds m_Time_At_Full{};
+    /* When Counting Started And When This Snapshot Was Taken */
+    std::chrono::steady_clock::time_point m_Started_At{};
+    std::chrono::steady_clock::time_point m_Taken_At{};
+};
+/****************************************************************************************************
+* Function Name    : Push_Rate
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Returns the pushes per second between two snapshots of the same buffer.
+* Parameters (in)  : Earlier - Older snapshot, a default one measures from when counting started.
+*                    Later   - Newer snapshot.
+* Parameters (out) : None
+* Return value     : double - Pushes per second, zero when no time passed.
+* Notes            : None
+*****************************************************************************************************/
+inline double Push_Rate(const Buffer_Statistics& Earlier,const Buffer_Statistics& Later)
+{
+    const auto Since{(Earlier.m_Taken_At==std::chrono::steady_clock::time_point{})?Later.m_Started_At:Earlier.m_Taken_At};
+    const std::chrono::duration<double> Elapsed{Later.m_Taken_At-Since};
+    return (Elapsed.count()>0.0)?static_cast<double>(Later.m_Pushes-Earlier.m_Pushes)/Elapsed.count():0.0;
+}
+/****************************************************************************************************
+* Function Name    : Pop_Rate
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Returns the pops per second between two snapshots of the same buffer.
+* Parameters (in)  : Earlier - Older snapshot, a default one measures from when counting started.
+*                    Later   - Newer snapshot.
+* Parameters (out) : None
+* Return value     : double - Pops per second, zero when no time passed.
+* Notes            : None
+*****************************************************************************************************/
+inline double Pop_Rate(const Buffer_Statistics& Earlier,const Buffer_Statistics& Later)
+{
+    const auto Since{(Earlier.m_Taken_At==std::chrono::steady_clock::time_point{})?Later.m_Started_At:Earlier.m_Taken_At};
+    const std::chrono::duration<double> Elapsed{Later.m_Taken_At-Since};
+    return (Elapsed.count()>0.0)?static_cast<double>(Later.m_Pops-Earlier.m_Pops)/Elapsed.count():0.0;
+}
+/*****************************************
+-----------    No_Statistics     ---------
+*****************************************/
+/* Default Policy, Circular_Buffer Compiles Every Hook Out When ENABLED Is False */
+struct No_Statistics
+{
+    static constexpr bool ENABLED{false};
+};
+/*****************************************
+---------    Atomic_Statistics     -------
+*****************************************/
+class Atomic_Statistics
+{
+public:
+    static constexpr bool ENABLED{true};
+/****************************************************************************************************
+* Constructor Name : Atomic_Statistics
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Starts counting from zero.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+Atomic_Statistics();
+/****************************************************************************************************
+* Constructor Name : Atomic_Statistics (Copy Constructor)
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Carries the counters of a copied buffer over.
+* Parameters (in)  : Object - Counters to copy.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+Atomic_Statistics(const Atomic_Statistics& Object);
+/****************************************************************************************************
+* Function Name    : operator= (Copy Assignment)
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Carries the counters of an assigned buffer over.
+* Parameters (in)  : Object - Counters to copy.
+* Parameters (out) : None
+* Return value     : Atomic_Statistics& - Reference to this object.
+* Notes            : None
+*****************************************************************************************************/
+Atomic_Statistics& operator=(const Atomic_Statistics& Object);
+/****************************************************************************************************
+* Function Name    : Record_Push
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts elements accepted by the buffer.
+* Parameters (in)  : Count    - Elements accepted.
+*                    Size     - Buffer size after the push.
+*                    Capacity - Buffer capacity.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Reads the clock only when the buffer turns full.
+*****************************************************************************************************/
+void Record_Push(size_t Count,size_t Size,size_t Capacity);
+/****************************************************************************************************
+* Function Name    : Record_Pop
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts elements removed from the buffer.
+* Parameters (in)  : Count    - Elements removed.
+*                    Size     - Buffer size after the pop.
+*                    Capacity - Buffer capacity.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Reads the clock only when the buffer stops being full.
+*****************************************************************************************************/
+void Record_Pop(size_t Count,size_t Size,size_t Capacity);
+/****************************************************************************************************
+* Function Name    : Record_Overwrite
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts oldest elements lost to new ones.
+* Parameters (in)  : Count - Elements overwritten.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Record_Overwrite(size_t Count);
+/****************************************************************************************************
+* Function Name    : Record_Drop
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts new elements a full buffer refused.
+* Parameters (in)  : Count - Elements refused.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Record_Drop(size_t Count);
+/****************************************************************************************************
+* Function Name    : Snapshot
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reads every counter out.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Buffer_Statistics - Counters at the time of the call.
+* Notes            : Safe from any thread, counters are read one by one without a common instant.
+*****************************************************************************************************/
+Buffer_Statistics Snapshot(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Add
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Adds to a counter only the owning buffer writes.
+* Parameters (in)  : Counter - Counter to update.
+*                    Count   - Amount to add.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Plain load and store, no locked instruction "One Writer, Any Number Of Readers".
+*****************************************************************************************************/
+static void Add(std::atomic<uint64_t>& Counter,uint64_t Count);
+/****************************************************************************************************
+* Function Name    : Now
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the steady clock in nanoseconds.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : int64_t - Nanoseconds since the steady clock epoch, never zero.
+* Notes            : None
+*****************************************************************************************************/
+static int64_t Now(void);
+private:
+    std::atomic<uint64_t> m_Pushes{};
+    std::atomic<uint64_t> m_Pops{};
+    std::atomic<uint64_t> m_Overwrites{};
+    std::atomic<uint64_t> m_Drops{};
+    std::atomic<uint64_t> m_High_Water_Mark{};
+    /* Nanoseconds Spent Full In Periods That Already Ended */
+    std::atomic<int64_t> m_Full_Nanoseconds{};
+    /* Start Of The Running Full Period, Zero While Not Full */
+    std::atomic<int64_t> m_Full_Since{};
+    std::chrono::steady_clock::time_point m_Started_At{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Atomic_Statistics
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Starts counting from zero.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+inline Atomic_Statistics::Atomic_Statistics():
+m_Started_At{std::chrono::steady_clock::now()}
+{}
+/****************************************************************************************************
+* Constructor Name : Atomic_Statistics (Copy Constructor)
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Carries the counters of a copied buffer over.
+* Parameters (in)  : Object - Counters to copy.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+inline Atomic_Statistics::Atomic_Statistics(const Atomic_Statistics& Object)
+{
+    *this=Object;
+}
+/****************************************************************************************************
+* Function Name    : operator= (Copy Assignment)
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Carries the counters of an assigned buffer over.
+* Parameters (in)  : Object - Counters to copy.
+* Parameters (out) : None
+* Return value     : Atomic_Statistics& - Reference to this object.
+* Notes            : None
+*****************************************************************************************************/
+inline Atomic_Statistics& Atomic_Statistics::operator=(const Atomic_Statistics& Object)
+{
+    m_Pushes.store(Object.m_Pushes.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_Pops.store(Object.m_Pops.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_Overwrites.store(Object.m_Overwrites.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_Drops.store(Object.m_Drops.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_High_Water_Mark.store(Object.m_High_Water_Mark.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_Full_Nanoseconds.store(Object.m_Full_Nanoseconds.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_Full_Since.store(Object.m_Full_Since.load(std::memory_order_relaxed),std::memory_order_relaxed);
+    m_Started_At=Object.m_Started_At;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name    : Record_Push
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts elements accepted by the buffer.
+* Parameters (in)  : Count    - Elements accepted.
+*                    Size     - Buffer size after the push.
+*                    Capacity - Buffer capacity.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Reads the clock only when the buffer turns full.
+*****************************************************************************************************/
+inline void Atomic_Statistics::Record_Push(size_t Count,size_t Size,size_t Capacity)
+{
+    Add(m_Pushes,Count);
+    if(Size>m_High_Water_Mark.load(std::memory_order_relaxed)){m_High_Water_Mark.store(Size,std::memory_order_relaxed);}
+    if((Size==Capacity)&&(m_Full_Since.load(std::memory_order_relaxed)==0)){m_Full_Since.store(Now(),std::memory_order_relaxed);}
+}
+/****************************************************************************************************
+* Function Name    : Record_Pop
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts elements removed from the buffer.
+* Parameters (in)  : Count    - Elements removed.
+*                    Size     - Buffer size after the pop.
+*                    Capacity - Buffer capacity.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Reads the clock only when the buffer stops being full.
+*****************************************************************************************************/
+inline void Atomic_Statistics::Record_Pop(size_t Count,size_t Size,size_t Capacity)
+{
+    Add(m_Pops,Count);
+    const int64_t Full_Since{m_Full_Since.load(std::memory_order_relaxed)};
+    if((Size<Capacity)&&(Full_Since!=0))
+    {
+        m_Full_Nanoseconds.store(m_Full_Nanoseconds.load(std::memory_order_relaxed)+(Now()-Full_Since),std::memory_order_relaxed);
+        m_Full_Since.store(0,std::memory_order_relaxed);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Record_Overwrite
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts oldest elements lost to new ones.
+* Parameters (in)  : Count - Elements overwritten.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+inline void Atomic_Statistics::Record_Overwrite(size_t Count)
+{
+    Add(m_Overwrites,Count);
+}
+/****************************************************************************************************
+* Function Name    : Record_Drop
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts new elements a full buffer refused.
+* Parameters (in)  : Count - Elements refused.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+inline void Atomic_Statistics::Record_Drop(size_t Count)
+{
+    Add(m_Drops,Count);
+}
+/****************************************************************************************************
+* Function Name    : Snapshot
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reads every counter out.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Buffer_Statistics - Counters at the time of the call.
+* Notes            : Safe from any thread, counters are read one by one without a common instant.
+*****************************************************************************************************/
+inline Buffer_Statistics Atomic_Statistics::Snapshot(void)const
+{
+    Buffer_Statistics Statistics{};
+    Statistics.m_Taken_At=std::chrono::steady_clock::now();
+    Statistics.m_Started_At=m_Started_At;
+    Statistics.m_Pushes=m_Pushes.load(std::memory_order_relaxed);
+    Statistics.m_Pops=m_Pops.load(std::memory_order_relaxed);
+    Statistics.m_Overwrites=m_Overwrites.load(std::memory_order_relaxed);
+    Statistics.m_Drops=m_Drops.load(std::memory_order_relaxed);
+    Statistics.m_High_Water_Mark=static_cast<size_t>(m_High_Water_Mark.load(std::memory_order_relaxed));
+    /* Running Full Period Counts Up To Now */
+    const int64_t Full_Since{m_Full_Since.load(std::memory_order_relaxed)};
+    const int64_t Running{(Full_Since!=0)?std::max<int64_t>(Now()-Full_Since,0):0};
+    Statistics.m_Time_At_Full=std::chrono::nanoseconds{m_Full_Nanoseconds.load(std::memory_order_relaxed)+Running};
+    return Statistics;
+}
+/****************************************************************************************************
+* Function Name    : Add
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Adds to a counter only the owning buffer writes.
+* Parameters (in)  : Counter - Counter to update.
+*                    Count   - Amount to add.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Plain load and store, no locked instruction "One Writer, Any Number Of Readers".
+*****************************************************************************************************/
+inline void Atomic_Statistics::Add(std::atomic<uint64_t>& Counter,uint64_t Count)
+{
+    Counter.store(Counter.load(std::memory_order_relaxed)+Count,std::memory_order_relaxed);
+}
+/****************************************************************************************************
+* Function Name    : Now
+* Class            : Atomic_Statistics
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the steady clock in nanoseconds.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : int64_t - Nanoseconds since the steady clock epoch, never zero.
+* Notes            : None
+*****************************************************************************************************/
+inline int64_t Atomic_Statistics::Now(void)
+{
+    const int64_t Nanoseconds{std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()};
+    return (Nanoseconds!=0)?Nanoseconds:1;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Buffer_Statistics.hpp
+********************************************************************/
+#endif
@@ -9,614 +9,3286 @@
  *  Namespace:  Data_Structure
  *  (C) 2023 "@t0ti20". All rights reserved.
 *******************************************************************/
+#ifndef _CIRCULAR_BUFFER_HPP_
+#define _CIRCULAR_BUFFER_HPP_
+/******************************************************************/
 /*****************************************
 -----------     INCLUDES     -------------
 *****************************************/
+#include <span>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <compare>
+#include <thread>
 #include <initializer_list>
+#include "Buffer_Statistics.hpp"
 /*****************************************
 ----------    GLOBAL DATA     ------------
 *****************************************/
 namespace Data_Structure
 {
+/* Size Used To Pad Indices Shared Between Threads "Avoid False Sharing" */
+inline constexpr size_t CACHE_LINE_SIZE{64};
+/* What Circular_Buffer Does When Pushing Into A Full Buffer Or Popping From An Empty One */
+enum class Overflow_Policy
+{
+    /* Drop The Oldest Element, Pop Throws On Empty "Default Behaviour" */
+    Overwrite,
+    /* Refuse The New Element, Push Returns False */
+    Reject,
+    /* No Bounds Checks At All, Caller Guarantees Space And Elements "Hot Loops" */
+    Unchecked
+};
+/*****************************************
+-----------    Buffer_Index     ----------
+*****************************************/
+template <size_t TOTAL_SIZE,bool POWER_OF_TWO=((TOTAL_SIZE&(TOTAL_SIZE-1))==0)>
+struct Buffer_Index
+{
+/****************************************************************************************************
+* Function Name    : Next
+* Class            : Buffer_Index<TOTAL_SIZE, false>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the position following the given one.
+* Parameters (in)  : Position - Current position, always kept inside [0, TOTAL_SIZE).
+* Parameters (out) : None
+* Return value     : size_t - Next position "Care About Overflow".
+* Notes            : Wraps with a branch instead of modulo for sizes that are not a power of two.
+*****************************************************************************************************/
+static constexpr size_t Next(size_t Position){return (Position+1==TOTAL_SIZE)?0:(Position+1);}
+/****************************************************************************************************
+* Function Name    : Advance
+* Class            : Buffer_Index<TOTAL_SIZE, false>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the position found a number of steps after the given one.
+* Parameters (in)  : Position - Current position, always kept inside [0, TOTAL_SIZE).
+*                    Count    - Number of steps to move forward.
+* Parameters (out) : None
+* Return value     : size_t - Advanced position "Care About Overflow".
+* Notes            : Only reduces Count with modulo when it exceeds a full lap "Bulk Paths Only".
+*****************************************************************************************************/
+static constexpr size_t Advance(size_t Position,size_t Count)
+{
+    if(Count>=TOTAL_SIZE){Count%=TOTAL_SIZE;}
+    Position+=Count;
+    return (Position>=TOTAL_SIZE)?(Position-TOTAL_SIZE):Position;
+}
+/****************************************************************************************************
+* Function Name    : Slot
+* Class            : Buffer_Index<TOTAL_SIZE, false>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Converts a position into an index of the storage array.
+* Parameters (in)  : Position - Current position, always kept inside [0, TOTAL_SIZE).
+* Parameters (out) : None
+* Return value     : size_t - Index inside the storage array.
+* Notes            : Positions are already wrapped by Next so this is the identity.
+*****************************************************************************************************/
+static constexpr size_t Slot(size_t Position){return Position;}
+};
+template <size_t TOTAL_SIZE>
+struct Buffer_Index<TOTAL_SIZE,true>
+{
+    /* Mask Replacing Modulo For Power Of Two Sizes */
+    static constexpr size_t MASK{TOTAL_SIZE-1};
+/****************************************************************************************************
+* Function Name    : Next
+* Class            : Buffer_Index<TOTAL_SIZE, true>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the position following the given one.
+* Parameters (in)  : Position - Current free running position.
+* Parameters (out) : None
+* Return value     : size_t - Next position.
+* Notes            : Positions run freely and are only masked when the storage is accessed.
+*****************************************************************************************************/
+static constexpr size_t Next(size_t Position){return Position+1;}
+/****************************************************************************************************
+* Function Name    : Advance
+* Class            : Buffer_Index<TOTAL_SIZE, true>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the position found a number of steps after the given one.
+* Parameters (in)  : Position - Current free running position.
+*                    Count    - Number of steps to move forward.
+* Parameters (out) : None
+* Return value     : size_t - Advanced position.
+* Notes            : None
+*****************************************************************************************************/
+static constexpr size_t Advance(size_t Position,size_t Count){return Position+Count;}
+/****************************************************************************************************
+* Function Name    : Slot
+* Class            : Buffer_Index<TOTAL_SIZE, true>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Converts a position into an index of the storage array.
+* Parameters (in)  : Position - Current free running position.
+* Parameters (out) : None
+* Return value     : size_t - Index inside the storage array.
+* Notes            : None
+*****************************************************************************************************/
+static constexpr size_t Slot(size_t Position){return Position&MASK;}
+};
 /*****************************************
 ---------    Circular_Buffer     ---------
 *****************************************/
-template <typename Type=int,size_t TOTAL_SIZE=10>
+template <typename Type=int,size_t TOTAL_SIZE=10,Overflow_Policy POLICY=Overflow_Policy::Overwrite,typename STATISTICS=No_Statistics>
 class Circular_Buffer
 {
+static_assert(TOTAL_SIZE>0,"Circular_Buffer Size Must Be Greater Than Zero");
+public:
+    /* Up To Two Contiguous Regions "Before And After Wrap Point" */
+    using Readable_Regions=std::array<std::span<const Type>,2>;
+    using Writable_Regions=std::array<std::span<Type>,2>;
 private:
+    /* Index Arithmetic Selected At Compile Time "Mask Or Branch" */
+    using Index=Buffer_Index<TOTAL_SIZE>;
 /*****************************************
 ---------    Buffer_Iterator     ---------
 *****************************************/
+template <bool CONSTANT>
 struct Buffer_Iterator
 {
 using difference_type=std::ptrdiff_t;
 using value_type=Type;
-using pointer=Type*;
-using reference=Type&;
-using iterator_category=std::forward_iterator_tag;
+using pointer=std::conditional_t<CONSTANT,const Type*,Type*>;
+using reference=std::conditional_t<CONSTANT,const Type&,Type&>;
+using iterator_category=std::random_access_iterator_tag;
+using iterator_concept=std::random_access_iterator_tag;
+/* Singular Iterator "Required By Iterator Concepts" */
+constexpr Buffer_Iterator()=default;
 /****************************************************************************************************
 * Constructor       : Buffer_Iterator
 * Type              : Public
-* Class             : Buffer_Iterator
+* Class             : Buffer_Iterator<CONSTANT>
 * Namespace         : Data_Structure::Circular_Buffer
 * Description       : Constructs a Buffer_Iterator object.
 * Parameters (in)   : 
-*   - Buffer        : Pointer to the buffer "Data Array".
-*   - Current_Index : Current index of the iterator to start from.
-*   - Total_Elements: Total elements in the buffer should I iterate through.
+*                       - Buffer        : Pointer to the buffer "Data Array".
+*                       - Head_Index    : Position of the oldest element, offsets are counted from it.
+*                       - Offset        : Logical offset of the element from the head.
+* Parameters (out)  : None
+* Return value      : None
 * Notes             : None
 *****************************************************************************************************/
-constexpr Buffer_Iterator(pointer Buffer,size_t Current_Index,size_t Total_Elements);
+constexpr Buffer_Iterator(pointer Buffer,size_t Head_Index,difference_type Offset);
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator (Conversion)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Converts a mutable iterator into a constant one.
+* Parameters (in)   : 
+*                       - Object        : Mutable iterator to convert.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : Only constant iterators can be built from mutable ones.
+*****************************************************************************************************/
+template <bool OTHER_CONSTANT>requires (CONSTANT&&!OTHER_CONSTANT)
+constexpr Buffer_Iterator(const Buffer_Iterator<OTHER_CONSTANT>& Object);
 /****************************************************************************************************
 * Function Name     : operator*
 * Type              : Public
-* Class             : Buffer_Iterator
+* Class             : Buffer_Iterator<CONSTANT>
 * Namespace         : Data_Structure::Circular_Buffer
 * Description       : Dereferences the iterator, returning a reference to the current element.
 * Parameters (in)   : None
 * Parameters (out)  : None
 * Return value      : reference - Reference to the current element in the buffer.
+* Notes             : Offset is turned into a slot with one add and a mask or branch "No Modulo".
+*****************************************************************************************************/
+constexpr reference operator*()const;
+/****************************************************************************************************
+* Function Name     : operator->
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns a pointer to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : pointer - Pointer to the current element in the buffer.
+* Notes             : None
+*****************************************************************************************************/
+constexpr pointer operator->()const;
+/****************************************************************************************************
+* Function Name     : operator[]
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns the element found a number of steps away from the iterator.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps from the current element.
+* Parameters (out)  : None
+* Return value      : reference - Reference to the element at that offset.
 * Notes             : None
 *****************************************************************************************************/
-constexpr reference operator*();
+constexpr reference operator[](difference_type Offset)const;
 /****************************************************************************************************
-* Function Name     : operator!=
+* Function Name     : operator++
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Pre-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being incremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator++();
+/****************************************************************************************************
+* Function Name     : operator++ (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Post-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being incremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator++(int);
+/****************************************************************************************************
+* Function Name     : operator--
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Pre-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being decremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator--();
+/****************************************************************************************************
+* Function Name     : operator-- (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Post-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being decremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator--(int);
+/****************************************************************************************************
+* Function Name     : operator+=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Moves the iterator a number of steps in constant time.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator+=(difference_type Offset);
+/****************************************************************************************************
+* Function Name     : operator-=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Moves the iterator a number of steps backwards in constant time.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator-=(difference_type Offset);
+/****************************************************************************************************
+* Function Name     : operator+
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns an iterator a number of steps after this one.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator+(difference_type Offset)const;
+/****************************************************************************************************
+* Function Name     : operator-
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns an iterator a number of steps before this one.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator-(difference_type Offset)const;
+/****************************************************************************************************
+* Function Name     : operator- (Distance)
 * Type              : Public
-* Class             : Buffer_Iterator
+* Class             : Buffer_Iterator<CONSTANT>
 * Namespace         : Data_Structure::Circular_Buffer
-* Description       : Inequality comparison operator for Buffer_Iterator objects.
+* Description       : Returns the number of steps between two iterators.
 * Parameters (in)   : 
-*   - Object        : Another Buffer_Iterator object to compare with.
+*                       - Object        : Iterator of the same buffer to measure from.
 * Parameters (out)  : None
-* Return value      : bool - True if the iterators are unequal, false otherwise.
-* Notes             : Returns true if the iterators have different current indices or total elements.
+* Return value      : difference_type - Signed distance from Object to this iterator.
+* Notes             : None
 *****************************************************************************************************/
-constexpr bool operator!=(const Buffer_Iterator& Object);
+constexpr difference_type operator-(const Buffer_Iterator& Object)const;
 /****************************************************************************************************
 * Function Name     : operator==
 * Type              : Public
-* Class             : Buffer_Iterator
+* Class             : Buffer_Iterator<CONSTANT>
 * Namespace         : Data_Structure::Circular_Buffer
 * Description       : Equality comparison operator for Buffer_Iterator objects.
 * Parameters (in)   : 
-*   - Object        : Another Buffer_Iterator object to compare with.
+*                       - Object        : Another Buffer_Iterator object to compare with.
 * Parameters (out)  : None
 * Return value      : bool - True if the iterators are equal, false otherwise.
-* Notes             : None
+* Notes             : Inequality is derived from it.
+*****************************************************************************************************/
+constexpr bool operator==(const Buffer_Iterator& Object)const;
+/****************************************************************************************************
+* Function Name     : operator<=>
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Orders two iterators of the same buffer.
+* Parameters (in)   : 
+*                       - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : std::strong_ordering - Order of the logical offsets.
+* Notes             : Relational operators are derived from it.
+*****************************************************************************************************/
+constexpr std::strong_ordering operator<=>(const Buffer_Iterator& Object)const;
+/* Offset First Form Of operator+ "Required By Random Access Iterators" */
+friend constexpr Buffer_Iterator operator+(difference_type Offset,const Buffer_Iterator& Object){return Object+Offset;}
+private:
+    /* Constant Iterator Copies The Members Of A Mutable One */
+    friend struct Buffer_Iterator<!CONSTANT>;
+    /* Array Base Containing ELements */
+    pointer m_Buffer{};
+    /* Position Of Oldest Element When Iterator Was Made */
+    size_t m_Head_Index{};
+    /* Logical Offset From Head "Random Access In Constant Time" */
+    difference_type m_Offset{};
+};
+public:
+    /* Random Access Iterators Over Live Elements "Oldest First" */
+    using iterator=Buffer_Iterator<false>;
+    using const_iterator=Buffer_Iterator<true>;
+    using reverse_iterator=std::reverse_iterator<iterator>;
+    using const_reverse_iterator=std::reverse_iterator<const_iterator>;
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer (Initializer List)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructor for the Circular_Buffer class that initializes the buffer with elements
+*                    from an initializer list.
+* Parameters (in)  : Values - An initializer list of elements to initialize the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes member variables and pushes elements from the initializer list into
+*                    the buffer. Throws a runtime error if the size of the initializer list exceeds
+*                    the total size of the buffer.
+*****************************************************************************************************/
+Circular_Buffer(const std::initializer_list<Type>& Values);
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes member variables to their default values, storage is left
+*                    uninitialized so construction is O(1) and Type needs no default constructor.
+*****************************************************************************************************/
+Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : ~Circular_Buffer (Destructor)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Destroys the live elements only, free slots were never constructed.
+*****************************************************************************************************/
+~Circular_Buffer();
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer (Copy)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the live elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Elements keep the same slots so head and tail indices are copied as they are.
+*****************************************************************************************************/
+Circular_Buffer(const Circular_Buffer& Object);
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer (Move)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves the live elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from, its elements are left moved-from.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Elements keep the same slots so head and tail indices are copied as they are.
+*****************************************************************************************************/
+Circular_Buffer(Circular_Buffer&& Object)noexcept(std::is_nothrow_move_constructible_v<Type>);
+/****************************************************************************************************
+* Function Name    : operator= (Copy)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with a copy of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>& - This buffer.
+* Notes            : Destroys the current live elements first, elements keep the slots of Object.
+*****************************************************************************************************/
+Circular_Buffer& operator=(const Circular_Buffer& Object);
+/****************************************************************************************************
+* Function Name    : operator= (Move)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with the elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from, its elements are left moved-from.
+* Parameters (out) : None
+* Return value     : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>& - This buffer.
+* Notes            : Destroys the current live elements first, elements keep the slots of Object.
+*****************************************************************************************************/
+Circular_Buffer& operator=(Circular_Buffer&& Object)noexcept(std::is_nothrow_move_constructible_v<Type>);
+/****************************************************************************************************
+* Function Name    : operator==
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Overloaded equality operator for Circular_Buffer.
+* Parameters (in)  : Array - An array to compare with the Circular_Buffer data.
+* Parameters (out) : None
+* Return value     : bool - True if the arrays are equal, false otherwise.
+* Notes            : Compares the storage slot by slot, so only a full buffer can be equal.
+*****************************************************************************************************/
+bool operator ==(std::array<Type,TOTAL_SIZE> Array)const;
+/****************************************************************************************************
+* Function Name    : operator==
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Overloaded equality operator for comparing two circular buffers.
+* Parameters (in)  : Object - The circular buffer to compare with.
+* Parameters (out) : None
+* Return value     : bool - True if the circular buffers are equal, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool operator==(const Circular_Buffer& Object)const;
+/****************************************************************************************************
+* Function Name    : Head
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the head of the buffer.
+* Notes            : Throws a runtime error if the buffer is empty, Unchecked skips the check.
+*****************************************************************************************************/
+const Type& Head(void)const;
+/****************************************************************************************************
+* Function Name    : Tail
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the tail of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the tail of the buffer.
+* Notes            : - Tail slot is the next one to be written, it only holds a live element "The
+*                      Oldest One" when the buffer is full.
+*                    - Throws a runtime error if the buffer is not full, Unchecked skips the check.
+*****************************************************************************************************/
+const Type& Tail(void)const;
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if a full Reject buffer refused it.
+* Notes            : - Appends the new element to the buffer.
+*                    - On a full buffer Overwrite drops the oldest element, Reject leaves both the
+*                      buffer and Element untouched and Unchecked must never be called.
+*****************************************************************************************************/
+bool Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be moved into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if a full Reject buffer refused it.
+* Notes            : - Appends the new element to the buffer.
+*                    - On a full buffer Overwrite drops the oldest element, Reject leaves both the
+*                      buffer and Element untouched and Unchecked must never be called.
+*****************************************************************************************************/
+bool Push(Type&& Element);
+/****************************************************************************************************
+* Function Name    : Emplace
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs a new element in place at the tail of the circular buffer.
+* Parameters (in)  : Arguments - Arguments forwarded to the constructor of Type.
+* Parameters (out) : None
+* Return value     : Type& - Reference to the new element.
+* Notes            : - Constructs directly in the free slot, no temporary is made.
+*                    - On overflow the oldest element is replaced by move assignment of a temporary.
+*                    - Not available under Reject, there is no element to refer to when refused.
+*****************************************************************************************************/
+template <typename... Arguments_Type>
+Type& Emplace(Arguments_Type&&... Arguments)requires (POLICY!=Overflow_Policy::Reject);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - The element removed from the buffer.
+* Notes            : - Moves the element out, Type needs no default constructor.
+*                    - Throws a runtime error if the buffer is empty, Unchecked skips the check.
+*                    - Prefer Try_Pop when polling, an empty buffer is not exceptional there.
+*****************************************************************************************************/
+Type Pop(void);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves the element at the head of the circular buffer out.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer by move assignment.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : Never throws on an empty buffer "Polling Friendly".
+*****************************************************************************************************/
+bool Pop(Type& Element);
+/****************************************************************************************************
+* Function Name    : Try_Pop
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer if any.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty if the buffer is empty.
+* Notes            : - Never throws on an empty buffer "Polling Friendly".
+*                    - Moves the element out, Type needs no default constructor.
+*****************************************************************************************************/
+std::optional<Type> Try_Pop(void);
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a batch of elements into the circular buffer.
+* Parameters (in)  : Elements - Contiguous elements to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements taken from Elements under the overflow policy.
+* Notes            : - Copies in at most two contiguous segments around the wrap point.
+*                    - Uses memcpy when Type is trivially copyable.
+*                    - Overwrite drops the oldest elements on overflow so every element is taken, only
+*                      the last TOTAL_SIZE elements of an oversized batch are actually copied.
+*                    - Reject takes the leading elements that fit in the free space.
+*                    - Unchecked takes every element, the batch must fit in the free space.
+*****************************************************************************************************/
+size_t Push_N(std::span<const Type> Elements);
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes a batch of elements from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the removed elements in order.
+* Return value     : size_t - Number of elements removed "Smaller Of Size And Elements Size".
+* Notes            : - Copies out in at most two contiguous segments around the wrap point.
+*                    - Uses memcpy when Type is trivially copyable.
+*                    - Never throws, an empty buffer simply returns zero.
+*****************************************************************************************************/
+size_t Pop_N(std::span<Type> Elements);
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the occupied region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first, second span is empty unless the
+*                    occupied region wraps around the end of the storage.
+* Notes            : - Zero copy, the spans point straight into the buffer storage.
+*                    - Views stay valid until the next operation that moves the head or overwrites.
+*                    - Call Commit_Read once the consumed elements are no longer needed.
+*****************************************************************************************************/
+Readable_Regions Readable_Spans(void)const;
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the free region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order, second span is empty unless the
+*                    free region wraps around the end of the storage.
+* Notes            : - Zero copy, data written into the spans becomes visible after Commit_Write.
+*                    - Never exposes occupied slots so it cannot overwrite unread elements.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+Writable_Regions Writable_Spans(void)requires std::is_trivially_copyable_v<Type>;
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases elements consumed through Readable_Spans.
+* Parameters (in)  : Count - Number of elements consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the current size, Unchecked skips
+*                    the check.
+*****************************************************************************************************/
+void Commit_Read(size_t Count);
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes elements written through Writable_Spans.
+* Parameters (in)  : Count - Number of elements written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the free space, Unchecked skips
+*                      the check.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+void Commit_Write(size_t Count)requires std::is_trivially_copyable_v<Type>;
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current size of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+size_t Size(void);
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Empty(void);
+/****************************************************************************************************
+* Function Name    : Statistics
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the counters kept by the statistics policy.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Buffer_Statistics - Pushes, pops, overwrites, drops, high water mark and time
+*                    spent full since the buffer was created.
+* Notes            : - Only exists when STATISTICS is enabled, No_Statistics keeps no counters.
+*                    - May be called from a monitoring thread while the owner keeps working.
+*****************************************************************************************************/
+Buffer_Statistics Statistics(void)const requires STATISTICS::ENABLED;
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr iterator begin() noexcept;
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr iterator end() noexcept;
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator begin()const noexcept;
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator end()const noexcept;
+/****************************************************************************************************
+* Function Name    : cbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator cbegin()const noexcept;
+/****************************************************************************************************
+* Function Name    : cend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator cend()const noexcept;
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr reverse_iterator rbegin() noexcept;
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr reverse_iterator rend() noexcept;
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator rbegin()const noexcept;
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator rend()const noexcept;
+/****************************************************************************************************
+* Function Name    : crbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator crbegin()const noexcept;
+/****************************************************************************************************
+* Function Name    : crend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator crend()const noexcept;
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+Type& At(size_t Offset);
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+const Type& At(size_t Offset)const;
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+Type& operator[](size_t Offset);
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+const Type& operator[](size_t Offset)const;
+private:
+/****************************************************************************************************
+* Function Name    : Data
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the storage viewed as an array of Type.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type* - First slot of the storage.
+* Notes            : Only slots between head and tail hold live elements.
+*****************************************************************************************************/
+Type* Data(void);
+/****************************************************************************************************
+* Function Name    : Data
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the storage viewed as an array of Type.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type* - First slot of the storage.
+* Notes            : Only slots between head and tail hold live elements.
+*****************************************************************************************************/
+const Type* Data(void)const;
+/****************************************************************************************************
+* Function Name    : Store
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Copies or moves an element into the tail slot.
+* Parameters (in)  : Element - The element to be stored, forwarded as given.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if a full Reject buffer refused it.
+* Notes            : - Constructs into a free slot, assigns over the oldest element on overflow.
+*                    - Adjusts the head and tail indices if necessary to handle overflow.
+*                    - Full check is compiled out under Unchecked.
+*****************************************************************************************************/
+template <typename Element_Type>
+bool Store(Element_Type&& Element);
+/****************************************************************************************************
+* Function Name    : Destroy_Elements
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Destroys a run of live elements starting at a position.
+* Parameters (in)  : Position - Position of the first element to destroy.
+*                    Count    - Number of elements to destroy "Not Larger Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Does nothing for trivially destructible types.
+*****************************************************************************************************/
+void Destroy_Elements(size_t Position,size_t Count);
+/****************************************************************************************************
+* Function Name    : Construct_Elements
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Copy constructs a contiguous run of elements into free slots.
+* Parameters (in)  : Source      - First element to copy from.
+*                    Count       - Number of elements to copy.
+* Parameters (out) : Destination - First free slot to construct in.
+* Return value     : None
+* Notes            : Uses memcpy when Type is trivially copyable.
+*****************************************************************************************************/
+static void Construct_Elements(Type* Destination,const Type* Source,size_t Count);
+/****************************************************************************************************
+* Function Name    : Move_Out_Elements
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Moves a contiguous run of live elements out and destroys them.
+* Parameters (in)  : Source      - First live element to move from.
+*                    Count       - Number of elements to move.
+* Parameters (out) : Destination - First element to move assign to.
+* Return value     : None
+* Notes            : Uses memcpy when Type is trivially copyable.
+*****************************************************************************************************/
+static void Move_Out_Elements(Type* Destination,Type* Source,size_t Count);
+private:
+    /* Total Size Of Current Elements In Buffer */
+    size_t m_Current_Size{};
+    /* Index Of Head To Pop From "Free Running When TOTAL_SIZE Is Power Of Two" */
+    size_t m_Head_Index{};
+    /* Index Of Tain To Push In "Free Running When TOTAL_SIZE Is Power Of Two" */
+    size_t m_Tail_Index{};
+    /* Raw Storage For Elements "Constructed Only While Live" */
+    alignas(Type) std::byte m_Data[sizeof(Type)*TOTAL_SIZE];
+    /* Counters Of The Statistics Policy "Takes No Space For No_Statistics" */
+    [[no_unique_address]] STATISTICS m_Statistics{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/*****************************************
+---------    Buffer_Iterator     ---------
+*****************************************/
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Constructs a Buffer_Iterator object.
+* Parameters (in)   : 
+*                       - Buffer        : Pointer to the buffer "Data Array".
+*                       - Head_Index    : Position of the oldest element, offsets are counted from it.
+*                       - Offset        : Logical offset of the element from the head.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::Buffer_Iterator(pointer Buffer,size_t Head_Index,difference_type Offset):
+m_Buffer(Buffer),m_Head_Index(Head_Index),m_Offset(Offset)
+{}
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator (Conversion)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Converts a mutable iterator into a constant one.
+* Parameters (in)   : 
+*                       - Object        : Mutable iterator to convert.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : Only constant iterators can be built from mutable ones.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+template <bool OTHER_CONSTANT>requires (CONSTANT&&!OTHER_CONSTANT)
+constexpr Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::Buffer_Iterator(const Buffer_Iterator<OTHER_CONSTANT>& Object):
+m_Buffer(Object.m_Buffer),m_Head_Index(Object.m_Head_Index),m_Offset(Object.m_Offset)
+{}
+/****************************************************************************************************
+* Function Name     : operator*
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Dereferences the iterator, returning a reference to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : reference - Reference to the current element in the buffer.
+* Notes             : Offset is turned into a slot with one add and a mask or branch "No Modulo".
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>::reference Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator*()const
+{
+    return m_Buffer[Index::Slot(Index::Advance(m_Head_Index,static_cast<size_t>(m_Offset)))];
+}
+/****************************************************************************************************
+* Function Name     : operator->
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns a pointer to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : pointer - Pointer to the current element in the buffer.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>::pointer Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator->()const
+{
+    return &**this;
+}
+/****************************************************************************************************
+* Function Name     : operator[]
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns the element found a number of steps away from the iterator.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps from the current element.
+* Parameters (out)  : None
+* Return value      : reference - Reference to the element at that offset.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>::reference Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator[](difference_type Offset)const
+{
+    return *(*this+Offset);
+}
+/****************************************************************************************************
+* Function Name     : operator++
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Pre-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being incremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator++()
+{
+    ++m_Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator++ (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Post-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being incremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT> Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator++(int)
+{
+    Buffer_Iterator Previous{*this};
+    ++m_Offset;
+    return Previous;
+}
+/****************************************************************************************************
+* Function Name     : operator--
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Pre-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being decremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator--()
+{
+    --m_Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator-- (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Post-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being decremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT> Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator--(int)
+{
+    Buffer_Iterator Previous{*this};
+    --m_Offset;
+    return Previous;
+}
+/****************************************************************************************************
+* Function Name     : operator+=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Moves the iterator a number of steps in constant time.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator+=(difference_type Offset)
+{
+    m_Offset+=Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator-=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Moves the iterator a number of steps backwards in constant time.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator-=(difference_type Offset)
+{
+    m_Offset-=Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator+
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns an iterator a number of steps after this one.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT> Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator+(difference_type Offset)const
+{
+    return Buffer_Iterator{m_Buffer,m_Head_Index,m_Offset+Offset};
+}
+/****************************************************************************************************
+* Function Name     : operator-
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns an iterator a number of steps before this one.
+* Parameters (in)   : 
+*                       - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT> Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator-(difference_type Offset)const
+{
+    return Buffer_Iterator{m_Buffer,m_Head_Index,m_Offset-Offset};
+}
+/****************************************************************************************************
+* Function Name     : operator- (Distance)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Returns the number of steps between two iterators.
+* Parameters (in)   : 
+*                       - Object        : Iterator of the same buffer to measure from.
+* Parameters (out)  : None
+* Return value      : difference_type - Signed distance from Object to this iterator.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::template Buffer_Iterator<CONSTANT>::difference_type Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator-(const Buffer_Iterator& Object)const
+{
+    return m_Offset-Object.m_Offset;
+}
+/****************************************************************************************************
+* Function Name     : operator==
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Equality comparison operator for Buffer_Iterator objects.
+* Parameters (in)   : 
+*                       - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : bool - True if the iterators are equal, false otherwise.
+* Notes             : Inequality is derived from it.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator==(const Buffer_Iterator& Object)const
+{
+    return m_Offset==Object.m_Offset;
+}
+/****************************************************************************************************
+* Function Name     : operator<=>
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Circular_Buffer
+* Description       : Orders two iterators of the same buffer.
+* Parameters (in)   : 
+*                       - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : std::strong_ordering - Order of the logical offsets.
+* Notes             : Relational operators are derived from it.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <bool CONSTANT>
+constexpr std::strong_ordering Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Buffer_Iterator<CONSTANT>::operator<=>(const Buffer_Iterator& Object)const
+{
+    return m_Offset<=>Object.m_Offset;
+}
+/*****************************************
+---------    Circular_Buffer     ---------
+*****************************************/
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer (Initializer List)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructor for the Circular_Buffer class that initializes the buffer with elements
+*                    from an initializer list.
+* Parameters (in)  : Values - An initializer list of elements to initialize the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes member variables and pushes elements from the initializer list into
+*                    the buffer. Throws a runtime error if the size of the initializer list exceeds
+*                    the total size of the buffer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Circular_Buffer(const std::initializer_list<Type>& Values):
+m_Current_Size{},m_Head_Index{},m_Tail_Index{}
+{
+    /* Check If Initializer Size Is Valid */
+    if(Values.size()<=TOTAL_SIZE)
+    {
+        /* Push All Elements In Initializer_List */
+        for(size_t Counter{};Counter<Values.size();Counter++)
+        {
+            Push(Values.begin()[Counter]);
+        }
+    }
+    /* Throw Runtime Exception Invalid Initializer_List Size */
+    else{throw std::runtime_error("Buffer Initializer Out Of Range");}
+}
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes member variables to their default values, storage is left
+*                    uninitialized so construction is O(1) and Type needs no default constructor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Circular_Buffer():
+m_Current_Size{},m_Head_Index{},m_Tail_Index{}
+{}
+/****************************************************************************************************
+* Function Name    : ~Circular_Buffer (Destructor)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Destroys the live elements only, free slots were never constructed.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::~Circular_Buffer()
+{
+    Destroy_Elements(m_Head_Index,m_Current_Size);
+}
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer (Copy)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the live elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Elements keep the same slots so head and tail indices are copied as they are.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Circular_Buffer(const Circular_Buffer& Object):
+m_Current_Size{},m_Head_Index{Object.m_Head_Index},m_Tail_Index{Object.m_Head_Index}
+{
+    const auto Regions{Object.Readable_Spans()};
+    for(const Type& Element:Regions[0]){Push(Element);}
+    for(const Type& Element:Regions[1]){Push(Element);}
+    /* Rebuilding Is Not Traffic, Counters Follow The Elements */
+    if constexpr(STATISTICS::ENABLED){m_Statistics=Object.m_Statistics;}
+}
+/****************************************************************************************************
+* Constructor Name : Circular_Buffer (Move)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves the live elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from, its elements are left moved-from.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Elements keep the same slots so head and tail indices are copied as they are.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Circular_Buffer(Circular_Buffer&& Object)noexcept(std::is_nothrow_move_constructible_v<Type>):
+m_Current_Size{},m_Head_Index{Object.m_Head_Index},m_Tail_Index{Object.m_Head_Index}
+{
+    for(size_t Counter{},Position{Object.m_Head_Index};Counter<Object.m_Current_Size;Counter++)
+    {
+        Push(std::move(Object.Data()[Index::Slot(Position)]));
+        Position=Index::Next(Position);
+    }
+    /* Rebuilding Is Not Traffic, Counters Follow The Elements */
+    if constexpr(STATISTICS::ENABLED){m_Statistics=Object.m_Statistics;}
+}
+/****************************************************************************************************
+* Function Name    : operator= (Copy)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with a copy of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>& - This buffer.
+* Notes            : Destroys the current live elements first, elements keep the slots of Object.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::operator=(const Circular_Buffer& Object)
+{
+    if(this!=&Object)
+    {
+        /* Drop Current Elements Then Rebuild In The Same Slots As Object */
+        Destroy_Elements(m_Head_Index,m_Current_Size);
+        m_Current_Size=0;
+        m_Head_Index=m_Tail_Index=Object.m_Head_Index;
+        const auto Regions{Object.Readable_Spans()};
+        for(const Type& Element:Regions[0]){Push(Element);}
+        for(const Type& Element:Regions[1]){Push(Element);}
+        if constexpr(STATISTICS::ENABLED){m_Statistics=Object.m_Statistics;}
+    }
+    return *this;
+}
+/****************************************************************************************************
+* Function Name    : operator= (Move)
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with the elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from, its elements are left moved-from.
+* Parameters (out) : None
+* Return value     : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>& - This buffer.
+* Notes            : Destroys the current live elements first, elements keep the slots of Object.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::operator=(Circular_Buffer&& Object)noexcept(std::is_nothrow_move_constructible_v<Type>)
+{
+    if(this!=&Object)
+    {
+        /* Drop Current Elements Then Rebuild In The Same Slots As Object */
+        Destroy_Elements(m_Head_Index,m_Current_Size);
+        m_Current_Size=0;
+        m_Head_Index=m_Tail_Index=Object.m_Head_Index;
+        for(size_t Counter{},Position{Object.m_Head_Index};Counter<Object.m_Current_Size;Counter++)
+        {
+            Push(std::move(Object.Data()[Index::Slot(Position)]));
+            Position=Index::Next(Position);
+        }
+        if constexpr(STATISTICS::ENABLED){m_Statistics=Object.m_Statistics;}
+    }
+    return *this;
+}
+/****************************************************************************************************
+* Function Name    : operator==
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Overloaded equality operator for Circular_Buffer.
+* Parameters (in)  : Array - An array to compare with the Circular_Buffer data.
+* Parameters (out) : None
+* Return value     : bool - True if the arrays are equal, false otherwise.
+* Notes            : Compares the storage slot by slot, so only a full buffer can be equal.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::operator ==(std::array<Type,TOTAL_SIZE> Array)const
+{
+    return (m_Current_Size==TOTAL_SIZE)&&std::equal(Array.begin(),Array.end(),Data());
+}
+/****************************************************************************************************
+* Function Name    : operator==
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Overloaded equality operator for comparing two circular buffers.
+* Parameters (in)  : Object - The circular buffer to compare with.
+* Parameters (out) : None
+* Return value     : bool - True if the circular buffers are equal, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::operator==(const Circular_Buffer& Object)const
+{
+    if((Object.m_Current_Size!=m_Current_Size)||(Index::Slot(Object.m_Head_Index)!=Index::Slot(m_Head_Index))||(Index::Slot(Object.m_Tail_Index)!=Index::Slot(m_Tail_Index))){return false;}
+    /* Same Slots Are Live In Both Buffers "Compare Them Only" */
+    const auto Regions{Readable_Spans()};
+    const auto Object_Regions{Object.Readable_Spans()};
+    return std::equal(Regions[0].begin(),Regions[0].end(),Object_Regions[0].begin())&&std::equal(Regions[1].begin(),Regions[1].end(),Object_Regions[1].begin());
+}
+/****************************************************************************************************
+* Function Name    : Head
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the head of the buffer.
+* Notes            : Throws a runtime error if the buffer is empty, Unchecked skips the check.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+const Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Head(void)const
+{
+    /* Buffer Is Empty "Caller Guarantees Elements When Unchecked" */
+    if constexpr(POLICY!=Overflow_Policy::Unchecked)
+    {
+        if(m_Current_Size==0){throw std::runtime_error("Buffer Is Empty !");}
+    }
+    return Data()[Index::Slot(m_Head_Index)];
+}
+/****************************************************************************************************
+* Function Name    : Tail
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the tail of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the tail of the buffer.
+* Notes            : - Tail slot is the next one to be written, it only holds a live element "The
+*                      Oldest One" when the buffer is full.
+*                    - Throws a runtime error if the buffer is not full, Unchecked skips the check.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+const Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Tail(void)const
+{
+    /* Tail Slot Is Free Unless Buffer Is Full */
+    if constexpr(POLICY!=Overflow_Policy::Unchecked)
+    {
+        if(m_Current_Size!=TOTAL_SIZE){throw std::runtime_error("Buffer Is Not Full !");}
+    }
+    return Data()[Index::Slot(m_Tail_Index)];
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if a full Reject buffer refused it.
+* Notes            : - Appends the new element to the buffer.
+*                    - On a full buffer Overwrite drops the oldest element, Reject leaves both the
+*                      buffer and Element untouched and Unchecked must never be called.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Push(const Type& Element)
+{
+    return Store(Element);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be moved into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if a full Reject buffer refused it.
+* Notes            : - Appends the new element to the buffer.
+*                    - On a full buffer Overwrite drops the oldest element, Reject leaves both the
+*                      buffer and Element untouched and Unchecked must never be called.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Push(Type&& Element)
+{
+    return Store(std::move(Element));
+}
+/****************************************************************************************************
+* Function Name    : Emplace
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs a new element in place at the tail of the circular buffer.
+* Parameters (in)  : Arguments - Arguments forwarded to the constructor of Type.
+* Parameters (out) : None
+* Return value     : Type& - Reference to the new element.
+* Notes            : - Constructs directly in the free slot, no temporary is made.
+*                    - On overflow the oldest element is replaced by move assignment of a temporary.
+*                    - Not available under Reject, there is no element to refer to when refused.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <typename... Arguments_Type>
+Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Emplace(Arguments_Type&&... Arguments)requires (POLICY!=Overflow_Policy::Reject)
+{
+    Type *Slot{Data()+Index::Slot(m_Tail_Index)};
+    /* Buffer Full "Arguments May Refer To The Oldest Element, Build Before Replacing It" */
+    if((POLICY==Overflow_Policy::Overwrite)&&(m_Current_Size==TOTAL_SIZE))
+    {
+        *Slot=Type(std::forward<Arguments_Type>(Arguments)...);
+        m_Head_Index=Index::Next(m_Head_Index);
+        if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Overwrite(1);}
+    }
+    /* Construct New Element Directly In Free Slot */
+    else
+    {
+        std::construct_at(Slot,std::forward<Arguments_Type>(Arguments)...);
+        m_Current_Size++;
+    }
+    /* Increment Tail New Posion "Care About OverFlow" */
+    m_Tail_Index=Index::Next(m_Tail_Index);
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Push(1,m_Current_Size,TOTAL_SIZE);}
+    return *Slot;
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - The element removed from the buffer.
+* Notes            : - Moves the element out, Type needs no default constructor.
+*                    - Throws a runtime error if the buffer is empty, Unchecked skips the check.
+*                    - Prefer Try_Pop when polling, an empty buffer is not exceptional there.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Type Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Pop(void)
+{
+    /* Buffer Is Empty "Caller Guarantees Elements When Unchecked" */
+    if constexpr(POLICY!=Overflow_Policy::Unchecked)
+    {
+        if(Is_Empty()){throw std::runtime_error("Buffer Is Empty !");}
+    }
+    /* Return Data From Head */
+    Type *Slot{Data()+Index::Slot(m_Head_Index)};
+    Type Return_Data{std::move(*Slot)};
+    std::destroy_at(Slot);
+    /* Update Current Size */
+    m_Current_Size--;
+    /* Update Next Head */
+    m_Head_Index=Index::Next(m_Head_Index);
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Pop(1,m_Current_Size,TOTAL_SIZE);}
+    /* Return Data */
+    return Return_Data;
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves the element at the head of the circular buffer out.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer by move assignment.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : Never throws on an empty buffer "Polling Friendly".
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Pop(Type& Element)
+{
+    /* Buffer Is Empty */
+    if(Is_Empty()){return false;}
+    /* Move Data Out Of Head */
+    Type *Slot{Data()+Index::Slot(m_Head_Index)};
+    Element=std::move(*Slot);
+    std::destroy_at(Slot);
+    /* Update Current Size */
+    m_Current_Size--;
+    /* Update Next Head */
+    m_Head_Index=Index::Next(m_Head_Index);
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Pop(1,m_Current_Size,TOTAL_SIZE);}
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Try_Pop
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer if any.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element removed, empty if the buffer is empty.
+* Notes            : - Never throws on an empty buffer "Polling Friendly".
+*                    - Moves the element out, Type needs no default constructor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+std::optional<Type> Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Try_Pop(void)
+{
+    std::optional<Type> Return_Data{};
+    /* Buffer Is Empty */
+    if(Is_Empty()){return Return_Data;}
+    /* Move Data Out Of Head */
+    Type *Slot{Data()+Index::Slot(m_Head_Index)};
+    Return_Data.emplace(std::move(*Slot));
+    std::destroy_at(Slot);
+    /* Update Current Size */
+    m_Current_Size--;
+    /* Update Next Head */
+    m_Head_Index=Index::Next(m_Head_Index);
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Pop(1,m_Current_Size,TOTAL_SIZE);}
+    return Return_Data;
+}
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a batch of elements into the circular buffer.
+* Parameters (in)  : Elements - Contiguous elements to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements taken from Elements under the overflow policy.
+* Notes            : - Copies in at most two contiguous segments around the wrap point.
+*                    - Uses memcpy when Type is trivially copyable.
+*                    - Overwrite drops the oldest elements on overflow so every element is taken, only
+*                      the last TOTAL_SIZE elements of an oversized batch are actually copied.
+*                    - Reject takes the leading elements that fit in the free space.
+*                    - Unchecked takes every element, the batch must fit in the free space.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+size_t Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Push_N(std::span<const Type> Elements)
+{
+    const size_t Total_Elements{Elements.size()};
+    /* Refuse Elements That Do Not Fit In Free Space */
+    if constexpr(POLICY==Overflow_Policy::Reject)
+    {
+        Elements=Elements.first(std::min(Total_Elements,TOTAL_SIZE-m_Current_Size));
+        if constexpr(STATISTICS::ENABLED){if(Elements.size()<Total_Elements){m_Statistics.Record_Drop(Total_Elements-Elements.size());}}
+    }
+    else if constexpr(POLICY==Overflow_Policy::Overwrite)
+    {
+        /* Drop Oldest Elements The Batch Overwrites "Care About Head Overflow" */
+        if(m_Current_Size+Total_Elements>TOTAL_SIZE)
+        {
+            const size_t Overwritten{std::min(m_Current_Size,m_Current_Size+Total_Elements-TOTAL_SIZE)};
+            Destroy_Elements(m_Head_Index,Overwritten);
+            m_Head_Index=Index::Advance(m_Head_Index,Overwritten);
+            m_Current_Size-=Overwritten;
+            if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Overwrite(Overwritten);}
+        }
+        /* Elements That Would Be Overwritten In The Same Batch Are Skipped */
+        if(Total_Elements>TOTAL_SIZE)
+        {
+            m_Tail_Index=Index::Advance(m_Tail_Index,Total_Elements-TOTAL_SIZE);
+            m_Head_Index=m_Tail_Index;
+            Elements=Elements.last(TOTAL_SIZE);
+            if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Overwrite(Total_Elements-TOTAL_SIZE);}
+        }
+    }
+    /* Copy First Segment Up To Wrap Point Then The Rest From Start */
+    const size_t Tail_Slot{Index::Slot(m_Tail_Index)};
+    const size_t First_Segment{std::min(Elements.size(),TOTAL_SIZE-Tail_Slot)};
+    Construct_Elements(Data()+Tail_Slot,Elements.data(),First_Segment);
+    Construct_Elements(Data(),Elements.data()+First_Segment,Elements.size()-First_Segment);
+    m_Tail_Index=Index::Advance(m_Tail_Index,Elements.size());
+    m_Current_Size+=Elements.size();
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Push((POLICY==Overflow_Policy::Reject)?Elements.size():Total_Elements,m_Current_Size,TOTAL_SIZE);}
+    return (POLICY==Overflow_Policy::Reject)?Elements.size():Total_Elements;
+}
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes a batch of elements from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the removed elements in order.
+* Return value     : size_t - Number of elements removed "Smaller Of Size And Elements Size".
+* Notes            : - Copies out in at most two contiguous segments around the wrap point.
+*                    - Uses memcpy when Type is trivially copyable.
+*                    - Never throws, an empty buffer simply returns zero.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+size_t Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Pop_N(std::span<Type> Elements)
+{
+    const size_t Total_Elements{std::min(Elements.size(),m_Current_Size)};
+    /* Copy First Segment Up To Wrap Point Then The Rest From Start */
+    const size_t Head_Slot{Index::Slot(m_Head_Index)};
+    const size_t First_Segment{std::min(Total_Elements,TOTAL_SIZE-Head_Slot)};
+    Move_Out_Elements(Elements.data(),Data()+Head_Slot,First_Segment);
+    Move_Out_Elements(Elements.data()+First_Segment,Data(),Total_Elements-First_Segment);
+    /* Update Next Head And Current Size */
+    m_Head_Index=Index::Advance(m_Head_Index,Total_Elements);
+    m_Current_Size-=Total_Elements;
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Pop(Total_Elements,m_Current_Size,TOTAL_SIZE);}
+    return Total_Elements;
+}
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the occupied region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first, second span is empty unless the
+*                    occupied region wraps around the end of the storage.
+* Notes            : - Zero copy, the spans point straight into the buffer storage.
+*                    - Views stay valid until the next operation that moves the head or overwrites.
+*                    - Call Commit_Read once the consumed elements are no longer needed.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Readable_Regions Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Readable_Spans(void)const
+{
+    const size_t Head_Slot{Index::Slot(m_Head_Index)};
+    const size_t First_Segment{std::min(m_Current_Size,TOTAL_SIZE-Head_Slot)};
+    return Readable_Regions{std::span<const Type>(Data()+Head_Slot,First_Segment),
+                            std::span<const Type>(Data(),m_Current_Size-First_Segment)};
+}
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the free region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order, second span is empty unless the
+*                    free region wraps around the end of the storage.
+* Notes            : - Zero copy, data written into the spans becomes visible after Commit_Write.
+*                    - Never exposes occupied slots so it cannot overwrite unread elements.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Writable_Regions Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Writable_Spans(void)requires std::is_trivially_copyable_v<Type>
+{
+    const size_t Free_Slots{TOTAL_SIZE-m_Current_Size};
+    const size_t Tail_Slot{Index::Slot(m_Tail_Index)};
+    const size_t First_Segment{std::min(Free_Slots,TOTAL_SIZE-Tail_Slot)};
+    return Writable_Regions{std::span<Type>(Data()+Tail_Slot,First_Segment),
+                            std::span<Type>(Data(),Free_Slots-First_Segment)};
+}
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases elements consumed through Readable_Spans.
+* Parameters (in)  : Count - Number of elements consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the current size, Unchecked skips
+*                    the check.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+void Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Commit_Read(size_t Count)
+{
+    if((POLICY==Overflow_Policy::Unchecked)||(Count<=m_Current_Size))
+    {
+        /* Consumed Elements Leave The Buffer */
+        Destroy_Elements(m_Head_Index,Count);
+        /* Update Next Head And Current Size */
+        m_Head_Index=Index::Advance(m_Head_Index,Count);
+        m_Current_Size-=Count;
+        if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Pop(Count,m_Current_Size,TOTAL_SIZE);}
+    }
+    else{throw std::runtime_error("Commit Read Out Of Range");}
+}
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes elements written through Writable_Spans.
+* Parameters (in)  : Count - Number of elements written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the free space, Unchecked skips
+*                      the check.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+void Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Commit_Write(size_t Count)requires std::is_trivially_copyable_v<Type>
+{
+    if((POLICY==Overflow_Policy::Unchecked)||(Count<=TOTAL_SIZE-m_Current_Size))
+    {
+        /* Update Next Tail And Current Size */
+        m_Tail_Index=Index::Advance(m_Tail_Index,Count);
+        m_Current_Size+=Count;
+        if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Push(Count,m_Current_Size,TOTAL_SIZE);}
+    }
+    else{throw std::runtime_error("Commit Write Out Of Range");}
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current size of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+size_t Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Size(void)
+{
+    return m_Current_Size;
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Is_Empty(void)
+{
+    return m_Current_Size==0;
+}
+/****************************************************************************************************
+* Function Name    : Statistics
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the counters kept by the statistics policy.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Buffer_Statistics - Pushes, pops, overwrites, drops, high water mark and time
+*                    spent full since the buffer was created.
+* Notes            : - Only exists when STATISTICS is enabled, No_Statistics keeps no counters.
+*                    - May be called from a monitoring thread while the owner keeps working.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Buffer_Statistics Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Statistics(void)const requires STATISTICS::ENABLED
+{
+    return m_Statistics.Snapshot();
+}
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::begin() noexcept
+{
+    return iterator(Data(),m_Head_Index,0);
+}
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::end() noexcept
+{
+    return iterator(Data(),m_Head_Index,static_cast<std::ptrdiff_t>(m_Current_Size));
+}
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::begin()const noexcept
+{
+    return const_iterator(Data(),m_Head_Index,0);
+}
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::end()const noexcept
+{
+    return const_iterator(Data(),m_Head_Index,static_cast<std::ptrdiff_t>(m_Current_Size));
+}
+/****************************************************************************************************
+* Function Name    : cbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::cbegin()const noexcept
+{
+    return begin();
+}
+/****************************************************************************************************
+* Function Name    : cend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::cend()const noexcept
+{
+    return end();
+}
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::reverse_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::rbegin() noexcept
+{
+    return reverse_iterator(end());
+}
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::reverse_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::rend() noexcept
+{
+    return reverse_iterator(begin());
+}
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_reverse_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::rbegin()const noexcept
+{
+    return const_reverse_iterator(end());
+}
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_reverse_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::rend()const noexcept
+{
+    return const_reverse_iterator(begin());
+}
+/****************************************************************************************************
+* Function Name    : crbegin
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_reverse_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::crbegin()const noexcept
+{
+    return rbegin();
+}
+/****************************************************************************************************
+* Function Name    : crend
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+constexpr typename Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::const_reverse_iterator Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::crend()const noexcept
+{
+    return rend();
+}
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::At(size_t Offset)
+{
+    /* Only Live Elements Can Be Reached */
+    if(Offset>=m_Current_Size){throw std::runtime_error("Buffer Index Out Of Range");}
+    return Data()[Index::Slot(Index::Advance(m_Head_Index,Offset))];
+}
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+const Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::At(size_t Offset)const
+{
+    /* Only Live Elements Can Be Reached */
+    if(Offset>=m_Current_Size){throw std::runtime_error("Buffer Index Out Of Range");}
+    return Data()[Index::Slot(Index::Advance(m_Head_Index,Offset))];
+}
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::operator[](size_t Offset)
+{
+    return Data()[Index::Slot(Index::Advance(m_Head_Index,Offset))];
+}
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+const Type& Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::operator[](size_t Offset)const
+{
+    return Data()[Index::Slot(Index::Advance(m_Head_Index,Offset))];
+}
+/****************************************************************************************************
+* Function Name    : Data
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the storage viewed as an array of Type.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type* - First slot of the storage.
+* Notes            : Only slots between head and tail hold live elements.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+Type* Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Data(void)
+{
+    return std::launder(reinterpret_cast<Type*>(m_Data));
+}
+/****************************************************************************************************
+* Function Name    : Data
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the storage viewed as an array of Type.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type* - First slot of the storage.
+* Notes            : Only slots between head and tail hold live elements.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+const Type* Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Data(void)const
+{
+    return std::launder(reinterpret_cast<const Type*>(m_Data));
+}
+/****************************************************************************************************
+* Function Name    : Store
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Copies or moves an element into the tail slot.
+* Parameters (in)  : Element - The element to be stored, forwarded as given.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if a full Reject buffer refused it.
+* Notes            : - Constructs into a free slot, assigns over the oldest element on overflow.
+*                    - Adjusts the head and tail indices if necessary to handle overflow.
+*                    - Full check is compiled out under Unchecked.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+template <typename Element_Type>
+bool Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Store(Element_Type&& Element)
+{
+    Type *Slot{Data()+Index::Slot(m_Tail_Index)};
+    /* Buffer Full "Caller Guarantees Free Slot When Unchecked" */
+    if constexpr(POLICY!=Overflow_Policy::Unchecked)
+    {
+        if(m_Current_Size==TOTAL_SIZE)
+        {
+            /* Refuse New Element "Buffer And Element Stay Untouched" */
+            if constexpr(POLICY==Overflow_Policy::Reject)
+            {
+                if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Drop(1);}
+                return false;
+            }
+            /* Oldest Element Lives In Tail Slot, Assign Over It And Move Head */
+            else
+            {
+                *Slot=std::forward<Element_Type>(Element);
+                m_Head_Index=Index::Next(m_Head_Index);
+                m_Tail_Index=Index::Next(m_Tail_Index);
+                if constexpr(STATISTICS::ENABLED)
+                {
+                    m_Statistics.Record_Overwrite(1);
+                    m_Statistics.Record_Push(1,m_Current_Size,TOTAL_SIZE);
+                }
+                return true;
+            }
+        }
+    }
+    /* Appned New Element Into Free Slot */
+    std::construct_at(Slot,std::forward<Element_Type>(Element));
+    m_Current_Size++;
+    /* Increment Tail New Posion "Care About OverFlow" */
+    m_Tail_Index=Index::Next(m_Tail_Index);
+    if constexpr(STATISTICS::ENABLED){m_Statistics.Record_Push(1,m_Current_Size,TOTAL_SIZE);}
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Destroy_Elements
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Destroys a run of live elements starting at a position.
+* Parameters (in)  : Position - Position of the first element to destroy.
+*                    Count    - Number of elements to destroy "Not Larger Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Does nothing for trivially destructible types.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+void Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Destroy_Elements(size_t Position,size_t Count)
+{
+    if constexpr(!std::is_trivially_destructible_v<Type>)
+    {
+        const size_t First_Slot{Index::Slot(Position)};
+        const size_t First_Segment{std::min(Count,TOTAL_SIZE-First_Slot)};
+        std::destroy_n(Data()+First_Slot,First_Segment);
+        std::destroy_n(Data(),Count-First_Segment);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Construct_Elements
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Copy constructs a contiguous run of elements into free slots.
+* Parameters (in)  : Source      - First element to copy from.
+*                    Count       - Number of elements to copy.
+* Parameters (out) : Destination - First free slot to construct in.
+* Return value     : None
+* Notes            : Uses memcpy when Type is trivially copyable.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+void Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Construct_Elements(Type* Destination,const Type* Source,size_t Count)
+{
+    if constexpr(std::is_trivially_copyable_v<Type>)
+    {
+        if(Count){std::memcpy(Destination,Source,Count*sizeof(Type));}
+    }
+    else{std::uninitialized_copy_n(Source,Count,Destination);}
+}
+/****************************************************************************************************
+* Function Name    : Move_Out_Elements
+* Class            : Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Moves a contiguous run of live elements out and destroys them.
+* Parameters (in)  : Source      - First live element to move from.
+*                    Count       - Number of elements to move.
+* Parameters (out) : Destination - First element to move assign to.
+* Return value     : None
+* Notes            : Uses memcpy when Type is trivially copyable.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Overflow_Policy POLICY, typename STATISTICS>
+void Circular_Buffer<Type, TOTAL_SIZE, POLICY, STATISTICS>::Move_Out_Elements(Type* Destination,Type* Source,size_t Count)
+{
+    if constexpr(std::is_trivially_copyable_v<Type>)
+    {
+        if(Count){std::memcpy(Destination,Source,Count*sizeof(Type));}
+    }
+    else
+    {
+        std::move(Source,Source+Count,Destination);
+        std::destroy_n(Source,Count);
+    }
+}
+/*****************************************
+-------    SPSC_Circular_Buffer     ------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=10>
+class alignas(CACHE_LINE_SIZE) SPSC_Circular_Buffer
+{
+public:
+/****************************************************************************************************
+* Constructor Name : SPSC_Circular_Buffer
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the SPSC_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes both indices to zero "Empty Buffer".
+*****************************************************************************************************/
+SPSC_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : ~SPSC_Circular_Buffer (Destructor)
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys the elements still held in the buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : No producer or consumer may be active, free slots were never constructed.
+*****************************************************************************************************/
+~SPSC_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the circular buffer "Producer Side Only".
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Must be called from a single producer thread.
+*                    - Never overwrites the oldest element, the head index belongs to the consumer.
+*****************************************************************************************************/
+bool Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves a new element into the circular buffer "Producer Side Only".
+* Parameters (in)  : Element - The element to be moved into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Must be called from a single producer thread.
+*                    - Element is left untouched when the buffer is full.
+*****************************************************************************************************/
+bool Push(Type&& Element);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - The element removed from the buffer.
+* Notes            : - Must be called from a single consumer thread.
+*                    - Throws a runtime error if the buffer is empty.
+*                    - Moves the element out, Type needs no default constructor.
+*****************************************************************************************************/
+Type Pop(void);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element from the head of the circular buffer without throwing.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : - Must be called from a single consumer thread "Polling Friendly".
+*                    - Moves the element out, the slot keeps no copy of it.
+*****************************************************************************************************/
+bool Pop(Type& Element);
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current size of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : Computed from both indices, the value is a snapshot when called concurrently.
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : Computed from both indices, the value is a snapshot when called concurrently.
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Next_Index
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the index following the given one inside the storage array.
+* Parameters (in)  : Index - Current index in the storage array.
+* Parameters (out) : None
+* Return value     : size_t - Next index "Care About Overflow".
+* Notes            : Uses a branch instead of modulo, the storage holds one extra slot.
+*****************************************************************************************************/
+static constexpr size_t Next_Index(size_t Index);
+/****************************************************************************************************
+* Function Name    : Store
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Constructs an element in the tail slot and publishes it.
+* Parameters (in)  : Element - The element to be copied or moved into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : Shared by the copy and move overloads of Push.
+*****************************************************************************************************/
+template <typename Element_Type>
+bool Store(Element_Type&& Element);
+/****************************************************************************************************
+* Function Name    : Claim_Head
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the head element if the producer published one.
+* Parameters (in)  : None
+* Parameters (out) : Head_Index - Index of the head slot.
+* Return value     : Type* - Head element, nullptr if the buffer is empty.
+* Notes            : Caller moves the element out, destroys it, then releases the slot.
+*****************************************************************************************************/
+Type* Claim_Head(size_t& Head_Index);
+/****************************************************************************************************
+* Function Name    : Data
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the storage viewed as an array of Type.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type* - First slot of the storage.
+* Notes            : Only slots between head and tail hold live elements.
+*****************************************************************************************************/
+Type* Data(void);
+private:
+    /* Storage Slots "One Extra Slot To Tell Full From Empty Without Shared Counter" */
+    static constexpr size_t STORAGE_SIZE{TOTAL_SIZE+1};
+    /* Index Of Head To Pop From "Written By Consumer Only" */
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Head_Index{};
+    /* Consumer Local Copy Of Tail Index "Refreshed Only When Buffer Looks Empty" */
+    size_t m_Cached_Tail_Index{};
+    /* Index Of Tail To Push In "Written By Producer Only" */
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Tail_Index{};
+    /* Producer Local Copy Of Head Index "Refreshed Only When Buffer Looks Full" */
+    size_t m_Cached_Head_Index{};
+    /* Raw Storage For Elements "Constructed Only While Live" */
+    alignas(CACHE_LINE_SIZE) alignas(Type) std::byte m_Data[sizeof(Type)*STORAGE_SIZE];
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : SPSC_Circular_Buffer
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the SPSC_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes both indices to zero "Empty Buffer".
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+SPSC_Circular_Buffer<Type, TOTAL_SIZE>::SPSC_Circular_Buffer():
+m_Head_Index{},m_Cached_Tail_Index{},m_Tail_Index{},m_Cached_Head_Index{}
+{}
+/****************************************************************************************************
+* Function Name    : ~SPSC_Circular_Buffer (Destructor)
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys the elements still held in the buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : No producer or consumer may be active, free slots were never constructed.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+SPSC_Circular_Buffer<Type, TOTAL_SIZE>::~SPSC_Circular_Buffer()
+{
+    if constexpr(!std::is_trivially_destructible_v<Type>)
+    {
+        const size_t Tail_Index{m_Tail_Index.load(std::memory_order_relaxed)};
+        for(size_t Index{m_Head_Index.load(std::memory_order_relaxed)};Index!=Tail_Index;Index=Next_Index(Index))
+        {
+            std::destroy_at(Data()+Index);
+        }
+    }
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the circular buffer "Producer Side Only".
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Must be called from a single producer thread.
+*                    - Never overwrites the oldest element, the head index belongs to the consumer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Push(const Type& Element)
+{
+    return Store(Element);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves a new element into the circular buffer "Producer Side Only".
+* Parameters (in)  : Element - The element to be moved into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Must be called from a single producer thread.
+*                    - Element is left untouched when the buffer is full.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Push(Type&& Element)
+{
+    return Store(std::move(Element));
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - The element removed from the buffer.
+* Notes            : - Must be called from a single consumer thread.
+*                    - Throws a runtime error if the buffer is empty.
+*                    - Moves the element out, Type needs no default constructor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+Type SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Pop(void)
+{
+    size_t Head_Index{};
+    Type *Slot{Claim_Head(Head_Index)};
+    /* Buffer Is Empty */
+    if(!Slot){throw std::runtime_error("Buffer Is Empty !");}
+    /* Move Data Out Of Head */
+    Type Return_Data{std::move(*Slot)};
+    std::destroy_at(Slot);
+    /* Release Slot Back To Producer */
+    m_Head_Index.store(Next_Index(Head_Index),std::memory_order_release);
+    return Return_Data;
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the element from the head of the circular buffer without throwing.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : - Must be called from a single consumer thread "Polling Friendly".
+*                    - Moves the element out, the slot keeps no copy of it.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Pop(Type& Element)
+{
+    size_t Head_Index{};
+    Type *Slot{Claim_Head(Head_Index)};
+    if(!Slot){return false;}
+    /* Move Data Out Of Head "Slot Stays Live If Assignment Throws" */
+    Element=std::move(*Slot);
+    std::destroy_at(Slot);
+    /* Release Slot Back To Producer */
+    m_Head_Index.store(Next_Index(Head_Index),std::memory_order_release);
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current size of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : Computed from both indices, the value is a snapshot when called concurrently.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+size_t SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Size(void)const
+{
+    const size_t Head_Index{m_Head_Index.load(std::memory_order_acquire)};
+    const size_t Tail_Index{m_Tail_Index.load(std::memory_order_acquire)};
+    return (Tail_Index>=Head_Index)?(Tail_Index-Head_Index):(STORAGE_SIZE-Head_Index+Tail_Index);
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : Computed from both indices, the value is a snapshot when called concurrently.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Is_Empty(void)const
+{
+    return m_Head_Index.load(std::memory_order_acquire)==m_Tail_Index.load(std::memory_order_acquire);
+}
+/****************************************************************************************************
+* Function Name    : Next_Index
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the index following the given one inside the storage array.
+* Parameters (in)  : Index - Current index in the storage array.
+* Parameters (out) : None
+* Return value     : size_t - Next index "Care About Overflow".
+* Notes            : Uses a branch instead of modulo, the storage holds one extra slot.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+constexpr size_t SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Next_Index(size_t Index)
+{
+    return (Index+1==STORAGE_SIZE)?0:(Index+1);
+}
+/****************************************************************************************************
+* Function Name    : Store
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Constructs an element in the tail slot and publishes it.
+* Parameters (in)  : Element - The element to be copied or moved into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : Shared by the copy and move overloads of Push.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+template <typename Element_Type>
+bool SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Store(Element_Type&& Element)
+{
+    /* Only Producer Writes Tail So Relaxed Load Is Enough */
+    const size_t Tail_Index{m_Tail_Index.load(std::memory_order_relaxed)};
+    const size_t Next_Tail{Next_Index(Tail_Index)};
+    /* Buffer Looks Full "Refresh Cached Head From Consumer" */
+    if(Next_Tail==m_Cached_Head_Index)
+    {
+        m_Cached_Head_Index=m_Head_Index.load(std::memory_order_acquire);
+        if(Next_Tail==m_Cached_Head_Index){return false;}
+    }
+    /* Appned New Element "Nothing Is Published If Construction Throws" */
+    std::construct_at(Data()+Tail_Index,std::forward<Element_Type>(Element));
+    /* Publish Element To Consumer */
+    m_Tail_Index.store(Next_Tail,std::memory_order_release);
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Claim_Head
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the head element if the producer published one.
+* Parameters (in)  : None
+* Parameters (out) : Head_Index - Index of the head slot.
+* Return value     : Type* - Head element, nullptr if the buffer is empty.
+* Notes            : Caller moves the element out, destroys it, then releases the slot.
 *****************************************************************************************************/
-constexpr bool operator==(const Buffer_Iterator& Object);
+template <typename Type, size_t TOTAL_SIZE>
+Type* SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Claim_Head(size_t& Head_Index)
+{
+    /* Only Consumer Writes Head So Relaxed Load Is Enough */
+    Head_Index=m_Head_Index.load(std::memory_order_relaxed);
+    /* Buffer Looks Empty "Refresh Cached Tail From Producer" */
+    if(Head_Index==m_Cached_Tail_Index)
+    {
+        m_Cached_Tail_Index=m_Tail_Index.load(std::memory_order_acquire);
+        if(Head_Index==m_Cached_Tail_Index){return nullptr;}
+    }
+    return Data()+Head_Index;
+}
 /****************************************************************************************************
-* Function Name     : operator++
-* Type              : Public
-* Class             : Buffer_Iterator
-* Namespace         : Data_Structure::Circular_Buffer
-* Description       : Pre-increment operator for Buffer_Iterator objects.
-* Parameters (in)   : None
-* Parameters (out)  : None
-* Return value      : Buffer_Iterator - The iterator after being incremented.
-* Notes             : Increments the current index and the total elements in the iterator.
+* Function Name    : Data
+* Class            : SPSC_Circular_Buffer<Type, TOTAL_SIZE>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the storage viewed as an array of Type.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type* - First slot of the storage.
+* Notes            : Only slots between head and tail hold live elements.
 *****************************************************************************************************/
-constexpr Buffer_Iterator operator++();
+template <typename Type, size_t TOTAL_SIZE>
+Type* SPSC_Circular_Buffer<Type, TOTAL_SIZE>::Data(void)
+{
+    return std::launder(reinterpret_cast<Type*>(m_Data));
+}
+/*****************************************
+-------    MPMC_Circular_Buffer     ------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=10>
+class alignas(CACHE_LINE_SIZE) MPMC_Circular_Buffer
+{
+/* With One Slot A Published Element "Sequence Position+1" And The Free Slot Of The Next Lap "Position+TOTAL_SIZE" Carry The Same Stamp */
+static_assert(TOTAL_SIZE>1,"MPMC_Circular_Buffer Size Must Be Greater Than One \"Full And Free Slot Laps Would Look The Same\"");
+/* A Claimed Slot Whose Sequence Is Never Advanced Wedges Every Later Lap, So Nothing May Throw While One Is Held */
+static_assert(std::is_nothrow_move_constructible_v<Type>&&std::is_nothrow_destructible_v<Type>,"MPMC_Circular_Buffer Type Must Be Nothrow Move Constructible And Destructible");
 private:
-    /* Current Index Of Iterator */
-    size_t m_Current_Index{};
-    /* Total Elements Iterator Already Count */
-    size_t m_Total_Elements{};
-    /* Array Base Containing ELements */
-    pointer m_Buffer{};
+/*****************************************
+-------------    Buffer_Slot    ----------
+*****************************************/
+struct Buffer_Slot
+{
+    /* Element Living In Raw Storage Of Slot */
+    Type* Data(void){return std::launder(reinterpret_cast<Type*>(m_Storage));}
+    /* Lap Counter Telling Which Side Owns The Slot */
+    std::atomic<size_t> m_Sequence{};
+    /* Raw Storage For Element "Constructed Only While Published" */
+    alignas(Type) std::byte m_Storage[sizeof(Type)];
 };
 public:
 /****************************************************************************************************
-* Constructor Name : Circular_Buffer (Initializer List)
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Constructor Name : MPMC_Circular_Buffer
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Constructor for the Circular_Buffer class that initializes the buffer with elements
-*                    from an initializer list.
-* Parameters (in)  : Values - An initializer list of elements to initialize the buffer.
+* Description      : Default constructor for the MPMC_Circular_Buffer class.
+* Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : None
-* Notes            : Initializes member variables and pushes elements from the initializer list into
-*                    the buffer. Throws a runtime error if the size of the initializer list exceeds
-*                    the total size of the buffer.
+* Notes            : Stamps every slot with its own index so the first lap is owned by producers.
 *****************************************************************************************************/
-Circular_Buffer(const std::initializer_list<Type>& Values);
+MPMC_Circular_Buffer();
 /****************************************************************************************************
-* Constructor Name : Circular_Buffer
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : ~MPMC_Circular_Buffer (Destructor)
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Default constructor for the Circular_Buffer class.
+* Description      : Destroys the elements still published in the buffer.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : None
-* Notes            : Initializes member variables to their default values.
+* Notes            : No producer or consumer may be active, free slots were never constructed.
 *****************************************************************************************************/
-Circular_Buffer();
+~MPMC_Circular_Buffer();
 /****************************************************************************************************
-* Function Name    : ~Circular_Buffer (Destructor)
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Try_Push
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Destructor for the Circular_Buffer class.
-* Parameters (in)  : None
+* Description      : Pushes a new element into the circular buffer if a slot is free.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
 * Parameters (out) : None
-* Return value     : None
-* Notes            : Does not perform any specific cleanup as the buffer does not allocate dynamic
-*                    memory.
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Safe to call from any number of producer threads.
+*                    - Claims the slot with a single CAS on the tail position, never blocks.
+*                    - A copy that may throw is made before the slot is claimed, so a throwing
+*                      copy leaves the buffer untouched.
 *****************************************************************************************************/
-~Circular_Buffer();
+bool Try_Push(const Type& Element);
 /****************************************************************************************************
-* Function Name    : operator==
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Try_Push
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Overloaded equality operator for Circular_Buffer.
-* Parameters (in)  : Array - An array to compare with the Circular_Buffer data.
+* Description      : Moves a new element into the circular buffer if a slot is free.
+* Parameters (in)  : Element - The element to be moved into the buffer.
 * Parameters (out) : None
-* Return value     : bool - True if the arrays are equal, false otherwise.
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Safe to call from any number of producer threads.
+*                    - Element is left untouched when the buffer is full.
 *****************************************************************************************************/
-bool operator ==(std::array<Type,TOTAL_SIZE> Array)const;
+bool Try_Push(Type&& Element);
 /****************************************************************************************************
-* Function Name    : operator==
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
-* Type             : Public
+* Function Name    : Try_Pop
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
-* Description      : Overloaded equality operator for comparing two circular buffers.
-* Parameters (in)  : Object - The circular buffer to compare with.
-* Parameters (out) : None
-* Return value     : bool - True if the circular buffers are equal, false otherwise.
-* Notes            : None
+* Type             : Public
+* Description      : Removes the element from the head of the circular buffer if one is ready.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : - Safe to call from any number of consumer threads.
+*                    - Claims the slot with a single CAS on the head position, never blocks.
+*                    - Moves the element out, the slot keeps no copy of it.
 *****************************************************************************************************/
-bool operator==(const Circular_Buffer& Object)const;
+bool Try_Pop(Type& Element);
 /****************************************************************************************************
-* Function Name    : Head
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Try_Pop
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Returns a reference to the element at the head of the circular buffer.
+* Description      : Removes and returns the element at the head of the buffer if one is ready.
 * Parameters (in)  : None
 * Parameters (out) : None
-* Return value     : const Type& - Reference to the element at the head of the buffer.
-* Notes            : None
+* Return value     : std::optional<Type> - The element removed, empty if the buffer is empty.
+* Notes            : - Safe to call from any number of consumer threads.
+*                    - Moves the element out, Type needs no default constructor.
 *****************************************************************************************************/
-const Type& Head(void)const;
+std::optional<Type> Try_Pop(void);
 /****************************************************************************************************
-* Function Name    : Tail
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Push
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Returns a reference to the element at the tail of the circular buffer.
-* Parameters (in)  : None
+* Description      : Pushes a new element into the circular buffer, waiting for a free slot.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
 * Parameters (out) : None
-* Return value     : const Type& - Reference to the element at the tail of the buffer.
-* Notes            : None
+* Return value     : None
+* Notes            : Yields the thread between retries while the buffer is full.
 *****************************************************************************************************/
-const Type& Tail(void)const;
+void Push(const Type& Element);
 /****************************************************************************************************
 * Function Name    : Push
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Pushes a new element into the circular buffer.
-* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Description      : Moves a new element into the circular buffer, waiting for a free slot.
+* Parameters (in)  : Element - The element to be moved into the buffer.
 * Parameters (out) : None
 * Return value     : None
-* Notes            : - Appends the new element to the buffer.
-*                    - Adjusts the head and tail indices if necessary to handle overflow.
+* Notes            : Yields the thread between retries while the buffer is full.
 *****************************************************************************************************/
-void Push(const Type& Element);
+void Push(Type&& Element);
 /****************************************************************************************************
 * Function Name    : Pop
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Removes and returns the element from the head of the circular buffer.
+* Description      : Removes and returns the element from the head, waiting for one to be ready.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : Type - The element removed from the buffer.
-* Notes            : - Returns a default zero-initialized value if the buffer is empty.
-*                    - Throws a runtime error if the buffer is empty.
+* Notes            : - Yields the thread between retries while the buffer is empty.
+*                    - Moves the element out, Type needs no default constructor.
 *****************************************************************************************************/
 Type Pop(void);
 /****************************************************************************************************
 * Function Name    : Size
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Type             : Public
 * Namespace        : Data_Structure
 * Description      : Returns the current size of the circular buffer.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : size_t - The current size of the buffer.
-* Notes            : None
+* Notes            : Approximate while producers or consumers are active.
 *****************************************************************************************************/
-size_t Size(void);
+size_t Size(void)const;
 /****************************************************************************************************
 * Function Name    : Is_Empty
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Type             : Public
 * Namespace        : Data_Structure
 * Description      : Checks if the circular buffer is empty.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : bool - True if the buffer is empty, false otherwise.
-* Notes            : None
+* Notes            : Approximate while producers or consumers are active.
 *****************************************************************************************************/
-bool Is_Empty(void);
+bool Is_Empty(void)const;
+private:
 /****************************************************************************************************
-* Function Name    : end
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
-* Type             : Public
+* Function Name    : Store
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
-* Description      : Returns a constant iterator pointing to the end of the circular buffer.
-* Parameters (in)  : None
+* Type             : Private
+* Description      : Claims the tail slot and constructs an element in it.
+* Parameters (in)  : Element - The element to be copied or moved into the buffer.
 * Parameters (out) : None
-* Return value     : constexpr Buffer_Iterator - Constant iterator pointing to the end of the buffer.
-* Notes            : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Shared by the copy and move overloads of Try_Push.
+*                    - Constructs the element in the raw storage of the slot.
 *****************************************************************************************************/
-constexpr Buffer_Iterator end() noexcept;
+template <typename Element_Type>
+bool Store(Element_Type&& Element);
 /****************************************************************************************************
-* Function Name    : begin
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
-* Type             : Public
+* Function Name    : Claim_Head
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
-* Description      : Returns a constant iterator pointing to the beginning of the circular buffer.
+* Type             : Private
+* Description      : Claims the head slot if an element is published in it.
 * Parameters (in)  : None
-* Parameters (out) : None
-* Return value     : constexpr Buffer_Iterator - Constant iterator pointing to the beginning of the buffer.
-* Notes            : None
+* Parameters (out) : Position - Position of the claimed slot.
+* Return value     : Buffer_Slot* - Claimed slot, nullptr if the buffer is empty.
+* Notes            : Caller moves the element out, destroys it, then hands the slot to the next lap.
 *****************************************************************************************************/
-constexpr Buffer_Iterator begin() noexcept;
+Buffer_Slot* Claim_Head(size_t& Position);
 private:
-    /* Total Size Of Current Elements In Buffer */
-    size_t m_Current_Size{};
-    /* Index Of Head To Pop From*/
-    size_t m_Head_Index{};
-    /* Index Of Tain To Push In */
-    size_t m_Tail_Index{};
-    /* Data Structure Storing Elements */
-    std::array<Type,TOTAL_SIZE> m_Data{};
+    /* Position Of Next Slot To Pop From "Shared By Consumers" */
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Head_Position{};
+    /* Position Of Next Slot To Push In "Shared By Producers" */
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Tail_Position{};
+    /* Data Structure Storing Sequenced Elements */
+    alignas(CACHE_LINE_SIZE) std::array<Buffer_Slot,TOTAL_SIZE> m_Data{};
 };
 /****************************************************************************************************
 -----------------------------------------    Definition     -----------------------------------------
 ****************************************************************************************************/
-/*****************************************
----------    Buffer_Iterator     ---------
-*****************************************/
-/****************************************************************************************************
-* Constructor       : Buffer_Iterator
-* Type              : Public
-* Class             : Buffer_Iterator
-* Namespace         : Data_Structure::Circular_Buffer
-* Description       : Constructs a Buffer_Iterator object.
-* Parameters (in)   : 
-*   - Buffer        : Pointer to the buffer "Data Array".
-*   - Current_Index : Current index of the iterator to start from.
-*   - Total_Elements: Total elements in the buffer should I iterate through.
-* Notes             : None
-*****************************************************************************************************/
-template <typename Type, size_t TOTAL_SIZE>
-constexpr Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator::Buffer_Iterator(typename Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator::pointer Buffer,size_t Current_Index,size_t Total_Elements):
-m_Buffer(Buffer),m_Total_Elements(Total_Elements),m_Current_Index(Current_Index)
-{}
-/****************************************************************************************************
-* Function Name     : operator*
-* Type              : Public
-* Class             : Buffer_Iterator
-* Namespace         : Data_Structure::Circular_Buffer
-* Description       : Dereferences the iterator, returning a reference to the current element.
-* Parameters (in)   : None
-* Parameters (out)  : None
-* Return value      : reference - Reference to the current element in the buffer.
-* Notes             : None
-*****************************************************************************************************/
-template <typename Type, size_t TOTAL_SIZE>
-constexpr typename Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator::reference Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator::operator*()
-{
-    return m_Buffer[m_Current_Index];
-}
-/****************************************************************************************************
-* Function Name     : operator!=
-* Type              : Public
-* Class             : Buffer_Iterator
-* Namespace         : Data_Structure::Circular_Buffer
-* Description       : Inequality comparison operator for Buffer_Iterator objects.
-* Parameters (in)   : 
-*   - Object        : Another Buffer_Iterator object to compare with.
-* Parameters (out)  : None
-* Return value      : bool - True if the iterators are unequal, false otherwise.
-* Notes             : Returns true if the iterators have different current indices or total elements.
-*****************************************************************************************************/
-template <typename Type, size_t TOTAL_SIZE>
-constexpr bool Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator::operator!=(const Buffer_Iterator& Object)
-{
-    /* If The Iterator Looped On All Elements IN The Buffer */
-    return (Object.m_Current_Index!=m_Current_Index)||(m_Total_Elements!=Object.m_Total_Elements);
-}
-/****************************************************************************************************
-* Function Name     : operator==
-* Type              : Public
-* Class             : Buffer_Iterator
-* Namespace         : Data_Structure::Circular_Buffer
-* Description       : Equality comparison operator for Buffer_Iterator objects.
-* Parameters (in)   : 
-*   - Object        : Another Buffer_Iterator object to compare with.
-* Parameters (out)  : None
-* Return value      : bool - True if the iterators are equal, false otherwise.
-* Notes             : None
-*****************************************************************************************************/
-template <typename Type, size_t TOTAL_SIZE>
-constexpr bool Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator::operator==(const Buffer_Iterator& Object)
-{
-    return (Object.m_Current_Index==m_Current_Index)&&(m_Total_Elements==Object.m_Total_Elements);
-}
-/****************************************************************************************************
-* Function Name     : operator++
-* Type              : Public
-* Class             : Buffer_Iterator
-* Namespace         : Data_Structure::Circular_Buffer
-* Description       : Pre-increment operator for Buffer_Iterator objects.
-* Parameters (in)   : None
-* Parameters (out)  : None
-* Return value      : Buffer_Iterator - The iterator after being incremented.
-* Notes             : Increments the current index and the total elements in the iterator.
-*****************************************************************************************************/
-template <typename Type, size_t TOTAL_SIZE>
-constexpr typename Circular_Buffer<Type,TOTAL_SIZE>::Buffer_Iterator Circular_Buffer<Type,TOTAL_SIZE>::Buffer_Iterator::operator++()
-{
-    m_Current_Index=(m_Current_Index+1)%TOTAL_SIZE;
-    return Buffer_Iterator{m_Buffer,m_Current_Index,++m_Total_Elements};
-}
-/*****************************************
----------    Circular_Buffer     ---------
-*****************************************/
 /****************************************************************************************************
-* Constructor Name : Circular_Buffer (Initializer List)
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Constructor Name : MPMC_Circular_Buffer
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Constructor for the Circular_Buffer class that initializes the buffer with elements
-*                    from an initializer list.
-* Parameters (in)  : Values - An initializer list of elements to initialize the buffer.
+* Description      : Default constructor for the MPMC_Circular_Buffer class.
+* Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : None
-* Notes            : Initializes member variables and pushes elements from the initializer list into
-*                    the buffer. Throws a runtime error if the size of the initializer list exceeds
-*                    the total size of the buffer.
+* Notes            : Stamps every slot with its own index so the first lap is owned by producers.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-Circular_Buffer<Type, TOTAL_SIZE>::Circular_Buffer(const std::initializer_list<Type>& Values):
-m_Current_Size{},m_Head_Index{},m_Tail_Index{},m_Data{}
+MPMC_Circular_Buffer<Type, TOTAL_SIZE>::MPMC_Circular_Buffer():
+m_Head_Position{},m_Tail_Position{},m_Data{}
 {
-    /* Check If Initializer Size Is Valid */
-    if(Values.size()<=TOTAL_SIZE)
+    for(size_t Counter{};Counter<TOTAL_SIZE;Counter++)
     {
-        /* Push All Elements In Initializer_List */
-        for(size_t Counter{};Counter<Values.size();Counter++)
-        {
-            Push(Values.begin()[Counter]);
-        }
+        m_Data[Counter].m_Sequence.store(Counter,std::memory_order_relaxed);
     }
-    /* Throw Runtime Exception Invalid Initializer_List Size */
-    else{throw std::runtime_error("Buffer Initializer Out Of Range");}
 }
 /****************************************************************************************************
-* Constructor Name : Circular_Buffer
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : ~MPMC_Circular_Buffer (Destructor)
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Default constructor for the Circular_Buffer class.
+* Description      : Destroys the elements still published in the buffer.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : None
-* Notes            : Initializes member variables to their default values.
+* Notes            : No producer or consumer may be active, free slots were never constructed.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-Circular_Buffer<Type, TOTAL_SIZE>::Circular_Buffer():
-m_Current_Size{},m_Head_Index{},m_Tail_Index{},m_Data{}
-{}
+MPMC_Circular_Buffer<Type, TOTAL_SIZE>::~MPMC_Circular_Buffer()
+{
+    if constexpr(!std::is_trivially_destructible_v<Type>)
+    {
+        const size_t Tail_Position{m_Tail_Position.load(std::memory_order_relaxed)};
+        for(size_t Position{m_Head_Position.load(std::memory_order_relaxed)};Position!=Tail_Position;Position++)
+        {
+            std::destroy_at(m_Data[Position%TOTAL_SIZE].Data());
+        }
+    }
+}
 /****************************************************************************************************
-* Function Name    : ~Circular_Buffer (Destructor)
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Try_Push
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Destructor for the Circular_Buffer class.
-* Parameters (in)  : None
+* Description      : Pushes a new element into the circular buffer if a slot is free.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
 * Parameters (out) : None
-* Return value     : None
-* Notes            : Does not perform any specific cleanup as the buffer does not allocate dynamic
-*                    memory.
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Safe to call from any number of producer threads.
+*                    - Claims the slot with a single CAS on the tail position, never blocks.
+*                    - A copy that may throw is made before the slot is claimed, so a throwing
+*                      copy leaves the buffer untouched.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-Circular_Buffer<Type, TOTAL_SIZE>::~Circular_Buffer()
-{}
+bool MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Try_Push(const Type& Element)
+{
+    if constexpr(std::is_nothrow_copy_constructible_v<Type>){return Store(Element);}
+    else
+    {
+        /* Copy Outside The Claimed Slot, Only The Nothrow Move Happens Inside */
+        Type Copy{Element};
+        return Store(std::move(Copy));
+    }
+}
 /****************************************************************************************************
-* Function Name    : operator==
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Try_Push
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Overloaded equality operator for Circular_Buffer.
-* Parameters (in)  : Array - An array to compare with the Circular_Buffer data.
+* Description      : Moves a new element into the circular buffer if a slot is free.
+* Parameters (in)  : Element - The element to be moved into the buffer.
 * Parameters (out) : None
-* Return value     : bool - True if the arrays are equal, false otherwise.
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Safe to call from any number of producer threads.
+*                    - Element is left untouched when the buffer is full.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-bool Circular_Buffer<Type, TOTAL_SIZE>::operator ==(std::array<Type,TOTAL_SIZE> Array)const
+bool MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Try_Push(Type&& Element)
 {
-    return Array==m_Data;
+    return Store(std::move(Element));
 }
 /****************************************************************************************************
-* Function Name    : operator==
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
-* Type             : Public
+* Function Name    : Try_Pop
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
-* Description      : Overloaded equality operator for comparing two circular buffers.
-* Parameters (in)  : Object - The circular buffer to compare with.
-* Parameters (out) : None
-* Return value     : bool - True if the circular buffers are equal, false otherwise.
-* Notes            : None
+* Type             : Public
+* Description      : Removes the element from the head of the circular buffer if one is ready.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : - Safe to call from any number of consumer threads.
+*                    - Claims the slot with a single CAS on the head position, never blocks.
+*                    - Moves the element out, the slot keeps no copy of it.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-bool Circular_Buffer<Type, TOTAL_SIZE>::operator==(const Circular_Buffer& Object)const
+bool MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Try_Pop(Type& Element)
 {
-    return (Object.m_Data==m_Data)&&(Object.m_Current_Size==m_Current_Size)&&(Object.m_Head_Index==m_Head_Index)&&(Object.m_Tail_Index==m_Tail_Index);
+    size_t Position{};
+    Buffer_Slot* Slot{Claim_Head(Position)};
+    if(!Slot){return false;}
+    /* Move Data Out Before Handing Slot To Producers Of Next Lap */
+    Type Return_Data{std::move(*Slot->Data())};
+    std::destroy_at(Slot->Data());
+    Slot->m_Sequence.store(Position+TOTAL_SIZE,std::memory_order_release);
+    /* Assignment May Throw, Slot Is Already Released By Then */
+    Element=std::move(Return_Data);
+    return true;
 }
 /****************************************************************************************************
-* Function Name    : Head
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Try_Pop
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Returns a reference to the element at the head of the circular buffer.
+* Description      : Removes and returns the element at the head of the buffer if one is ready.
 * Parameters (in)  : None
 * Parameters (out) : None
-* Return value     : const Type& - Reference to the element at the head of the buffer.
-* Notes            : None
+* Return value     : std::optional<Type> - The element removed, empty if the buffer is empty.
+* Notes            : - Safe to call from any number of consumer threads.
+*                    - Moves the element out, Type needs no default constructor.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-const Type& Circular_Buffer<Type, TOTAL_SIZE>::Head(void)const
+std::optional<Type> MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Try_Pop(void)
 {
-    return m_Data[m_Head_Index];
+    std::optional<Type> Return_Data{};
+    size_t Position{};
+    Buffer_Slot* Slot{Claim_Head(Position)};
+    if(!Slot){return Return_Data;}
+    /* Move Data Out Before Handing Slot To Producers Of Next Lap */
+    Return_Data.emplace(std::move(*Slot->Data()));
+    std::destroy_at(Slot->Data());
+    Slot->m_Sequence.store(Position+TOTAL_SIZE,std::memory_order_release);
+    return Return_Data;
 }
 /****************************************************************************************************
-* Function Name    : Tail
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Function Name    : Push
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Returns a reference to the element at the tail of the circular buffer.
-* Parameters (in)  : None
+* Description      : Pushes a new element into the circular buffer, waiting for a free slot.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
 * Parameters (out) : None
-* Return value     : const Type& - Reference to the element at the tail of the buffer.
-* Notes            : None
+* Return value     : None
+* Notes            : Yields the thread between retries while the buffer is full.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-const Type& Circular_Buffer<Type, TOTAL_SIZE>::Tail(void)const
+void MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Push(const Type& Element)
 {
-    return m_Data[m_Tail_Index];
+    while(!Try_Push(Element)){std::this_thread::yield();}
 }
 /****************************************************************************************************
 * Function Name    : Push
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Pushes a new element into the circular buffer.
-* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Description      : Moves a new element into the circular buffer, waiting for a free slot.
+* Parameters (in)  : Element - The element to be moved into the buffer.
 * Parameters (out) : None
 * Return value     : None
-* Notes            : - Appends the new element to the buffer.
-*                    - Adjusts the head and tail indices if necessary to handle overflow.
+* Notes            : Yields the thread between retries while the buffer is full.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-void Circular_Buffer<Type, TOTAL_SIZE>::Push(const Type& Element)
-{
-    /* Appned New Element */
-    m_Data.at(m_Tail_Index)=Element;
-    /* Check If Head Need Move "Care About Head Overflow" */
-    m_Head_Index=(m_Current_Size==TOTAL_SIZE)?((m_Head_Index+1)%TOTAL_SIZE):m_Head_Index;
-    /* Increment Current Size "Care About Overflow" */
-    m_Current_Size=(++m_Current_Size>TOTAL_SIZE)?TOTAL_SIZE:m_Current_Size;
-    /* Increment Tail New Posion "Care About OverFlow" */
-    m_Tail_Index=((m_Tail_Index+1)%TOTAL_SIZE);
+void MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Push(Type&& Element)
+{
+    /* Failed Attempts Leave Element Untouched So It Can Be Moved Again */
+    while(!Try_Push(std::move(Element))){std::this_thread::yield();}
 }
 /****************************************************************************************************
 * Function Name    : Pop
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
 * Type             : Public
-* Description      : Removes and returns the element from the head of the circular buffer.
+* Description      : Removes and returns the element from the head, waiting for one to be ready.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : Type - The element removed from the buffer.
-* Notes            : - Returns a default zero-initialized value if the buffer is empty.
-*                    - Throws a runtime error if the buffer is empty.
+* Notes            : - Yields the thread between retries while the buffer is empty.
+*                    - Moves the element out, Type needs no default constructor.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-Type Circular_Buffer<Type, TOTAL_SIZE>::Pop(void)
+Type MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Pop(void)
 {
-    /* Default Zero Return Data */
-    Type Return_Data{};
-    /* Buffer In Not Embty */
-    if(!Is_Empty())
-    {
-        /* Return Data From Head */
-        Return_Data=m_Data.at(m_Head_Index);
-        /* Update Current Size */
-        m_Current_Size--;
-        /* Update Next Head */
-        m_Head_Index=((m_Head_Index+1)%TOTAL_SIZE);
-    }
-    else{throw std::runtime_error("Buffer Is Empty !");}
-    /* Return Data */
+    size_t Position{};
+    Buffer_Slot* Slot{};
+    while(!(Slot=Claim_Head(Position))){std::this_thread::yield();}
+    Type Return_Data{std::move(*Slot->Data())};
+    std::destroy_at(Slot->Data());
+    Slot->m_Sequence.store(Position+TOTAL_SIZE,std::memory_order_release);
     return Return_Data;
 }
 /****************************************************************************************************
 * Function Name    : Size
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Type             : Public
 * Namespace        : Data_Structure
 * Description      : Returns the current size of the circular buffer.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : size_t - The current size of the buffer.
-* Notes            : None
+* Notes            : Approximate while producers or consumers are active.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-size_t Circular_Buffer<Type, TOTAL_SIZE>::Size(void)
+size_t MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Size(void)const
 {
-    return m_Current_Size;
+    const size_t Head_Position{m_Head_Position.load(std::memory_order_acquire)};
+    const size_t Tail_Position{m_Tail_Position.load(std::memory_order_acquire)};
+    /* Head Snapshot Is Older Than Tail Snapshot "Clamp To Capacity" */
+    const size_t Current_Size{Tail_Position-Head_Position};
+    return (Current_Size>TOTAL_SIZE)?TOTAL_SIZE:Current_Size;
 }
 /****************************************************************************************************
 * Function Name    : Is_Empty
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Type             : Public
 * Namespace        : Data_Structure
 * Description      : Checks if the circular buffer is empty.
 * Parameters (in)  : None
 * Parameters (out) : None
 * Return value     : bool - True if the buffer is empty, false otherwise.
-* Notes            : None
+* Notes            : Approximate while producers or consumers are active.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-bool Circular_Buffer<Type, TOTAL_SIZE>::Is_Empty(void)
+bool MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Is_Empty(void)const
 {
-    return m_Current_Size==0;
+    return Size()==0;
 }
 /****************************************************************************************************
-* Function Name    : end
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
-* Type             : Public
+* Function Name    : Store
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
-* Description      : Returns a constant iterator pointing to the end of the circular buffer.
-* Parameters (in)  : None
+* Type             : Private
+* Description      : Claims the tail slot and constructs an element in it.
+* Parameters (in)  : Element - The element to be copied or moved into the buffer.
 * Parameters (out) : None
-* Return value     : constexpr Buffer_Iterator - Constant iterator pointing to the end of the buffer.
-* Notes            : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : - Shared by the copy and move overloads of Try_Push.
+*                    - Constructs the element in the raw storage of the slot.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-constexpr typename Circular_Buffer<Type,TOTAL_SIZE>::Buffer_Iterator Circular_Buffer<Type,TOTAL_SIZE>::end() noexcept
+template <typename Element_Type>
+bool MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Store(Element_Type&& Element)
 {
-    return Buffer_Iterator(m_Data.begin(),m_Tail_Index,m_Current_Size);
+    size_t Position{m_Tail_Position.load(std::memory_order_relaxed)};
+    while(true)
+    {
+        Buffer_Slot &Slot{m_Data[Position%TOTAL_SIZE]};
+        const size_t Sequence{Slot.m_Sequence.load(std::memory_order_acquire)};
+        const auto Difference{static_cast<std::ptrdiff_t>(Sequence-Position)};
+        /* Slot Free For This Lap "Try To Claim It" */
+        if(Difference==0)
+        {
+            if(m_Tail_Position.compare_exchange_weak(Position,Position+1,std::memory_order_relaxed))
+            {
+                /* Append New Element And Hand Slot To Consumers */
+                std::construct_at(reinterpret_cast<Type*>(Slot.m_Storage),std::forward<Element_Type>(Element));
+                Slot.m_Sequence.store(Position+1,std::memory_order_release);
+                return true;
+            }
+        }
+        /* Slot Still Holds Previous Lap "Buffer Is Full" */
+        else if(Difference<0){return false;}
+        /* Another Producer Claimed It "Reload Position" */
+        else{Position=m_Tail_Position.load(std::memory_order_relaxed);}
+    }
 }
 /****************************************************************************************************
-* Function Name    : begin
-* Class            : Circular_Buffer<Type, TOTAL_SIZE>
-* Type             : Public
+* Function Name    : Claim_Head
+* Class            : MPMC_Circular_Buffer<Type, TOTAL_SIZE>
 * Namespace        : Data_Structure
-* Description      : Returns a constant iterator pointing to the beginning of the circular buffer.
+* Type             : Private
+* Description      : Claims the head slot if an element is published in it.
 * Parameters (in)  : None
-* Parameters (out) : None
-* Return value     : constexpr Buffer_Iterator - Constant iterator pointing to the beginning of the buffer.
-* Notes            : None
+* Parameters (out) : Position - Position of the claimed slot.
+* Return value     : Buffer_Slot* - Claimed slot, nullptr if the buffer is empty.
+* Notes            : Caller moves the element out, destroys it, then hands the slot to the next lap.
 *****************************************************************************************************/
 template <typename Type, size_t TOTAL_SIZE>
-constexpr typename Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Iterator Circular_Buffer<Type, TOTAL_SIZE>::begin() noexcept
+typename MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Buffer_Slot* MPMC_Circular_Buffer<Type, TOTAL_SIZE>::Claim_Head(size_t& Position)
 {
-   return Buffer_Iterator(m_Data.begin(),m_Head_Index,0);
+    Position=m_Head_Position.load(std::memory_order_relaxed);
+    while(true)
+    {
+        Buffer_Slot &Slot{m_Data[Position%TOTAL_SIZE]};
+        const size_t Sequence{Slot.m_Sequence.load(std::memory_order_acquire)};
+        const auto Difference{static_cast<std::ptrdiff_t>(Sequence-(Position+1))};
+        /* Slot Published For This Lap "Try To Claim It" */
+        if(Difference==0)
+        {
+            if(m_Head_Position.compare_exchange_weak(Position,Position+1,std::memory_order_relaxed)){return &Slot;}
+        }
+        /* Slot Not Written Yet "Buffer Is Empty" */
+        else if(Difference<0){return nullptr;}
+        /* Another Consumer Claimed It "Reload Position" */
+        else{Position=m_Head_Position.load(std::memory_order_relaxed);}
+    }
 }
 }
 /********************************************************************
  *  END OF FILE:  Circular_Buffer.hpp
-********************************************************************/
\ No newline at end of file
+********************************************************************/
+#endif
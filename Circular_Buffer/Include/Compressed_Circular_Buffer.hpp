@@ -0,0 +1,505 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Compressed_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Ring of delta of delta varint encoded blocks for long integer telemetry histories
+ *  Class Name:  Compressed_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _COMPRESSED_CIRCULAR_BUFFER_HPP_
+#define _COMPRESSED_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include "Window_Statistics.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Longest Varint, Ten Groups Of Seven Bits Cover 64 Bits */
+inline constexpr size_t MAX_VARINT_BYTES{10};
+/****************************************************************************************************
+* Function Name    : Encode_Varint
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Writes a signed value as a zigzag varint.
+* Parameters (in)  : Value  - Value to encode, small magnitudes of either sign take one byte.
+* Parameters (out) : Output - Receives the encoded bytes.
+* Return value     : size_t - Number of bytes written, 1 to MAX_VARINT_BYTES.
+* Notes            : Seven bits per byte, the high bit marks that another byte follows.
+*****************************************************************************************************/
+inline size_t Encode_Varint(int64_t Value,std::span<uint8_t,MAX_VARINT_BYTES> Output)
+{
+    /* Zigzag Moves The Sign To Bit Zero So -1 Encodes As 1 */
+    uint64_t Zigzag{(static_cast<uint64_t>(Value)<<1)^static_cast<uint64_t>(Value>>63)};
+    size_t Length{};
+    while(Zigzag>=0x80)
+    {
+        Output[Length++]=static_cast<uint8_t>(Zigzag|0x80);
+        Zigzag>>=7;
+    }
+    Output[Length++]=static_cast<uint8_t>(Zigzag);
+    return Length;
+}
+/****************************************************************************************************
+* Function Name    : Decode_Delta_Block
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Rebuilds the samples of one block from its first value and encoded deltas of deltas.
+* Parameters (in)  : Bytes - Encoded stream, may extend past the encoded data.
+*                    First - First sample of the block.
+*                    Level - Instruction set to run the varint decoder on.
+* Parameters (out) : Samples - Receives Samples.size() samples, the first one is First.
+* Return value     : size_t - Number of bytes consumed.
+* Notes            : - Runs of one byte varints are found with a byte mask compare and widened a
+*                      vector at a time, longer varints fall back to the scalar decoder.
+*                    - Throws std::runtime_error if the stream ends early or a varint is too long.
+*                    - Throws std::runtime_error if Level is not supported by the CPU.
+*****************************************************************************************************/
+size_t Decode_Delta_Block(std::span<const uint8_t> Bytes,int64_t First,std::span<int64_t> Samples,Simd_Level Level=Best_Simd_Level());
+/*****************************************
+---    Compressed_Circular_Buffer     ----
+*****************************************/
+template <size_t BLOCK_COUNT=64,size_t BLOCK_BYTES=256>
+class Compressed_Circular_Buffer
+{
+static_assert(BLOCK_COUNT>1,"Compressed_Circular_Buffer Needs At Least Two Blocks \"One Open And One Being Evicted\"");
+static_assert(BLOCK_BYTES>=MAX_VARINT_BYTES,"Compressed_Circular_Buffer Block Must Fit The Longest Varint");
+static_assert(BLOCK_BYTES<std::numeric_limits<uint32_t>::max(),"Compressed_Circular_Buffer Block Size Must Fit Its Header");
+public:
+    /* Most Samples One Block Can Hold "First Value Plus One Byte Per Sample" */
+    static constexpr size_t MAX_BLOCK_SAMPLES{BLOCK_BYTES+1};
+/****************************************************************************************************
+* Constructor Name : Compressed_Circular_Buffer
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Compressed_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Buffer starts empty.
+*****************************************************************************************************/
+Compressed_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Appends a sample to the newest block.
+* Parameters (in)  : Sample - The new sample.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Stores the change of the delta as a zigzag varint, a steady counter or clock
+*                      costs one byte per sample.
+*                    - Opens a new block when the varint does not fit, evicting the oldest block
+*                      with all its samples once BLOCK_COUNT blocks are in use.
+*****************************************************************************************************/
+void Push(int64_t Sample);
+/****************************************************************************************************
+* Function Name    : For_Each_Block
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Decodes the blocks oldest first and hands each one to a visitor.
+* Parameters (in)  : Visitor - Called as Visitor(std::span<const int64_t>) once per block.
+*                    Level   - Instruction set to run the decoder on.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Decodes into one stack buffer of MAX_BLOCK_SAMPLES, the span is only valid
+*                    during the call.
+*****************************************************************************************************/
+template <typename Visitor_Type>
+void For_Each_Block(Visitor_Type&& Visitor,Simd_Level Level=Best_Simd_Level())const;
+/****************************************************************************************************
+* Function Name    : Decode
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the oldest samples out in order.
+* Parameters (in)  : Level - Instruction set to run the decoder on.
+* Parameters (out) : Output - Receives up to Output.size() samples.
+* Return value     : size_t - Number of samples written.
+* Notes            : Whole blocks are decoded straight into Output.
+*****************************************************************************************************/
+size_t Decode(std::span<int64_t> Output,Simd_Level Level=Best_Simd_Level())const;
+/****************************************************************************************************
+* Function Name    : Oldest
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the oldest sample still held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : int64_t - First sample of the oldest block.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+int64_t Oldest(void)const;
+/****************************************************************************************************
+* Function Name    : Newest
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the last sample pushed.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : int64_t - The newest sample.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+int64_t Newest(void)const;
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of samples held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Samples in every live block.
+* Notes            : Depends on how well the samples compress, not on a fixed capacity.
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer holds no sample.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+/****************************************************************************************************
+* Function Name    : Block_Count
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of live blocks.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Live blocks, at most BLOCK_COUNT.
+* Notes            : None
+*****************************************************************************************************/
+size_t Block_Count(void)const;
+/****************************************************************************************************
+* Function Name    : Encoded_Bytes
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the bytes the live samples take, block headers included.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Header plus used payload of every live block.
+* Notes            : Compare with Size()*sizeof(int64_t) for the compression ratio.
+*****************************************************************************************************/
+size_t Encoded_Bytes(void)const;
+/****************************************************************************************************
+* Function Name    : Clear
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Drops every block.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Clear(void);
+private:
+    /* One Independently Decodable Run Of Samples */
+    struct Compressed_Block
+    {
+        /* First Sample, Stored Raw */
+        int64_t m_First{};
+        /* Samples In Block, First Included */
+        uint32_t m_Count{};
+        /* Payload Bytes Used */
+        uint32_t m_Used{};
+        /* Zigzag Varints Of Delta Minus Previous Delta, Zero Filled Past m_Used */
+        std::array<uint8_t,BLOCK_BYTES> m_Bytes{};
+    };
+    /* Bytes Of A Block Outside Its Payload */
+    static constexpr size_t HEADER_BYTES{sizeof(Compressed_Block)-BLOCK_BYTES};
+    /* Blocks Oldest First, Overwrite Evicts The Oldest Whole Block */
+    Circular_Buffer<Compressed_Block,BLOCK_COUNT,Overflow_Policy::Overwrite> m_Blocks;
+    /* Samples In Every Live Block */
+    size_t m_Size{};
+    /* Newest Sample And Its Delta, Encoding State Of The Open Block */
+    int64_t m_Last{};
+    int64_t m_Last_Delta{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Compressed_Circular_Buffer
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Compressed_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Buffer starts empty.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Compressed_Circular_Buffer():
+m_Blocks{},m_Size{},m_Last{},m_Last_Delta{}
+{
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Appends a sample to the newest block.
+* Parameters (in)  : Sample - The new sample.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Stores the change of the delta as a zigzag varint, a steady counter or clock
+*                      costs one byte per sample.
+*                    - Opens a new block when the varint does not fit, evicting the oldest block
+*                      with all its samples once BLOCK_COUNT blocks are in use.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+void Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Push(int64_t Sample)
+{
+    if(m_Size)
+    {
+        /* Unsigned Arithmetic So Wide Jumps Wrap Instead Of Overflowing "Decoder Wraps The Same Way" */
+        const int64_t Delta{static_cast<int64_t>(static_cast<uint64_t>(Sample)-static_cast<uint64_t>(m_Last))};
+        const int64_t Delta_Of_Delta{static_cast<int64_t>(static_cast<uint64_t>(Delta)-static_cast<uint64_t>(m_Last_Delta))};
+        std::array<uint8_t,MAX_VARINT_BYTES> Encoded{};
+        const size_t Length{Encode_Varint(Delta_Of_Delta,Encoded)};
+        Compressed_Block& Open{m_Blocks[m_Blocks.Size()-1]};
+        if(Open.m_Used+Length<=BLOCK_BYTES)
+        {
+            std::copy_n(Encoded.begin(),Length,Open.m_Bytes.begin()+Open.m_Used);
+            Open.m_Used+=static_cast<uint32_t>(Length);
+            Open.m_Count++;
+            m_Size++;
+            m_Last=Sample;
+            m_Last_Delta=Delta;
+            return;
+        }
+    }
+    /* Evicted Block Takes Its Samples Along */
+    if(m_Blocks.Size()==BLOCK_COUNT){m_Size-=m_Blocks[0].m_Count;}
+    Compressed_Block& Open{m_Blocks.Emplace()};
+    Open.m_First=Sample;
+    Open.m_Count=1;
+    m_Size++;
+    m_Last=Sample;
+    /* Every Block Restarts From A Zero Delta So It Decodes On Its Own */
+    m_Last_Delta=0;
+}
+/****************************************************************************************************
+* Function Name    : For_Each_Block
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Decodes the blocks oldest first and hands each one to a visitor.
+* Parameters (in)  : Visitor - Called as Visitor(std::span<const int64_t>) once per block.
+*                    Level   - Instruction set to run the decoder on.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Decodes into one stack buffer of MAX_BLOCK_SAMPLES, the span is only valid
+*                    during the call.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+template <typename Visitor_Type>
+void Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::For_Each_Block(Visitor_Type&& Visitor,Simd_Level Level)const
+{
+    std::array<int64_t,MAX_BLOCK_SAMPLES> Samples;
+    for(const auto Region:m_Blocks.Readable_Spans())
+    {
+        for(const Compressed_Block& Block:Region)
+        {
+            const std::span<int64_t> Decoded{Samples.data(),Block.m_Count};
+            Decode_Delta_Block(Block.m_Bytes,Block.m_First,Decoded,Level);
+            Visitor(std::span<const int64_t>{Decoded});
+        }
+    }
+}
+/****************************************************************************************************
+* Function Name    : Decode
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the oldest samples out in order.
+* Parameters (in)  : Level - Instruction set to run the decoder on.
+* Parameters (out) : Output - Receives up to Output.size() samples.
+* Return value     : size_t - Number of samples written.
+* Notes            : Whole blocks are decoded straight into Output.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+size_t Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Decode(std::span<int64_t> Output,Simd_Level Level)const
+{
+    size_t Written{};
+    for(const auto Region:m_Blocks.Readable_Spans())
+    {
+        for(const Compressed_Block& Block:Region)
+        {
+            const size_t Room{Output.size()-Written};
+            if(Room==0){return Written;}
+            if(Block.m_Count<=Room)
+            {
+                Decode_Delta_Block(Block.m_Bytes,Block.m_First,Output.subspan(Written,Block.m_Count),Level);
+                Written+=Block.m_Count;
+            }
+            else
+            {
+                /* Last Block Only Partly Fits, Decode Aside And Copy The Part That Does */
+                std::array<int64_t,MAX_BLOCK_SAMPLES> Samples;
+                Decode_Delta_Block(Block.m_Bytes,Block.m_First,std::span<int64_t>{Samples.data(),Block.m_Count},Level);
+                std::copy_n(Samples.begin(),Room,Output.begin()+Written);
+                return Written+Room;
+            }
+        }
+    }
+    return Written;
+}
+/****************************************************************************************************
+* Function Name    : Oldest
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the oldest sample still held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : int64_t - First sample of the oldest block.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+int64_t Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Oldest(void)const
+{
+    if(!m_Size){throw std::runtime_error("Buffer Is Empty !");}
+    return m_Blocks[0].m_First;
+}
+/****************************************************************************************************
+* Function Name    : Newest
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the last sample pushed.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : int64_t - The newest sample.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+int64_t Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Newest(void)const
+{
+    if(!m_Size){throw std::runtime_error("Buffer Is Empty !");}
+    return m_Last;
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of samples held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Samples in every live block.
+* Notes            : Depends on how well the samples compress, not on a fixed capacity.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+size_t Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Size(void)const
+{
+    return m_Size;
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer holds no sample.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+bool Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Is_Empty(void)const
+{
+    return m_Size==0;
+}
+/****************************************************************************************************
+* Function Name    : Block_Count
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of live blocks.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Live blocks, at most BLOCK_COUNT.
+* Notes            : None
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+size_t Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Block_Count(void)const
+{
+    const auto Regions{m_Blocks.Readable_Spans()};
+    return Regions[0].size()+Regions[1].size();
+}
+/****************************************************************************************************
+* Function Name    : Encoded_Bytes
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the bytes the live samples take, block headers included.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Header plus used payload of every live block.
+* Notes            : Compare with Size()*sizeof(int64_t) for the compression ratio.
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+size_t Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Encoded_Bytes(void)const
+{
+    size_t Total{};
+    for(const auto Region:m_Blocks.Readable_Spans())
+    {
+        for(const Compressed_Block& Block:Region){Total+=HEADER_BYTES+Block.m_Used;}
+    }
+    return Total;
+}
+/****************************************************************************************************
+* Function Name    : Clear
+* Class            : Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Drops every block.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <size_t BLOCK_COUNT, size_t BLOCK_BYTES>
+void Compressed_Circular_Buffer<BLOCK_COUNT, BLOCK_BYTES>::Clear(void)
+{
+    m_Blocks.Commit_Read(m_Blocks.Size());
+    m_Size=0;
+    m_Last=0;
+    m_Last_Delta=0;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Compressed_Circular_Buffer.hpp
+********************************************************************/
+#endif
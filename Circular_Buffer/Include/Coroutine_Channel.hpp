@@ -0,0 +1,701 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Coroutine_Channel.hpp
+ *  Date: November 30, 2024
+ *  Description: Bounded channel over Circular_Buffer whose Push and Pop can be co_awaited
+ *  Class Name:  Coroutine_Channel
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _COROUTINE_CHANNEL_HPP_
+#define _COROUTINE_CHANNEL_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <concepts>
+#include <coroutine>
+#include <optional>
+#include <utility>
+#if __has_include(<boost/asio/post.hpp>)
+#include <boost/asio/post.hpp>
+#define COROUTINE_CHANNEL_WITH_ASIO
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Anything That Can Schedule A Suspended Coroutine To Run Again */
+template <typename Executor_Type>
+concept Channel_Executor=requires(Executor_Type& Executor,std::coroutine_handle<> Handle)
+{
+    Executor.Post(Handle);
+};
+/* Resumes The Waiter Right Inside The Counterpart Push Or Pop "No Queue, No Thread Handoff" */
+struct Inline_Executor
+{
+    void Post(std::coroutine_handle<> Handle)const{Handle.resume();}
+};
+#ifdef COROUTINE_CHANNEL_WITH_ASIO
+/* Resumes The Waiter From An Asio Executor, Channel And Coroutines Must Share One io_context Thread Or Strand */
+template <typename Executor_Type>
+struct Asio_Executor
+{
+    Executor_Type m_Executor;
+    void Post(std::coroutine_handle<> Handle)const{boost::asio::post(m_Executor,[Handle]{Handle.resume();});}
+};
+template <typename Executor_Type>
+Asio_Executor(Executor_Type)->Asio_Executor<Executor_Type>;
+#endif
+/*****************************************
+-------    Coroutine_Channel     ---------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=16,Channel_Executor EXECUTOR=Inline_Executor>
+class Coroutine_Channel
+{
+public:
+/*****************************************
+----------    Pop_Awaiter     ------------
+*****************************************/
+class Pop_Awaiter
+{
+public:
+Pop_Awaiter(const Pop_Awaiter&)=delete;
+Pop_Awaiter& operator=(const Pop_Awaiter&)=delete;
+/****************************************************************************************************
+* Function Name    : await_ready
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes an element straight away when one is available.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the coroutine does not need to suspend.
+* Notes            : A closed and drained channel never suspends.
+*****************************************************************************************************/
+bool await_ready(void);
+/****************************************************************************************************
+* Function Name    : await_suspend
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Queues the coroutine until a producer hands it an element.
+* Parameters (in)  : Handle - The suspended coroutine.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : The awaiter itself is the queue node, it lives in the coroutine frame.
+*****************************************************************************************************/
+void await_suspend(std::coroutine_handle<> Handle);
+/****************************************************************************************************
+* Function Name    : await_resume
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element handed to the coroutine.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element, empty if the channel was closed and drained.
+* Notes            : None
+*****************************************************************************************************/
+std::optional<Type> await_resume(void);
+private:
+friend class Coroutine_Channel;
+explicit Pop_Awaiter(Coroutine_Channel& Channel);
+    Coroutine_Channel& m_Channel;
+    std::optional<Type> m_Value{};
+    std::coroutine_handle<> m_Handle{};
+    /* Next Waiting Consumer "Intrusive Queue Node" */
+    Pop_Awaiter* m_Next{};
+};
+/*****************************************
+----------    Push_Awaiter     -----------
+*****************************************/
+class Push_Awaiter
+{
+public:
+Push_Awaiter(const Push_Awaiter&)=delete;
+Push_Awaiter& operator=(const Push_Awaiter&)=delete;
+/****************************************************************************************************
+* Function Name    : await_ready
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Hands the element over straight away when there is room or a waiting consumer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the coroutine does not need to suspend.
+* Notes            : A closed channel never suspends.
+*****************************************************************************************************/
+bool await_ready(void);
+/****************************************************************************************************
+* Function Name    : await_suspend
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Queues the coroutine until a consumer frees a slot.
+* Parameters (in)  : Handle - The suspended coroutine.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : The element waits inside the awaiter, it lives in the coroutine frame.
+*****************************************************************************************************/
+void await_suspend(std::coroutine_handle<> Handle);
+/****************************************************************************************************
+* Function Name    : await_resume
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reports whether the element entered the channel.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the element was taken, false if the channel was closed.
+* Notes            : None
+*****************************************************************************************************/
+bool await_resume(void);
+private:
+friend class Coroutine_Channel;
+Push_Awaiter(Coroutine_Channel& Channel,Type&& Element);
+    Coroutine_Channel& m_Channel;
+    Type m_Value;
+    bool m_Accepted{};
+    std::coroutine_handle<> m_Handle{};
+    /* Next Waiting Producer "Intrusive Queue Node" */
+    Push_Awaiter* m_Next{};
+};
+/****************************************************************************************************
+* Constructor Name : Coroutine_Channel
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs an open and empty channel.
+* Parameters (in)  : Executor - Schedules suspended coroutines once their counterpart arrives.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Not thread safe, every coroutine using the channel runs on one thread or strand.
+*****************************************************************************************************/
+explicit Coroutine_Channel(EXECUTOR Executor=EXECUTOR{});
+Coroutine_Channel(const Coroutine_Channel&)=delete;
+Coroutine_Channel& operator=(const Coroutine_Channel&)=delete;
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an awaitable that yields the oldest element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Pop_Awaiter - co_await gives std::optional<Type>, empty once closed and drained.
+* Notes            : Suspends while the channel is empty, no allocation per await.
+*****************************************************************************************************/
+Pop_Awaiter Pop(void);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an awaitable that puts an element into the channel.
+* Parameters (in)  : Element - The element to be pushed.
+* Parameters (out) : None
+* Return value     : Push_Awaiter - co_await gives bool, false if the channel is closed.
+* Notes            : - Suspends while the channel is full, no allocation per await.
+*                    - A waiting consumer gets the element directly, skipping the ring.
+*****************************************************************************************************/
+Push_Awaiter Push(Type Element);
+/****************************************************************************************************
+* Function Name    : Try_Push
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes an element without suspending, for callers that are not coroutines.
+* Parameters (in)  : Element - The element to be pushed.
+* Parameters (out) : None
+* Return value     : bool - True if the element was taken, false if the channel is full or closed.
+* Notes            : Resumes a waiting consumer through the executor.
+*****************************************************************************************************/
+bool Try_Push(Type Element);
+/****************************************************************************************************
+* Function Name    : Try_Pop
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pops an element without suspending, for callers that are not coroutines.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The oldest element, empty if the channel is empty.
+* Notes            : Resumes a waiting producer through the executor.
+*****************************************************************************************************/
+std::optional<Type> Try_Pop(void);
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Refuses further elements and wakes every waiting coroutine.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Elements pushed before Close are still delivered.
+*****************************************************************************************************/
+void Close(void);
+/****************************************************************************************************
+* Function Name    : Is_Closed
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if Close was called.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if closed, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Closed(void)const;
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of buffered elements.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Elements in the ring, not counting those held by waiting producers.
+* Notes            : None
+*****************************************************************************************************/
+size_t Size(void);
+private:
+/****************************************************************************************************
+* Function Name    : Offer
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Gives an element to a waiting consumer or the ring.
+* Parameters (in)  : Element - The element, moved from only when taken.
+* Parameters (out) : None
+* Return value     : bool - True if taken, false if the channel is full or closed.
+* Notes            : None
+*****************************************************************************************************/
+bool Offer(Type& Element);
+/****************************************************************************************************
+* Function Name    : Take
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Takes the oldest element and refills the freed slot from a waiting producer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element, empty if the channel is empty.
+* Notes            : None
+*****************************************************************************************************/
+std::optional<Type> Take(void);
+/****************************************************************************************************
+* Function Name    : Enqueue
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Appends a waiter to an intrusive queue.
+* Parameters (in)  : First  - Oldest waiter of the queue.
+*                    Last   - Newest waiter of the queue.
+*                    Waiter - Waiter to be appended.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Awaiter_Type>
+static void Enqueue(Awaiter_Type*& First,Awaiter_Type*& Last,Awaiter_Type* Waiter);
+/****************************************************************************************************
+* Function Name    : Dequeue
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Removes the oldest waiter of an intrusive queue.
+* Parameters (in)  : First - Oldest waiter of the queue.
+*                    Last  - Newest waiter of the queue.
+* Parameters (out) : None
+* Return value     : Awaiter_Type* - The removed waiter, nullptr if the queue is empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Awaiter_Type>
+static Awaiter_Type* Dequeue(Awaiter_Type*& First,Awaiter_Type*& Last);
+private:
+    /* Reject Policy "A Full Channel Makes Producers Wait Instead Of Losing Data" */
+    Circular_Buffer<Type,TOTAL_SIZE,Overflow_Policy::Reject> m_Buffer;
+    EXECUTOR m_Executor;
+    /* Consumers Waiting On An Empty Channel, Oldest First */
+    Pop_Awaiter* m_First_Consumer{};
+    Pop_Awaiter* m_Last_Consumer{};
+    /* Producers Waiting On A Full Channel, Oldest First */
+    Push_Awaiter* m_First_Producer{};
+    Push_Awaiter* m_Last_Producer{};
+    bool m_Closed{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Pop_Awaiter
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Binds the awaiter to its channel.
+* Parameters (in)  : Channel - Channel to pop from.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Only created by Coroutine_Channel::Pop.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter::Pop_Awaiter(Coroutine_Channel& Channel):
+m_Channel{Channel},m_Value{},m_Handle{},m_Next{}
+{}
+/****************************************************************************************************
+* Function Name    : await_ready
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes an element straight away when one is available.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the coroutine does not need to suspend.
+* Notes            : A closed and drained channel never suspends.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+bool Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter::await_ready(void)
+{
+    m_Value=m_Channel.Take();
+    return m_Value.has_value()||m_Channel.m_Closed;
+}
+/****************************************************************************************************
+* Function Name    : await_suspend
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Queues the coroutine until a producer hands it an element.
+* Parameters (in)  : Handle - The suspended coroutine.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : The awaiter itself is the queue node, it lives in the coroutine frame.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+void Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter::await_suspend(std::coroutine_handle<> Handle)
+{
+    m_Handle=Handle;
+    Enqueue(m_Channel.m_First_Consumer,m_Channel.m_Last_Consumer,this);
+}
+/****************************************************************************************************
+* Function Name    : await_resume
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the element handed to the coroutine.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element, empty if the channel was closed and drained.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+std::optional<Type> Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter::await_resume(void)
+{
+    return std::move(m_Value);
+}
+/****************************************************************************************************
+* Constructor Name : Push_Awaiter
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Binds the awaiter to its channel and keeps the element until it is taken.
+* Parameters (in)  : Channel - Channel to push into.
+*                    Element - The element to be pushed.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Only created by Coroutine_Channel::Push.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter::Push_Awaiter(Coroutine_Channel& Channel,Type&& Element):
+m_Channel{Channel},m_Value{std::move(Element)},m_Accepted{},m_Handle{},m_Next{}
+{}
+/****************************************************************************************************
+* Function Name    : await_ready
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Hands the element over straight away when there is room or a waiting consumer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the coroutine does not need to suspend.
+* Notes            : A closed channel never suspends.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+bool Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter::await_ready(void)
+{
+    m_Accepted=m_Channel.Offer(m_Value);
+    return m_Accepted||m_Channel.m_Closed;
+}
+/****************************************************************************************************
+* Function Name    : await_suspend
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Queues the coroutine until a consumer frees a slot.
+* Parameters (in)  : Handle - The suspended coroutine.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : The element waits inside the awaiter, it lives in the coroutine frame.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+void Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter::await_suspend(std::coroutine_handle<> Handle)
+{
+    m_Handle=Handle;
+    Enqueue(m_Channel.m_First_Producer,m_Channel.m_Last_Producer,this);
+}
+/****************************************************************************************************
+* Function Name    : await_resume
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reports whether the element entered the channel.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the element was taken, false if the channel was closed.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+bool Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter::await_resume(void)
+{
+    return m_Accepted;
+}
+/****************************************************************************************************
+* Constructor Name : Coroutine_Channel
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs an open and empty channel.
+* Parameters (in)  : Executor - Schedules suspended coroutines once their counterpart arrives.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Not thread safe, every coroutine using the channel runs on one thread or strand.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Coroutine_Channel(EXECUTOR Executor):
+m_Buffer{},m_Executor{std::move(Executor)},m_First_Consumer{},m_Last_Consumer{},m_First_Producer{},m_Last_Producer{},m_Closed{}
+{}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an awaitable that yields the oldest element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Pop_Awaiter - co_await gives std::optional<Type>, empty once closed and drained.
+* Notes            : Suspends while the channel is empty, no allocation per await.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+typename Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop_Awaiter Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Pop(void)
+{
+    return Pop_Awaiter{*this};
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns an awaitable that puts an element into the channel.
+* Parameters (in)  : Element - The element to be pushed.
+* Parameters (out) : None
+* Return value     : Push_Awaiter - co_await gives bool, false if the channel is closed.
+* Notes            : - Suspends while the channel is full, no allocation per await.
+*                    - A waiting consumer gets the element directly, skipping the ring.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+typename Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push_Awaiter Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Push(Type Element)
+{
+    return Push_Awaiter{*this,std::move(Element)};
+}
+/****************************************************************************************************
+* Function Name    : Try_Push
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes an element without suspending, for callers that are not coroutines.
+* Parameters (in)  : Element - The element to be pushed.
+* Parameters (out) : None
+* Return value     : bool - True if the element was taken, false if the channel is full or closed.
+* Notes            : Resumes a waiting consumer through the executor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+bool Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Try_Push(Type Element)
+{
+    return Offer(Element);
+}
+/****************************************************************************************************
+* Function Name    : Try_Pop
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pops an element without suspending, for callers that are not coroutines.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The oldest element, empty if the channel is empty.
+* Notes            : Resumes a waiting producer through the executor.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+std::optional<Type> Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Try_Pop(void)
+{
+    return Take();
+}
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Refuses further elements and wakes every waiting coroutine.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Elements pushed before Close are still delivered.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+void Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Close(void)
+{
+    if(m_Closed){return;}
+    m_Closed=true;
+    /* Waiting Consumers Only Exist While The Ring Is Empty, They Resume With Nothing */
+    while(Pop_Awaiter* Consumer{Dequeue(m_First_Consumer,m_Last_Consumer)}){m_Executor.Post(Consumer->m_Handle);}
+    /* Waiting Producers Resume With Their Element Refused */
+    while(Push_Awaiter* Producer{Dequeue(m_First_Producer,m_Last_Producer)}){m_Executor.Post(Producer->m_Handle);}
+}
+/****************************************************************************************************
+* Function Name    : Is_Closed
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if Close was called.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if closed, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+bool Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Is_Closed(void)const
+{
+    return m_Closed;
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of buffered elements.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Elements in the ring, not counting those held by waiting producers.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+size_t Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Size(void)
+{
+    return m_Buffer.Size();
+}
+/****************************************************************************************************
+* Function Name    : Offer
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Gives an element to a waiting consumer or the ring.
+* Parameters (in)  : Element - The element, moved from only when taken.
+* Parameters (out) : None
+* Return value     : bool - True if taken, false if the channel is full or closed.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+bool Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Offer(Type& Element)
+{
+    if(m_Closed){return false;}
+    /* Direct Handoff "Ring Is Empty Whenever A Consumer Waits" */
+    if(Pop_Awaiter* Consumer{Dequeue(m_First_Consumer,m_Last_Consumer)})
+    {
+        Consumer->m_Value.emplace(std::move(Element));
+        m_Executor.Post(Consumer->m_Handle);
+        return true;
+    }
+    if(m_Buffer.Size()==TOTAL_SIZE){return false;}
+    m_Buffer.Push(std::move(Element));
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Take
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Takes the oldest element and refills the freed slot from a waiting producer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<Type> - The element, empty if the channel is empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+std::optional<Type> Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Take(void)
+{
+    std::optional<Type> Element{m_Buffer.Try_Pop()};
+    if(!Element){return std::nullopt;}
+    /* Freed Slot Goes To The Oldest Waiting Producer So Order Is Kept */
+    if(Push_Awaiter* Producer{Dequeue(m_First_Producer,m_Last_Producer)})
+    {
+        m_Buffer.Push(std::move(Producer->m_Value));
+        Producer->m_Accepted=true;
+        m_Executor.Post(Producer->m_Handle);
+    }
+    return Element;
+}
+/****************************************************************************************************
+* Function Name    : Enqueue
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Appends a waiter to an intrusive queue.
+* Parameters (in)  : First  - Oldest waiter of the queue.
+*                    Last   - Newest waiter of the queue.
+*                    Waiter - Waiter to be appended.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+template <typename Awaiter_Type>
+void Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Enqueue(Awaiter_Type*& First,Awaiter_Type*& Last,Awaiter_Type* Waiter)
+{
+    Waiter->m_Next=nullptr;
+    if(Last){Last->m_Next=Waiter;}
+    else{First=Waiter;}
+    Last=Waiter;
+}
+/****************************************************************************************************
+* Function Name    : Dequeue
+* Class            : Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Removes the oldest waiter of an intrusive queue.
+* Parameters (in)  : First - Oldest waiter of the queue.
+*                    Last  - Newest waiter of the queue.
+* Parameters (out) : None
+* Return value     : Awaiter_Type* - The removed waiter, nullptr if the queue is empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Channel_Executor EXECUTOR>
+template <typename Awaiter_Type>
+Awaiter_Type* Coroutine_Channel<Type, TOTAL_SIZE, EXECUTOR>::Dequeue(Awaiter_Type*& First,Awaiter_Type*& Last)
+{
+    Awaiter_Type* Waiter{First};
+    if(Waiter)
+    {
+        First=Waiter->m_Next;
+        if(!First){Last=nullptr;}
+    }
+    return Waiter;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Coroutine_Channel.hpp
+********************************************************************/
+#endif
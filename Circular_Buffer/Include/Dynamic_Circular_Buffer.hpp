@@ -0,0 +1,2409 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Dynamic_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Circular buffer whose capacity is chosen at construction and whose storage comes from an allocator
+ *  Class Name:  Dynamic_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _DYNAMIC_CIRCULAR_BUFFER_HPP_
+#define _DYNAMIC_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include <span>
+#include <array>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <compare>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* What A Full Dynamic_Circular_Buffer Does On Push */
+enum class Growth_Policy
+{
+    /* Drop The Oldest Element "Same As Circular_Buffer" */
+    Overwrite,
+    /* Relinearize Contents Into A Block Twice As Large */
+    Grow
+};
+/*****************************************
+-----    Dynamic_Circular_Buffer     -----
+*****************************************/
+template <typename Type=int,typename Allocator=std::allocator<Type>>
+class Dynamic_Circular_Buffer
+{
+public:
+    using allocator_type=Allocator;
+    /* Up To Two Contiguous Regions "Before And After Wrap Point" */
+    using Readable_Regions=std::array<std::span<const Type>,2>;
+    using Writable_Regions=std::array<std::span<Type>,2>;
+private:
+    using Allocator_Traits=std::allocator_traits<Allocator>;
+/*****************************************
+---------    Buffer_Iterator     ---------
+*****************************************/
+template <bool CONSTANT>
+struct Buffer_Iterator
+{
+using difference_type=std::ptrdiff_t;
+using value_type=Type;
+using pointer=std::conditional_t<CONSTANT,const Type*,Type*>;
+using reference=std::conditional_t<CONSTANT,const Type&,Type&>;
+using iterator_category=std::random_access_iterator_tag;
+using iterator_concept=std::random_access_iterator_tag;
+/* Singular Iterator "Required By Iterator Concepts" */
+constexpr Buffer_Iterator()=default;
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Constructs a Buffer_Iterator object.
+* Parameters (in)   : 
+*   - Buffer        : Pointer to the buffer "Data Block".
+*   - Capacity      : Number of slots in the data block.
+*   - Head_Index    : Position of the oldest element, offsets are counted from it.
+*   - Offset        : Logical offset of the element from the head.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator(pointer Buffer,size_t Capacity,size_t Head_Index,difference_type Offset);
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator (Conversion)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Converts a mutable iterator into a constant one.
+* Parameters (in)   : 
+*   - Object        : Mutable iterator to convert.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : Only constant iterators can be built from mutable ones.
+*****************************************************************************************************/
+template <bool OTHER_CONSTANT>requires (CONSTANT&&!OTHER_CONSTANT)
+constexpr Buffer_Iterator(const Buffer_Iterator<OTHER_CONSTANT>& Object);
+/****************************************************************************************************
+* Function Name     : operator*
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Dereferences the iterator, returning a reference to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : reference - Reference to the current element in the buffer.
+* Notes             : Offset is turned into a slot with one add and a branch "No Modulo".
+*****************************************************************************************************/
+constexpr reference operator*()const;
+/****************************************************************************************************
+* Function Name     : operator->
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns a pointer to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : pointer - Pointer to the current element in the buffer.
+* Notes             : None
+*****************************************************************************************************/
+constexpr pointer operator->()const;
+/****************************************************************************************************
+* Function Name     : operator[]
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns the element found a number of steps away from the iterator.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps from the current element.
+* Parameters (out)  : None
+* Return value      : reference - Reference to the element at that offset.
+* Notes             : None
+*****************************************************************************************************/
+constexpr reference operator[](difference_type Offset)const;
+/****************************************************************************************************
+* Function Name     : operator++
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Pre-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being incremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator++();
+/****************************************************************************************************
+* Function Name     : operator++ (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Post-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being incremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator++(int);
+/****************************************************************************************************
+* Function Name     : operator--
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Pre-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being decremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator--();
+/****************************************************************************************************
+* Function Name     : operator-- (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Post-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being decremented.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator--(int);
+/****************************************************************************************************
+* Function Name     : operator+=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Moves the iterator a number of steps in constant time.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator+=(difference_type Offset);
+/****************************************************************************************************
+* Function Name     : operator-=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Moves the iterator a number of steps backwards in constant time.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator& operator-=(difference_type Offset);
+/****************************************************************************************************
+* Function Name     : operator+
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns an iterator a number of steps after this one.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator+(difference_type Offset)const;
+/****************************************************************************************************
+* Function Name     : operator-
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns an iterator a number of steps before this one.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+constexpr Buffer_Iterator operator-(difference_type Offset)const;
+/****************************************************************************************************
+* Function Name     : operator- (Distance)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns the number of steps between two iterators.
+* Parameters (in)   : 
+*   - Object        : Iterator of the same buffer to measure from.
+* Parameters (out)  : None
+* Return value      : difference_type - Signed distance from Object to this iterator.
+* Notes             : None
+*****************************************************************************************************/
+constexpr difference_type operator-(const Buffer_Iterator& Object)const;
+/****************************************************************************************************
+* Function Name     : operator==
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Equality comparison operator for Buffer_Iterator objects.
+* Parameters (in)   : 
+*   - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : bool - True if the iterators are equal, false otherwise.
+* Notes             : Inequality is derived from it.
+*****************************************************************************************************/
+constexpr bool operator==(const Buffer_Iterator& Object)const;
+/****************************************************************************************************
+* Function Name     : operator<=>
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Orders two iterators of the same buffer.
+* Parameters (in)   : 
+*   - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : std::strong_ordering - Order of the logical offsets.
+* Notes             : Relational operators are derived from it.
+*****************************************************************************************************/
+constexpr std::strong_ordering operator<=>(const Buffer_Iterator& Object)const;
+/* Offset First Form Of operator+ "Required By Random Access Iterators" */
+friend constexpr Buffer_Iterator operator+(difference_type Offset,const Buffer_Iterator& Object){return Object+Offset;}
+private:
+    /* Constant Iterator Copies The Members Of A Mutable One */
+    friend struct Buffer_Iterator<!CONSTANT>;
+    /* Data Block Containing Elements */
+    pointer m_Buffer{};
+    /* Number Of Slots In Data Block */
+    size_t m_Capacity{};
+    /* Position Of Oldest Element When Iterator Was Made */
+    size_t m_Head_Index{};
+    /* Logical Offset From Head "Random Access In Constant Time" */
+    difference_type m_Offset{};
+};
+public:
+    /* Random Access Iterators Over Live Elements "Oldest First" */
+    using iterator=Buffer_Iterator<false>;
+    using const_iterator=Buffer_Iterator<true>;
+    using reverse_iterator=std::reverse_iterator<iterator>;
+    using const_reverse_iterator=std::reverse_iterator<const_iterator>;
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Allocates a circular buffer holding Capacity elements.
+* Parameters (in)  : Capacity      - Number of elements the buffer holds before overflowing.
+*                    Policy        - What a full buffer does on push.
+*                    Buffer_Memory - Allocator providing the data block "std::pmr Supported".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Capacity is zero.
+*****************************************************************************************************/
+explicit Dynamic_Circular_Buffer(size_t Capacity,Growth_Policy Policy=Growth_Policy::Overwrite,const Allocator& Buffer_Memory=Allocator());
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer (Initializer List)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Allocates a circular buffer and pushes the elements of an initializer list.
+* Parameters (in)  : Capacity      - Number of elements the buffer holds before overflowing.
+*                    Values        - An initializer list of elements to initialize the buffer.
+*                    Policy        - What a full buffer does on push.
+*                    Buffer_Memory - Allocator providing the data block "std::pmr Supported".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if the initializer list is larger than Capacity.
+*****************************************************************************************************/
+Dynamic_Circular_Buffer(size_t Capacity,const std::initializer_list<Type>& Values,Growth_Policy Policy=Growth_Policy::Overwrite,const Allocator& Buffer_Memory=Allocator());
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer (Copy)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies another circular buffer into a new block of the same capacity.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Allocator is obtained through select_on_container_copy_construction.
+*                    - Copies the live elements only, the head lands at index zero.
+*****************************************************************************************************/
+Dynamic_Circular_Buffer(const Dynamic_Circular_Buffer& Object);
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer (Move)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes over the data block of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from, left without storage.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : A buffer left without storage throws on push until Reserve or assignment gives
+*                    it a block again.
+*****************************************************************************************************/
+Dynamic_Circular_Buffer(Dynamic_Circular_Buffer&& Object)noexcept;
+/****************************************************************************************************
+* Function Name    : operator= (Copy)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with a copy of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : Dynamic_Circular_Buffer<Type, Allocator>& - This buffer.
+* Notes            : - Allocator follows propagate_on_container_copy_assignment.
+*                    - Capacity and policy follow Object, the block is kept when nothing changes.
+*****************************************************************************************************/
+Dynamic_Circular_Buffer& operator=(const Dynamic_Circular_Buffer& Object);
+/****************************************************************************************************
+* Function Name    : operator= (Move)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with the elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from.
+* Parameters (out) : None
+* Return value     : Dynamic_Circular_Buffer<Type, Allocator>& - This buffer.
+* Notes            : - Takes over the block when the allocator propagates or both compare equal,
+*                      Object is then left without storage.
+*                    - Otherwise moves element by element into a block of this allocator, Object
+*                      keeps its block and is left empty.
+*****************************************************************************************************/
+Dynamic_Circular_Buffer& operator=(Dynamic_Circular_Buffer&& Object)noexcept(Allocator_Traits::propagate_on_container_move_assignment::value||Allocator_Traits::is_always_equal::value);
+/****************************************************************************************************
+* Function Name    : ~Dynamic_Circular_Buffer (Destructor)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys the live elements and returns the data block to the allocator.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Free slots were never constructed.
+*****************************************************************************************************/
+~Dynamic_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : operator==
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Overloaded equality operator for comparing two circular buffers.
+* Parameters (in)  : Object - The circular buffer to compare with.
+* Parameters (out) : None
+* Return value     : bool - True if both hold the same elements in the same order.
+* Notes            : Compares contents only, capacities and wrap points may differ.
+*****************************************************************************************************/
+bool operator==(const Dynamic_Circular_Buffer& Object)const;
+/****************************************************************************************************
+* Function Name    : Head
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the head of the buffer.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+const Type& Head(void)const;
+/****************************************************************************************************
+* Function Name    : Tail
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the tail of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the tail of the buffer.
+* Notes            : - Tail slot is the next one to be written, it only holds a live element "The
+*                      Oldest One" when the buffer is full.
+*                    - Throws a runtime error if the buffer is not full.
+*****************************************************************************************************/
+const Type& Tail(void)const;
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Overwrite policy moves the head when full "Same As Circular_Buffer".
+*                    - Grow policy doubles the capacity when full instead.
+*                    - Throws a runtime error if the buffer has no storage "Moved From".
+*****************************************************************************************************/
+void Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be moved into the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Same overflow behaviour as the copying Push.
+*                    - Works with move-only types.
+*****************************************************************************************************/
+void Push(Type&& Element);
+/****************************************************************************************************
+* Function Name    : Emplace
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs a new element in place at the tail of the circular buffer.
+* Parameters (in)  : Arguments - Arguments forwarded to the constructor of Type.
+* Parameters (out) : None
+* Return value     : Type& - Reference to the new element.
+* Notes            : - Constructs directly in the free slot, no temporary is made.
+*                    - On a full buffer a temporary is built first "Arguments May Refer To The Oldest
+*                      Element" then handled like Push.
+*****************************************************************************************************/
+template <typename... Arguments_Type>
+Type& Emplace(Arguments_Type&&... Arguments);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - The element removed from the buffer.
+* Notes            : - Moves the element out, Type needs no default constructor.
+*                    - Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+Type Pop(void);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves the element at the head of the circular buffer out.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer by move assignment.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : Never throws on an empty buffer "Polling Friendly".
+*****************************************************************************************************/
+bool Pop(Type& Element);
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a batch of elements into the circular buffer.
+* Parameters (in)  : Elements - Contiguous elements to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements taken from Elements.
+* Notes            : - Copies in at most two contiguous segments around the wrap point.
+*                    - Grow policy reserves room for the whole batch first, Overwrite policy drops
+*                      the oldest elements.
+*                    - Throws a runtime error if the buffer has no storage "Moved From".
+*****************************************************************************************************/
+size_t Push_N(std::span<const Type> Elements);
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes a batch of elements from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the removed elements in order.
+* Return value     : size_t - Number of elements removed "Smaller Of Size And Elements Size".
+* Notes            : Copies out in at most two contiguous segments around the wrap point.
+*****************************************************************************************************/
+size_t Pop_N(std::span<Type> Elements);
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the occupied region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first, second span is empty unless the
+*                    occupied region wraps around the end of the storage.
+* Notes            : Views are invalidated by Reserve or by a Push that grows the buffer.
+*****************************************************************************************************/
+Readable_Regions Readable_Spans(void)const;
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the free region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order, second span is empty unless the
+*                    free region wraps around the end of the storage.
+* Notes            : - Data written into the spans becomes visible after Commit_Write.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+Writable_Regions Writable_Spans(void)requires std::is_trivially_copyable_v<Type>;
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases elements consumed through Readable_Spans.
+* Parameters (in)  : Count - Number of elements consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the current size.
+*****************************************************************************************************/
+void Commit_Read(size_t Count);
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes elements written through Writable_Spans.
+* Parameters (in)  : Count - Number of elements written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the free space.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+void Commit_Write(size_t Count)requires std::is_trivially_copyable_v<Type>;
+/****************************************************************************************************
+* Function Name    : Reserve
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Grows the capacity of the circular buffer.
+* Parameters (in)  : New_Capacity - Requested number of slots.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Does nothing if New_Capacity is not larger than the current capacity.
+*                    - Relinearizes the contents so the head lands at the start of the new block.
+*                    - Gives a buffer left without storage "Moved From" a new block.
+*****************************************************************************************************/
+void Reserve(size_t New_Capacity);
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current size of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the number of elements the circular buffer holds before overflowing.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current capacity of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+size_t Capacity(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+/****************************************************************************************************
+* Function Name    : get_allocator
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a copy of the allocator providing the data block.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Allocator - The allocator in use.
+* Notes            : None
+*****************************************************************************************************/
+Allocator get_allocator(void)const;
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns an iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr iterator begin() noexcept;
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns an iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr iterator end() noexcept;
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator begin()const noexcept;
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator end()const noexcept;
+/****************************************************************************************************
+* Function Name    : cbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator cbegin()const noexcept;
+/****************************************************************************************************
+* Function Name    : cend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_iterator cend()const noexcept;
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr reverse_iterator rbegin() noexcept;
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr reverse_iterator rend() noexcept;
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator rbegin()const noexcept;
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator rend()const noexcept;
+/****************************************************************************************************
+* Function Name    : crbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator crbegin()const noexcept;
+/****************************************************************************************************
+* Function Name    : crend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+constexpr const_reverse_iterator crend()const noexcept;
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+Type& At(size_t Offset);
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+const Type& At(size_t Offset)const;
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+Type& operator[](size_t Offset);
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+const Type& operator[](size_t Offset)const;
+private:
+/****************************************************************************************************
+* Function Name    : Next_Index
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the index found a number of steps after the given one.
+* Parameters (in)  : Index - Current index in the data block.
+*                    Count - Number of steps to move forward "Not Larger Than Capacity".
+* Parameters (out) : None
+* Return value     : size_t - Next index "Care About Overflow".
+* Notes            : Wraps with a branch, capacity is only known at run time.
+*****************************************************************************************************/
+size_t Next_Index(size_t Index,size_t Count=1)const;
+/****************************************************************************************************
+* Function Name    : Store
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Copies or moves an element into the tail slot.
+* Parameters (in)  : Element - The element to be stored, forwarded as given.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Constructs into a free slot, assigns over the oldest element on overflow.
+*                    - Grow policy relinearizes into a block twice as large when full.
+*****************************************************************************************************/
+template <typename Element_Type>
+void Store(Element_Type&& Element);
+/****************************************************************************************************
+* Function Name    : Check_Storage
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Makes sure the buffer owns a data block before writing into it.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if the buffer was left without storage "Moved From".
+*****************************************************************************************************/
+void Check_Storage(void)const;
+/****************************************************************************************************
+* Function Name    : Relinearize
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Moves the contents into a new block with the head at index zero.
+* Parameters (in)  : New_Capacity - Number of slots in the new block "Not Smaller Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Old block is destroyed and returned to the allocator.
+*                    - Strong guarantee, a throwing move or copy releases the new block and leaves
+*                      the buffer untouched "std::move_if_noexcept".
+*****************************************************************************************************/
+void Relinearize(size_t New_Capacity);
+/****************************************************************************************************
+* Function Name    : Append_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Constructs the live elements of another buffer after the tail in order.
+* Parameters (in)  : Object - Buffer to copy from, or to move from when passed as an rvalue.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Free space must hold every element of Object, size grows with each one so a
+*                    throwing element leaves the already constructed ones owned by the buffer.
+*****************************************************************************************************/
+template <typename Buffer_Type>
+void Append_Elements(Buffer_Type&& Object);
+/****************************************************************************************************
+* Function Name    : Allocate_Block
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Allocates an uninitialized data block.
+* Parameters (in)  : Capacity - Number of slots to allocate.
+* Parameters (out) : None
+* Return value     : Type* - The new data block, null when Capacity is zero.
+* Notes            : Slots are constructed only while they hold live elements.
+*****************************************************************************************************/
+Type* Allocate_Block(size_t Capacity);
+/****************************************************************************************************
+* Function Name    : Release_Block
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Destroys the live elements and returns the data block to the allocator.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Leaves the buffer empty and without storage.
+*****************************************************************************************************/
+void Release_Block(void);
+/****************************************************************************************************
+* Function Name    : Destroy_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Destroys a run of live elements starting at an index.
+* Parameters (in)  : Index - Index of the first element to destroy.
+*                    Count - Number of elements to destroy "Not Larger Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Goes through the allocator so scoped allocators see every destruction.
+*****************************************************************************************************/
+void Destroy_Elements(size_t Index,size_t Count);
+/****************************************************************************************************
+* Function Name    : Construct_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Copy constructs a contiguous run of elements into free slots.
+* Parameters (in)  : Source      - First element to copy from.
+*                    Count       - Number of elements to copy.
+* Parameters (out) : Destination - First free slot to construct in.
+* Return value     : None
+* Notes            : - Uses memcpy when Type is trivially copyable.
+*                    - A throwing copy destroys the part of the run already built.
+*****************************************************************************************************/
+void Construct_Elements(Type* Destination,const Type* Source,size_t Count);
+/****************************************************************************************************
+* Function Name    : Move_Out_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Moves a contiguous run of live elements out and destroys them.
+* Parameters (in)  : Source      - First live element to move from.
+*                    Count       - Number of elements to move.
+* Parameters (out) : Destination - First element to move assign to.
+* Return value     : None
+* Notes            : Uses memcpy when Type is trivially copyable.
+*****************************************************************************************************/
+void Move_Out_Elements(Type* Destination,Type* Source,size_t Count);
+private:
+    /* Allocator Providing The Data Block */
+    [[no_unique_address]] Allocator m_Allocator{};
+    /* What A Full Buffer Does On Push */
+    Growth_Policy m_Policy{};
+    /* Number Of Slots In Data Block */
+    size_t m_Capacity{};
+    /* Total Size Of Current Elements In Buffer */
+    size_t m_Current_Size{};
+    /* Index Of Head To Pop From */
+    size_t m_Head_Index{};
+    /* Index Of Tain To Push In */
+    size_t m_Tail_Index{};
+    /* Data Block Storing Elements "Constructed Only While Live" */
+    Type *m_Data{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/*****************************************
+---------    Buffer_Iterator     ---------
+*****************************************/
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Constructs a Buffer_Iterator object.
+* Parameters (in)   : 
+*   - Buffer        : Pointer to the buffer "Data Block".
+*   - Capacity      : Number of slots in the data block.
+*   - Head_Index    : Position of the oldest element, offsets are counted from it.
+*   - Offset        : Logical offset of the element from the head.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::Buffer_Iterator(pointer Buffer,size_t Capacity,size_t Head_Index,difference_type Offset):
+m_Buffer(Buffer),m_Capacity(Capacity),m_Head_Index(Head_Index),m_Offset(Offset)
+{}
+/****************************************************************************************************
+* Constructor       : Buffer_Iterator (Conversion)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Converts a mutable iterator into a constant one.
+* Parameters (in)   : 
+*   - Object        : Mutable iterator to convert.
+* Parameters (out)  : None
+* Return value      : None
+* Notes             : Only constant iterators can be built from mutable ones.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+template <bool OTHER_CONSTANT>requires (CONSTANT&&!OTHER_CONSTANT)
+constexpr Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::Buffer_Iterator(const Buffer_Iterator<OTHER_CONSTANT>& Object):
+m_Buffer(Object.m_Buffer),m_Capacity(Object.m_Capacity),m_Head_Index(Object.m_Head_Index),m_Offset(Object.m_Offset)
+{}
+/****************************************************************************************************
+* Function Name     : operator*
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Dereferences the iterator, returning a reference to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : reference - Reference to the current element in the buffer.
+* Notes             : Offset is turned into a slot with one add and a branch "No Modulo".
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>::reference Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator*()const
+{
+    /* Offsets Stay Within One Capacity Of The Head */
+    const size_t Position{m_Head_Index+static_cast<size_t>(m_Offset)};
+    return m_Buffer[(Position>=m_Capacity)?(Position-m_Capacity):Position];
+}
+/****************************************************************************************************
+* Function Name     : operator->
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns a pointer to the current element.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : pointer - Pointer to the current element in the buffer.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>::pointer Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator->()const
+{
+    return &**this;
+}
+/****************************************************************************************************
+* Function Name     : operator[]
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns the element found a number of steps away from the iterator.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps from the current element.
+* Parameters (out)  : None
+* Return value      : reference - Reference to the element at that offset.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>::reference Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator[](difference_type Offset)const
+{
+    return *(*this+Offset);
+}
+/****************************************************************************************************
+* Function Name     : operator++
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Pre-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being incremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>& Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator++()
+{
+    ++m_Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator++ (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Post-increment operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being incremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT> Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator++(int)
+{
+    Buffer_Iterator Previous{*this};
+    ++m_Offset;
+    return Previous;
+}
+/****************************************************************************************************
+* Function Name     : operator--
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Pre-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being decremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>& Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator--()
+{
+    --m_Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator-- (Postfix)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Post-decrement operator for Buffer_Iterator objects.
+* Parameters (in)   : None
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - Copy of the iterator before being decremented.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT> Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator--(int)
+{
+    Buffer_Iterator Previous{*this};
+    --m_Offset;
+    return Previous;
+}
+/****************************************************************************************************
+* Function Name     : operator+=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Moves the iterator a number of steps in constant time.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>& Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator+=(difference_type Offset)
+{
+    m_Offset+=Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator-=
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Moves the iterator a number of steps backwards in constant time.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator& - The iterator after being moved.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>& Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator-=(difference_type Offset)
+{
+    m_Offset-=Offset;
+    return *this;
+}
+/****************************************************************************************************
+* Function Name     : operator+
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns an iterator a number of steps after this one.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT> Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator+(difference_type Offset)const
+{
+    return Buffer_Iterator{m_Buffer,m_Capacity,m_Head_Index,m_Offset+Offset};
+}
+/****************************************************************************************************
+* Function Name     : operator-
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns an iterator a number of steps before this one.
+* Parameters (in)   : 
+*   - Offset        : Signed number of steps to move back.
+* Parameters (out)  : None
+* Return value      : Buffer_Iterator - The moved iterator.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT> Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator-(difference_type Offset)const
+{
+    return Buffer_Iterator{m_Buffer,m_Capacity,m_Head_Index,m_Offset-Offset};
+}
+/****************************************************************************************************
+* Function Name     : operator- (Distance)
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Returns the number of steps between two iterators.
+* Parameters (in)   : 
+*   - Object        : Iterator of the same buffer to measure from.
+* Parameters (out)  : None
+* Return value      : difference_type - Signed distance from Object to this iterator.
+* Notes             : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::template Buffer_Iterator<CONSTANT>::difference_type Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator-(const Buffer_Iterator& Object)const
+{
+    return m_Offset-Object.m_Offset;
+}
+/****************************************************************************************************
+* Function Name     : operator==
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Equality comparison operator for Buffer_Iterator objects.
+* Parameters (in)   : 
+*   - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : bool - True if the iterators are equal, false otherwise.
+* Notes             : Inequality is derived from it.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr bool Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator==(const Buffer_Iterator& Object)const
+{
+    return m_Offset==Object.m_Offset;
+}
+/****************************************************************************************************
+* Function Name     : operator<=>
+* Type              : Public
+* Class             : Buffer_Iterator<CONSTANT>
+* Namespace         : Data_Structure::Dynamic_Circular_Buffer
+* Description       : Orders two iterators of the same buffer.
+* Parameters (in)   : 
+*   - Object        : Another Buffer_Iterator object to compare with.
+* Parameters (out)  : None
+* Return value      : std::strong_ordering - Order of the logical offsets.
+* Notes             : Relational operators are derived from it.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <bool CONSTANT>
+constexpr std::strong_ordering Dynamic_Circular_Buffer<Type, Allocator>::Buffer_Iterator<CONSTANT>::operator<=>(const Buffer_Iterator& Object)const
+{
+    return m_Offset<=>Object.m_Offset;
+}
+/*****************************************
+-----    Dynamic_Circular_Buffer     -----
+*****************************************/
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Allocates a circular buffer holding Capacity elements.
+* Parameters (in)  : Capacity      - Number of elements the buffer holds before overflowing.
+*                    Policy        - What a full buffer does on push.
+*                    Buffer_Memory - Allocator providing the data block "std::pmr Supported".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Capacity is zero.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>::Dynamic_Circular_Buffer(size_t Capacity,Growth_Policy Policy,const Allocator& Buffer_Memory):
+m_Allocator{Buffer_Memory},m_Policy{Policy},m_Capacity{Capacity},m_Current_Size{},m_Head_Index{},m_Tail_Index{},m_Data{}
+{
+    /* Throw Runtime Exception Invalid Capacity */
+    if(m_Capacity==0){throw std::runtime_error("Buffer Capacity Must Be Greater Than Zero");}
+    m_Data=Allocate_Block(m_Capacity);
+}
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer (Initializer List)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Allocates a circular buffer and pushes the elements of an initializer list.
+* Parameters (in)  : Capacity      - Number of elements the buffer holds before overflowing.
+*                    Values        - An initializer list of elements to initialize the buffer.
+*                    Policy        - What a full buffer does on push.
+*                    Buffer_Memory - Allocator providing the data block "std::pmr Supported".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if the initializer list is larger than Capacity.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>::Dynamic_Circular_Buffer(size_t Capacity,const std::initializer_list<Type>& Values,Growth_Policy Policy,const Allocator& Buffer_Memory):
+Dynamic_Circular_Buffer(Capacity,Policy,Buffer_Memory)
+{
+    /* Check If Initializer Size Is Valid */
+    if(Values.size()<=m_Capacity)
+    {
+        /* Push All Elements In Initializer_List */
+        for(const Type& Value:Values){Push(Value);}
+    }
+    /* Throw Runtime Exception Invalid Initializer_List Size */
+    else{throw std::runtime_error("Buffer Initializer Out Of Range");}
+}
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer (Copy)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies another circular buffer into a new block of the same capacity.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Allocator is obtained through select_on_container_copy_construction.
+*                    - Copies the live elements only, the head lands at index zero.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>::Dynamic_Circular_Buffer(const Dynamic_Circular_Buffer& Object):
+m_Allocator{Allocator_Traits::select_on_container_copy_construction(Object.m_Allocator)},m_Policy{Object.m_Policy},
+m_Capacity{Object.m_Capacity},m_Current_Size{},m_Head_Index{},m_Tail_Index{},m_Data{}
+{
+    m_Data=Allocate_Block(m_Capacity);
+    /* Destructor Does Not Run If Constructor Throws "Clean Up Here" */
+    try{Append_Elements(Object);}
+    catch(...)
+    {
+        Release_Block();
+        throw;
+    }
+}
+/****************************************************************************************************
+* Constructor Name : Dynamic_Circular_Buffer (Move)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes over the data block of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from, left without storage.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : A buffer left without storage throws on push until Reserve or assignment gives
+*                    it a block again.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>::Dynamic_Circular_Buffer(Dynamic_Circular_Buffer&& Object)noexcept:
+m_Allocator{std::move(Object.m_Allocator)},m_Policy{Object.m_Policy},
+m_Capacity{std::exchange(Object.m_Capacity,0)},m_Current_Size{std::exchange(Object.m_Current_Size,0)},
+m_Head_Index{std::exchange(Object.m_Head_Index,0)},m_Tail_Index{std::exchange(Object.m_Tail_Index,0)},m_Data{std::exchange(Object.m_Data,nullptr)}
+{}
+/****************************************************************************************************
+* Function Name    : operator= (Copy)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with a copy of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to copy.
+* Parameters (out) : None
+* Return value     : Dynamic_Circular_Buffer<Type, Allocator>& - This buffer.
+* Notes            : - Allocator follows propagate_on_container_copy_assignment.
+*                    - Capacity and policy follow Object, the block is kept when nothing changes.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>& Dynamic_Circular_Buffer<Type, Allocator>::operator=(const Dynamic_Circular_Buffer& Object)
+{
+    if(this!=&Object)
+    {
+        constexpr bool PROPAGATE{Allocator_Traits::propagate_on_container_copy_assignment::value};
+        /* Drop Current Elements, Block Goes Back Only If It Cannot Be Reused */
+        Destroy_Elements(m_Head_Index,m_Current_Size);
+        m_Current_Size=m_Head_Index=m_Tail_Index=0;
+        if((m_Capacity!=Object.m_Capacity)||(PROPAGATE&&!(m_Allocator==Object.m_Allocator))){Release_Block();}
+        if constexpr(PROPAGATE){m_Allocator=Object.m_Allocator;}
+        if(!m_Data)
+        {
+            m_Data=Allocate_Block(Object.m_Capacity);
+            m_Capacity=Object.m_Capacity;
+        }
+        m_Policy=Object.m_Policy;
+        Append_Elements(Object);
+    }
+    return *this;
+}
+/****************************************************************************************************
+* Function Name    : operator= (Move)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Replaces the contents with the elements of another circular buffer.
+* Parameters (in)  : Object - The circular buffer to move from.
+* Parameters (out) : None
+* Return value     : Dynamic_Circular_Buffer<Type, Allocator>& - This buffer.
+* Notes            : - Takes over the block when the allocator propagates or both compare equal,
+*                      Object is then left without storage.
+*                    - Otherwise moves element by element into a block of this allocator, Object
+*                      keeps its block and is left empty.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>& Dynamic_Circular_Buffer<Type, Allocator>::operator=(Dynamic_Circular_Buffer&& Object)noexcept(Allocator_Traits::propagate_on_container_move_assignment::value||Allocator_Traits::is_always_equal::value)
+{
+    if(this!=&Object)
+    {
+        constexpr bool PROPAGATE{Allocator_Traits::propagate_on_container_move_assignment::value};
+        Release_Block();
+        m_Policy=Object.m_Policy;
+        /* Block Can Be Freed By Our Allocator "Take It Over" */
+        if(PROPAGATE||Allocator_Traits::is_always_equal::value||(m_Allocator==Object.m_Allocator))
+        {
+            if constexpr(PROPAGATE){m_Allocator=std::move(Object.m_Allocator);}
+            m_Capacity=std::exchange(Object.m_Capacity,0);
+            m_Current_Size=std::exchange(Object.m_Current_Size,0);
+            m_Head_Index=std::exchange(Object.m_Head_Index,0);
+            m_Tail_Index=std::exchange(Object.m_Tail_Index,0);
+            m_Data=std::exchange(Object.m_Data,nullptr);
+        }
+        /* Unequal Allocators "Move Element By Element Into Our Own Block" */
+        else
+        {
+            m_Data=Allocate_Block(Object.m_Capacity);
+            m_Capacity=Object.m_Capacity;
+            Append_Elements(std::move(Object));
+            Object.Destroy_Elements(Object.m_Head_Index,Object.m_Current_Size);
+            Object.m_Current_Size=Object.m_Head_Index=Object.m_Tail_Index=0;
+        }
+    }
+    return *this;
+}
+/****************************************************************************************************
+* Function Name    : ~Dynamic_Circular_Buffer (Destructor)
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys the live elements and returns the data block to the allocator.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Free slots were never constructed.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Dynamic_Circular_Buffer<Type, Allocator>::~Dynamic_Circular_Buffer()
+{
+    Release_Block();
+}
+/****************************************************************************************************
+* Function Name    : operator==
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Overloaded equality operator for comparing two circular buffers.
+* Parameters (in)  : Object - The circular buffer to compare with.
+* Parameters (out) : None
+* Return value     : bool - True if both hold the same elements in the same order.
+* Notes            : Compares contents only, capacities and wrap points may differ.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+bool Dynamic_Circular_Buffer<Type, Allocator>::operator==(const Dynamic_Circular_Buffer& Object)const
+{
+    if(Object.m_Current_Size!=m_Current_Size){return false;}
+    for(size_t Counter{},Index{m_Head_Index},Object_Index{Object.m_Head_Index};Counter<m_Current_Size;Counter++)
+    {
+        if(!(m_Data[Index]==Object.m_Data[Object_Index])){return false;}
+        Index=Next_Index(Index);
+        Object_Index=Object.Next_Index(Object_Index);
+    }
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Head
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the head of the buffer.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+const Type& Dynamic_Circular_Buffer<Type, Allocator>::Head(void)const
+{
+    /* Buffer Is Empty */
+    if(Is_Empty()){throw std::runtime_error("Buffer Is Empty !");}
+    return m_Data[m_Head_Index];
+}
+/****************************************************************************************************
+* Function Name    : Tail
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the element at the tail of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element at the tail of the buffer.
+* Notes            : - Tail slot is the next one to be written, it only holds a live element "The
+*                      Oldest One" when the buffer is full.
+*                    - Throws a runtime error if the buffer is not full.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+const Type& Dynamic_Circular_Buffer<Type, Allocator>::Tail(void)const
+{
+    /* Tail Slot Is Free Unless Buffer Is Full */
+    if((m_Current_Size!=m_Capacity)||!m_Data){throw std::runtime_error("Buffer Is Not Full !");}
+    return m_Data[m_Tail_Index];
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Overwrite policy moves the head when full "Same As Circular_Buffer".
+*                    - Grow policy doubles the capacity when full instead.
+*                    - Throws a runtime error if the buffer has no storage "Moved From".
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Push(const Type& Element)
+{
+    Store(Element);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves a new element into the circular buffer.
+* Parameters (in)  : Element - The element to be moved into the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Same overflow behaviour as the copying Push.
+*                    - Works with move-only types.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Push(Type&& Element)
+{
+    Store(std::move(Element));
+}
+/****************************************************************************************************
+* Function Name    : Emplace
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs a new element in place at the tail of the circular buffer.
+* Parameters (in)  : Arguments - Arguments forwarded to the constructor of Type.
+* Parameters (out) : None
+* Return value     : Type& - Reference to the new element.
+* Notes            : - Constructs directly in the free slot, no temporary is made.
+*                    - On a full buffer a temporary is built first "Arguments May Refer To The Oldest
+*                      Element" then handled like Push.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <typename... Arguments_Type>
+Type& Dynamic_Circular_Buffer<Type, Allocator>::Emplace(Arguments_Type&&... Arguments)
+{
+    Check_Storage();
+    /* Buffer Full "Build Before Overwriting Or Growing" */
+    if(m_Current_Size==m_Capacity){Store(Type(std::forward<Arguments_Type>(Arguments)...));}
+    /* Construct New Element Directly In Free Slot */
+    else
+    {
+        Allocator_Traits::construct(m_Allocator,m_Data+m_Tail_Index,std::forward<Arguments_Type>(Arguments)...);
+        m_Current_Size++;
+        m_Tail_Index=Next_Index(m_Tail_Index);
+    }
+    /* New Element Sits Just Before Tail */
+    return m_Data[(m_Tail_Index==0)?(m_Capacity-1):(m_Tail_Index-1)];
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the element from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - The element removed from the buffer.
+* Notes            : - Moves the element out, Type needs no default constructor.
+*                    - Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Type Dynamic_Circular_Buffer<Type, Allocator>::Pop(void)
+{
+    /* Buffer Is Empty */
+    if(Is_Empty()){throw std::runtime_error("Buffer Is Empty !");}
+    /* Return Data From Head */
+    Type Return_Data{std::move(m_Data[m_Head_Index])};
+    Allocator_Traits::destroy(m_Allocator,m_Data+m_Head_Index);
+    /* Update Current Size And Next Head */
+    m_Current_Size--;
+    m_Head_Index=Next_Index(m_Head_Index);
+    return Return_Data;
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Moves the element at the head of the circular buffer out.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer by move assignment.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : Never throws on an empty buffer "Polling Friendly".
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+bool Dynamic_Circular_Buffer<Type, Allocator>::Pop(Type& Element)
+{
+    /* Buffer Is Empty */
+    if(Is_Empty()){return false;}
+    /* Move Data Out Of Head */
+    Element=std::move(m_Data[m_Head_Index]);
+    Allocator_Traits::destroy(m_Allocator,m_Data+m_Head_Index);
+    /* Update Current Size And Next Head */
+    m_Current_Size--;
+    m_Head_Index=Next_Index(m_Head_Index);
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a batch of elements into the circular buffer.
+* Parameters (in)  : Elements - Contiguous elements to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements taken from Elements.
+* Notes            : - Copies in at most two contiguous segments around the wrap point.
+*                    - Grow policy reserves room for the whole batch first, Overwrite policy drops
+*                      the oldest elements.
+*                    - Throws a runtime error if the buffer has no storage "Moved From".
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+size_t Dynamic_Circular_Buffer<Type, Allocator>::Push_N(std::span<const Type> Elements)
+{
+    Check_Storage();
+    const size_t Total_Elements{Elements.size()};
+    /* Make Room For The Whole Batch Instead Of Overwriting */
+    if((m_Policy==Growth_Policy::Grow)&&(m_Current_Size+Total_Elements>m_Capacity))
+    {
+        Reserve(std::max(2*m_Capacity,m_Current_Size+Total_Elements));
+    }
+    /* Drop Oldest Elements The Batch Overwrites "Care About Head Overflow" */
+    if(m_Current_Size+Total_Elements>m_Capacity)
+    {
+        const size_t Overwritten{std::min(m_Current_Size,m_Current_Size+Total_Elements-m_Capacity)};
+        Destroy_Elements(m_Head_Index,Overwritten);
+        m_Head_Index=Next_Index(m_Head_Index,Overwritten);
+        m_Current_Size-=Overwritten;
+    }
+    /* Elements That Would Be Overwritten In The Same Batch Are Skipped */
+    if(Total_Elements>m_Capacity)
+    {
+        m_Tail_Index=Next_Index(m_Tail_Index,(Total_Elements-m_Capacity)%m_Capacity);
+        m_Head_Index=m_Tail_Index;
+        Elements=Elements.last(m_Capacity);
+    }
+    /* Copy First Segment Up To Wrap Point Then The Rest From Start "Size Follows Each Segment" */
+    const size_t First_Segment{std::min(Elements.size(),m_Capacity-m_Tail_Index)};
+    Construct_Elements(m_Data+m_Tail_Index,Elements.data(),First_Segment);
+    m_Tail_Index=Next_Index(m_Tail_Index,First_Segment);
+    m_Current_Size+=First_Segment;
+    Construct_Elements(m_Data,Elements.data()+First_Segment,Elements.size()-First_Segment);
+    m_Tail_Index=Next_Index(m_Tail_Index,Elements.size()-First_Segment);
+    m_Current_Size+=Elements.size()-First_Segment;
+    return Total_Elements;
+}
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes a batch of elements from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the removed elements in order.
+* Return value     : size_t - Number of elements removed "Smaller Of Size And Elements Size".
+* Notes            : Copies out in at most two contiguous segments around the wrap point.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+size_t Dynamic_Circular_Buffer<Type, Allocator>::Pop_N(std::span<Type> Elements)
+{
+    const size_t Total_Elements{std::min(Elements.size(),m_Current_Size)};
+    /* Copy First Segment Up To Wrap Point Then The Rest From Start */
+    const size_t First_Segment{std::min(Total_Elements,m_Capacity-m_Head_Index)};
+    Move_Out_Elements(Elements.data(),m_Data+m_Head_Index,First_Segment);
+    Move_Out_Elements(Elements.data()+First_Segment,m_Data,Total_Elements-First_Segment);
+    /* Update Next Head And Current Size */
+    m_Head_Index=Next_Index(m_Head_Index,Total_Elements);
+    m_Current_Size-=Total_Elements;
+    return Total_Elements;
+}
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the occupied region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first, second span is empty unless the
+*                    occupied region wraps around the end of the storage.
+* Notes            : Views are invalidated by Reserve or by a Push that grows the buffer.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+typename Dynamic_Circular_Buffer<Type, Allocator>::Readable_Regions Dynamic_Circular_Buffer<Type, Allocator>::Readable_Spans(void)const
+{
+    const size_t First_Segment{std::min(m_Current_Size,m_Capacity-m_Head_Index)};
+    return Readable_Regions{std::span<const Type>(m_Data+m_Head_Index,First_Segment),
+                            std::span<const Type>(m_Data,m_Current_Size-First_Segment)};
+}
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the free region of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order, second span is empty unless the
+*                    free region wraps around the end of the storage.
+* Notes            : - Data written into the spans becomes visible after Commit_Write.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+typename Dynamic_Circular_Buffer<Type, Allocator>::Writable_Regions Dynamic_Circular_Buffer<Type, Allocator>::Writable_Spans(void)requires std::is_trivially_copyable_v<Type>
+{
+    const size_t Free_Slots{m_Capacity-m_Current_Size};
+    const size_t First_Segment{std::min(Free_Slots,m_Capacity-m_Tail_Index)};
+    return Writable_Regions{std::span<Type>(m_Data+m_Tail_Index,First_Segment),
+                            std::span<Type>(m_Data,Free_Slots-First_Segment)};
+}
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases elements consumed through Readable_Spans.
+* Parameters (in)  : Count - Number of elements consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the current size.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Commit_Read(size_t Count)
+{
+    if(Count<=m_Current_Size)
+    {
+        /* Consumed Elements Leave The Buffer */
+        Destroy_Elements(m_Head_Index,Count);
+        /* Update Next Head And Current Size */
+        m_Head_Index=Next_Index(m_Head_Index,Count);
+        m_Current_Size-=Count;
+    }
+    else{throw std::runtime_error("Commit Read Out Of Range");}
+}
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes elements written through Writable_Spans.
+* Parameters (in)  : Count - Number of elements written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the free space.
+*                    - Only for trivially copyable types, free slots hold no constructed objects.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Commit_Write(size_t Count)requires std::is_trivially_copyable_v<Type>
+{
+    if(Count<=m_Capacity-m_Current_Size)
+    {
+        /* Update Next Tail And Current Size */
+        m_Tail_Index=Next_Index(m_Tail_Index,Count);
+        m_Current_Size+=Count;
+    }
+    else{throw std::runtime_error("Commit Write Out Of Range");}
+}
+/****************************************************************************************************
+* Function Name    : Reserve
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Grows the capacity of the circular buffer.
+* Parameters (in)  : New_Capacity - Requested number of slots.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Does nothing if New_Capacity is not larger than the current capacity.
+*                    - Relinearizes the contents so the head lands at the start of the new block.
+*                    - Gives a buffer left without storage "Moved From" a new block.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Reserve(size_t New_Capacity)
+{
+    if(New_Capacity>m_Capacity){Relinearize(New_Capacity);}
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current size of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+size_t Dynamic_Circular_Buffer<Type, Allocator>::Size(void)const
+{
+    return m_Current_Size;
+}
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the number of elements the circular buffer holds before overflowing.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current capacity of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+size_t Dynamic_Circular_Buffer<Type, Allocator>::Capacity(void)const
+{
+    return m_Capacity;
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+bool Dynamic_Circular_Buffer<Type, Allocator>::Is_Empty(void)const
+{
+    return m_Current_Size==0;
+}
+/****************************************************************************************************
+* Function Name    : get_allocator
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a copy of the allocator providing the data block.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Allocator - The allocator in use.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Allocator Dynamic_Circular_Buffer<Type, Allocator>::get_allocator(void)const
+{
+    return m_Allocator;
+}
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns an iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::iterator Dynamic_Circular_Buffer<Type, Allocator>::begin() noexcept
+{
+    return iterator(m_Data,m_Capacity,m_Head_Index,0);
+}
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns an iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr iterator - Random access iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::iterator Dynamic_Circular_Buffer<Type, Allocator>::end() noexcept
+{
+    return iterator(m_Data,m_Capacity,m_Head_Index,static_cast<std::ptrdiff_t>(m_Current_Size));
+}
+/****************************************************************************************************
+* Function Name    : begin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_iterator Dynamic_Circular_Buffer<Type, Allocator>::begin()const noexcept
+{
+    return const_iterator(m_Data,m_Capacity,m_Head_Index,0);
+}
+/****************************************************************************************************
+* Function Name    : end
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_iterator Dynamic_Circular_Buffer<Type, Allocator>::end()const noexcept
+{
+    return const_iterator(m_Data,m_Capacity,m_Head_Index,static_cast<std::ptrdiff_t>(m_Current_Size));
+}
+/****************************************************************************************************
+* Function Name    : cbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing to the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the beginning of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_iterator Dynamic_Circular_Buffer<Type, Allocator>::cbegin()const noexcept
+{
+    return begin();
+}
+/****************************************************************************************************
+* Function Name    : cend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant iterator pointing past the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_iterator - Constant iterator pointing to the end of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_iterator Dynamic_Circular_Buffer<Type, Allocator>::cend()const noexcept
+{
+    return end();
+}
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::reverse_iterator Dynamic_Circular_Buffer<Type, Allocator>::rbegin() noexcept
+{
+    return reverse_iterator(end());
+}
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr reverse_iterator - Reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::reverse_iterator Dynamic_Circular_Buffer<Type, Allocator>::rend() noexcept
+{
+    return reverse_iterator(begin());
+}
+/****************************************************************************************************
+* Function Name    : rbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_reverse_iterator Dynamic_Circular_Buffer<Type, Allocator>::rbegin()const noexcept
+{
+    return const_reverse_iterator(end());
+}
+/****************************************************************************************************
+* Function Name    : rend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_reverse_iterator Dynamic_Circular_Buffer<Type, Allocator>::rend()const noexcept
+{
+    return const_reverse_iterator(begin());
+}
+/****************************************************************************************************
+* Function Name    : crbegin
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing to the newest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the beginning of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_reverse_iterator Dynamic_Circular_Buffer<Type, Allocator>::crbegin()const noexcept
+{
+    return rbegin();
+}
+/****************************************************************************************************
+* Function Name    : crend
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns a constant reverse iterator pointing before the oldest element of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : constexpr const_reverse_iterator - Constant reverse iterator pointing to the end of the reversed buffer.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+constexpr typename Dynamic_Circular_Buffer<Type, Allocator>::const_reverse_iterator Dynamic_Circular_Buffer<Type, Allocator>::crend()const noexcept
+{
+    return rend();
+}
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Type& Dynamic_Circular_Buffer<Type, Allocator>::At(size_t Offset)
+{
+    /* Only Live Elements Can Be Reached */
+    if(Offset>=m_Current_Size){throw std::runtime_error("Buffer Index Out Of Range");}
+    return m_Data[Next_Index(m_Head_Index,Offset)];
+}
+/****************************************************************************************************
+* Function Name    : At
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : Throws a runtime error if Offset is not smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+const Type& Dynamic_Circular_Buffer<Type, Allocator>::At(size_t Offset)const
+{
+    /* Only Live Elements Can Be Reached */
+    if(Offset>=m_Current_Size){throw std::runtime_error("Buffer Index Out Of Range");}
+    return m_Data[Next_Index(m_Head_Index,Offset)];
+}
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Type& Dynamic_Circular_Buffer<Type, Allocator>::operator[](size_t Offset)
+{
+    return m_Data[Next_Index(m_Head_Index,Offset)];
+}
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the element found a number of steps after the oldest one.
+* Parameters (in)  : Offset - Logical index, 0 is the head "Oldest Element".
+* Parameters (out) : None
+* Return value     : const Type& - Reference to the element.
+* Notes            : No bounds check, Offset must be smaller than the current size.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+const Type& Dynamic_Circular_Buffer<Type, Allocator>::operator[](size_t Offset)const
+{
+    return m_Data[Next_Index(m_Head_Index,Offset)];
+}
+/****************************************************************************************************
+* Function Name    : Next_Index
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the index found a number of steps after the given one.
+* Parameters (in)  : Index - Current index in the data block.
+*                    Count - Number of steps to move forward "Not Larger Than Capacity".
+* Parameters (out) : None
+* Return value     : size_t - Next index "Care About Overflow".
+* Notes            : Wraps with a branch, capacity is only known at run time.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+size_t Dynamic_Circular_Buffer<Type, Allocator>::Next_Index(size_t Index,size_t Count)const
+{
+    Index+=Count;
+    return (Index>=m_Capacity)?(Index-m_Capacity):Index;
+}
+/****************************************************************************************************
+* Function Name    : Store
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Copies or moves an element into the tail slot.
+* Parameters (in)  : Element - The element to be stored, forwarded as given.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Constructs into a free slot, assigns over the oldest element on overflow.
+*                    - Grow policy relinearizes into a block twice as large when full.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <typename Element_Type>
+void Dynamic_Circular_Buffer<Type, Allocator>::Store(Element_Type&& Element)
+{
+    Check_Storage();
+    if(m_Current_Size==m_Capacity)
+    {
+        /* Make Room Instead Of Overwriting */
+        if(m_Policy==Growth_Policy::Grow)
+        {
+            /* Element May Live Inside The Block About To Be Released */
+            Type Copy{std::forward<Element_Type>(Element)};
+            Relinearize(2*m_Capacity);
+            Allocator_Traits::construct(m_Allocator,m_Data+m_Tail_Index,std::move(Copy));
+            m_Current_Size++;
+        }
+        /* Oldest Element Lives In Tail Slot, Assign Over It And Move Head */
+        else
+        {
+            m_Data[m_Tail_Index]=std::forward<Element_Type>(Element);
+            m_Head_Index=Next_Index(m_Head_Index);
+        }
+    }
+    /* Appned New Element Into Free Slot */
+    else
+    {
+        Allocator_Traits::construct(m_Allocator,m_Data+m_Tail_Index,std::forward<Element_Type>(Element));
+        m_Current_Size++;
+    }
+    /* Increment Tail New Posion "Care About OverFlow" */
+    m_Tail_Index=Next_Index(m_Tail_Index);
+}
+/****************************************************************************************************
+* Function Name    : Check_Storage
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Makes sure the buffer owns a data block before writing into it.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if the buffer was left without storage "Moved From".
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Check_Storage(void)const
+{
+    if(!m_Data){throw std::runtime_error("Buffer Has No Storage !");}
+}
+/****************************************************************************************************
+* Function Name    : Relinearize
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Moves the contents into a new block with the head at index zero.
+* Parameters (in)  : New_Capacity - Number of slots in the new block "Not Smaller Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Old block is destroyed and returned to the allocator.
+*                    - Strong guarantee, a throwing move or copy releases the new block and leaves
+*                      the buffer untouched "std::move_if_noexcept".
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Relinearize(size_t New_Capacity)
+{
+    Type *New_Data{Allocate_Block(New_Capacity)};
+    size_t Constructed{};
+    try
+    {
+        /* Move Elements In Order So Head Lands At Index Zero */
+        for(size_t Index{m_Head_Index};Constructed<m_Current_Size;Constructed++)
+        {
+            Allocator_Traits::construct(m_Allocator,New_Data+Constructed,std::move_if_noexcept(m_Data[Index]));
+            Index=Next_Index(Index);
+        }
+    }
+    catch(...)
+    {
+        /* Undo Partial Construction Before Reporting */
+        while(Constructed){Allocator_Traits::destroy(m_Allocator,New_Data+(--Constructed));}
+        Allocator_Traits::deallocate(m_Allocator,New_Data,New_Capacity);
+        throw;
+    }
+    const size_t Current_Size{m_Current_Size};
+    Release_Block();
+    m_Data=New_Data;
+    m_Capacity=New_Capacity;
+    m_Current_Size=Current_Size;
+    m_Head_Index=0;
+    m_Tail_Index=(m_Current_Size==m_Capacity)?0:m_Current_Size;
+}
+/****************************************************************************************************
+* Function Name    : Append_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Constructs the live elements of another buffer after the tail in order.
+* Parameters (in)  : Object - Buffer to copy from, or to move from when passed as an rvalue.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Free space must hold every element of Object, size grows with each one so a
+*                    throwing element leaves the already constructed ones owned by the buffer.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+template <typename Buffer_Type>
+void Dynamic_Circular_Buffer<Type, Allocator>::Append_Elements(Buffer_Type&& Object)
+{
+    for(size_t Counter{},Index{Object.m_Head_Index};Counter<Object.m_Current_Size;Counter++)
+    {
+        if constexpr(std::is_lvalue_reference_v<Buffer_Type>){Allocator_Traits::construct(m_Allocator,m_Data+m_Tail_Index,Object.m_Data[Index]);}
+        else{Allocator_Traits::construct(m_Allocator,m_Data+m_Tail_Index,std::move(Object.m_Data[Index]));}
+        m_Current_Size++;
+        m_Tail_Index=Next_Index(m_Tail_Index);
+        Index=Object.Next_Index(Index);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Allocate_Block
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Allocates an uninitialized data block.
+* Parameters (in)  : Capacity - Number of slots to allocate.
+* Parameters (out) : None
+* Return value     : Type* - The new data block, null when Capacity is zero.
+* Notes            : Slots are constructed only while they hold live elements.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+Type* Dynamic_Circular_Buffer<Type, Allocator>::Allocate_Block(size_t Capacity)
+{
+    return Capacity?Allocator_Traits::allocate(m_Allocator,Capacity):nullptr;
+}
+/****************************************************************************************************
+* Function Name    : Release_Block
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Destroys the live elements and returns the data block to the allocator.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Leaves the buffer empty and without storage.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Release_Block(void)
+{
+    if(m_Data)
+    {
+        Destroy_Elements(m_Head_Index,m_Current_Size);
+        Allocator_Traits::deallocate(m_Allocator,m_Data,m_Capacity);
+    }
+    m_Data=nullptr;
+    m_Capacity=m_Current_Size=m_Head_Index=m_Tail_Index=0;
+}
+/****************************************************************************************************
+* Function Name    : Destroy_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Destroys a run of live elements starting at an index.
+* Parameters (in)  : Index - Index of the first element to destroy.
+*                    Count - Number of elements to destroy "Not Larger Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Goes through the allocator so scoped allocators see every destruction.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Destroy_Elements(size_t Index,size_t Count)
+{
+    for(size_t Counter{};Counter<Count;Counter++)
+    {
+        Allocator_Traits::destroy(m_Allocator,m_Data+Index);
+        Index=Next_Index(Index);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Construct_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Copy constructs a contiguous run of elements into free slots.
+* Parameters (in)  : Source      - First element to copy from.
+*                    Count       - Number of elements to copy.
+* Parameters (out) : Destination - First free slot to construct in.
+* Return value     : None
+* Notes            : - Uses memcpy when Type is trivially copyable.
+*                    - A throwing copy destroys the part of the run already built.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Construct_Elements(Type* Destination,const Type* Source,size_t Count)
+{
+    if constexpr(std::is_trivially_copyable_v<Type>)
+    {
+        if(Count){std::memcpy(Destination,Source,Count*sizeof(Type));}
+    }
+    else
+    {
+        size_t Constructed{};
+        try
+        {
+            for(;Constructed<Count;Constructed++){Allocator_Traits::construct(m_Allocator,Destination+Constructed,Source[Constructed]);}
+        }
+        catch(...)
+        {
+            while(Constructed){Allocator_Traits::destroy(m_Allocator,Destination+(--Constructed));}
+            throw;
+        }
+    }
+}
+/****************************************************************************************************
+* Function Name    : Move_Out_Elements
+* Class            : Dynamic_Circular_Buffer<Type, Allocator>
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Moves a contiguous run of live elements out and destroys them.
+* Parameters (in)  : Source      - First live element to move from.
+*                    Count       - Number of elements to move.
+* Parameters (out) : Destination - First element to move assign to.
+* Return value     : None
+* Notes            : Uses memcpy when Type is trivially copyable.
+*****************************************************************************************************/
+template <typename Type, typename Allocator>
+void Dynamic_Circular_Buffer<Type, Allocator>::Move_Out_Elements(Type* Destination,Type* Source,size_t Count)
+{
+    if constexpr(std::is_trivially_copyable_v<Type>)
+    {
+        if(Count){std::memcpy(Destination,Source,Count*sizeof(Type));}
+    }
+    else
+    {
+        std::move(Source,Source+Count,Destination);
+        for(size_t Counter{};Counter<Count;Counter++){Allocator_Traits::destroy(m_Allocator,Source+Counter);}
+    }
+}
+}
+/********************************************************************
+ *  END OF FILE:  Dynamic_Circular_Buffer.hpp
+********************************************************************/
+#endif
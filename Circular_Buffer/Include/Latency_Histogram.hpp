@@ -0,0 +1,188 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Latency_Histogram.hpp
+ *  Date: November 30, 2024
+ *  Description: Log bucketed histogram with bounded relative error for latency percentiles
+ *  Class Name:  Latency_Histogram
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _LATENCY_HISTOGRAM_HPP_
+#define _LATENCY_HISTOGRAM_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+--------    Latency_Histogram     --------
+*****************************************/
+class Latency_Histogram
+{
+public:
+    /* Values Below 2^SUB_BUCKET_BITS Are Exact, Every Octave Above Is Split Into 2^(SUB_BUCKET_BITS-1) Buckets */
+    static constexpr size_t SUB_BUCKET_BITS{7};
+    static constexpr size_t SUB_BUCKET_COUNT{size_t{1}<<SUB_BUCKET_BITS};
+    static constexpr size_t HALF_SUB_BUCKET_COUNT{SUB_BUCKET_COUNT/2};
+    /* Linear Buckets Then One Group Per Octave Up To 2^64 */
+    static constexpr size_t BUCKET_COUNT{SUB_BUCKET_COUNT+(64-SUB_BUCKET_BITS)*HALF_SUB_BUCKET_COUNT};
+/****************************************************************************************************
+* Constructor Name : Latency_Histogram
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Latency_Histogram class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Allocates every bucket up front so Record never allocates.
+*****************************************************************************************************/
+Latency_Histogram();
+/****************************************************************************************************
+* Function Name    : Record
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts one value.
+* Parameters (in)  : Value - Value to count, usually a latency in nanoseconds.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Constant time, a bit scan and a shift "No Floating Point".
+*****************************************************************************************************/
+void Record(uint64_t Value);
+/****************************************************************************************************
+* Function Name    : Merge
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds the counts of another histogram to this one.
+* Parameters (in)  : Object - Histogram to add, usually filled by another thread.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Merge(const Latency_Histogram& Object);
+/****************************************************************************************************
+* Function Name    : Percentile
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the value below which a given share of the recorded values fall.
+* Parameters (in)  : Percent - Share of values in percent, 50 for the median.
+* Parameters (out) : None
+* Return value     : uint64_t - Highest value equivalent to the bucket holding the percentile.
+* Notes            : - Relative error is below 2^(1-SUB_BUCKET_BITS) "Under 1.6%".
+*                    - Never larger than Max, zero when nothing was recorded.
+*****************************************************************************************************/
+uint64_t Percentile(double Percent)const;
+/****************************************************************************************************
+* Function Name    : Count
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of recorded values.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Number of recorded values.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Count(void)const;
+/****************************************************************************************************
+* Function Name    : Min
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the smallest recorded value.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Exact smallest value, zero when nothing was recorded.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Min(void)const;
+/****************************************************************************************************
+* Function Name    : Max
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the largest recorded value.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Exact largest value, zero when nothing was recorded.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Max(void)const;
+/****************************************************************************************************
+* Function Name    : Mean
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the average of the recorded values.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Exact average, zero when nothing was recorded.
+* Notes            : None
+*****************************************************************************************************/
+double Mean(void)const;
+/****************************************************************************************************
+* Function Name    : Reset
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Forgets every recorded value.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Keeps the buckets allocated.
+*****************************************************************************************************/
+void Reset(void);
+private:
+/****************************************************************************************************
+* Function Name    : Bucket_Index
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the bucket counting a value.
+* Parameters (in)  : Value - Value to place.
+* Parameters (out) : None
+* Return value     : size_t - Index inside the bucket array.
+* Notes            : None
+*****************************************************************************************************/
+static size_t Bucket_Index(uint64_t Value);
+/****************************************************************************************************
+* Function Name    : Highest_Equivalent_Value
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the largest value that falls in a bucket.
+* Parameters (in)  : Index - Index inside the bucket array.
+* Parameters (out) : None
+* Return value     : uint64_t - Upper bound of the bucket "Inclusive".
+* Notes            : None
+*****************************************************************************************************/
+static uint64_t Highest_Equivalent_Value(size_t Index);
+private:
+    /* Number Of Values Per Bucket */
+    std::vector<uint64_t> m_Counts{};
+    /* Number Of Recorded Values */
+    uint64_t m_Total_Count{};
+    /* Exact Smallest Value Recorded */
+    uint64_t m_Min{};
+    /* Exact Largest Value Recorded */
+    uint64_t m_Max{};
+    /* Exact Sum For Mean "Floating Point So Long Runs Never Overflow" */
+    double m_Sum{};
+};
+}
+/********************************************************************
+ *  END OF FILE:  Latency_Histogram.hpp
+********************************************************************/
+#endif
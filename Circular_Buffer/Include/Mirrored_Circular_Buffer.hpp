@@ -0,0 +1,272 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Mirrored_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Byte ring whose storage is mapped twice back to back so every region is contiguous
+ *  Class Name:  Mirrored_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _MIRRORED_CIRCULAR_BUFFER_HPP_
+#define _MIRRORED_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+-----    Mirrored_Circular_Buffer     ----
+*****************************************/
+class Mirrored_Circular_Buffer
+{
+public:
+    /* Same Region Types As Circular_Buffer, Second Span Is Always Empty */
+    using Readable_Regions=std::array<std::span<const uint8_t>,2>;
+    using Writable_Regions=std::array<std::span<uint8_t>,2>;
+/****************************************************************************************************
+* Constructor Name : Mirrored_Circular_Buffer
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Allocates the byte ring and maps its pages twice back to back.
+* Parameters (in)  : Minimum_Capacity - Requested capacity in bytes.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Capacity is rounded up to a whole number of pages.
+*                    - Throws a runtime error if the memfd or any mapping cannot be created.
+*****************************************************************************************************/
+explicit Mirrored_Circular_Buffer(size_t Minimum_Capacity);
+/****************************************************************************************************
+* Function Name    : ~Mirrored_Circular_Buffer (Destructor)
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Mirrored_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Unmaps both views of the storage.
+*****************************************************************************************************/
+~Mirrored_Circular_Buffer();
+/* Owns A Mapping "Not Copyable" */
+Mirrored_Circular_Buffer(const Mirrored_Circular_Buffer&)=delete;
+Mirrored_Circular_Buffer& operator=(const Mirrored_Circular_Buffer&)=delete;
+/****************************************************************************************************
+* Function Name    : Head
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the byte at the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const uint8_t& - Reference to the byte at the head of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+const uint8_t& Head(void)const;
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new byte into the circular buffer.
+* Parameters (in)  : Element - The byte to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Overwrites the oldest byte when the buffer is full "Same As Circular_Buffer".
+*****************************************************************************************************/
+void Push(uint8_t Element);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the byte from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint8_t - The byte removed from the buffer.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+uint8_t Pop(void);
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a batch of bytes into the circular buffer.
+* Parameters (in)  : Elements - Contiguous bytes to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of bytes taken from Elements.
+* Notes            : Single memcpy thanks to the mirror, overwrites the oldest bytes on overflow.
+*****************************************************************************************************/
+size_t Push_N(std::span<const uint8_t> Elements);
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes a batch of bytes from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the removed bytes in order.
+* Return value     : size_t - Number of bytes removed "Smaller Of Size And Elements Size".
+* Notes            : Single memcpy thanks to the mirror, never throws.
+*****************************************************************************************************/
+size_t Pop_N(std::span<uint8_t> Elements);
+/****************************************************************************************************
+* Function Name    : Readable_Span
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns one contiguous view over every occupied byte.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::span<const uint8_t> - Oldest byte first, never split at the wrap point.
+* Notes            : Parsers can run straight over the view, call Commit_Read when done.
+*****************************************************************************************************/
+std::span<const uint8_t> Readable_Span(void)const;
+/****************************************************************************************************
+* Function Name    : Writable_Span
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns one contiguous view over every free byte.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::span<uint8_t> - Free bytes in push order, never split at the wrap point.
+* Notes            : Data written into the view becomes visible after Commit_Write.
+*****************************************************************************************************/
+std::span<uint8_t> Writable_Span(void);
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Circular_Buffer compatible form of Readable_Span.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Whole occupied region first, second span always empty.
+* Notes            : None
+*****************************************************************************************************/
+Readable_Regions Readable_Spans(void)const;
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Circular_Buffer compatible form of Writable_Span.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Whole free region first, second span always empty.
+* Notes            : None
+*****************************************************************************************************/
+Writable_Regions Writable_Spans(void);
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases bytes consumed through Readable_Span.
+* Parameters (in)  : Count - Number of bytes consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the current size.
+*****************************************************************************************************/
+void Commit_Read(size_t Count);
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes bytes written through Writable_Span.
+* Parameters (in)  : Count - Number of bytes written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the free space.
+*****************************************************************************************************/
+void Commit_Write(size_t Count);
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Mirrored_Circular_Buffer
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current number of bytes in the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Mirrored_Circular_Buffer
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the total number of bytes the circular buffer can hold.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Capacity after rounding up to whole pages.
+* Notes            : None
+*****************************************************************************************************/
+size_t Capacity(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Mirrored_Circular_Buffer
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Tail_Index
+* Class            : Mirrored_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the index of the next byte to push in.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Tail index inside the first view.
+* Notes            : None
+*****************************************************************************************************/
+size_t Tail_Index(void)const;
+/****************************************************************************************************
+* Function Name    : Advance_Head
+* Class            : Mirrored_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Drops bytes from the head.
+* Parameters (in)  : Count - Number of bytes to drop "Not Larger Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Advance_Head(size_t Count);
+private:
+    /* Total Bytes Storage Can Hold "Multiple Of Page Size" */
+    size_t m_Capacity{};
+    /* Total Size Of Current Bytes In Buffer */
+    size_t m_Current_Size{};
+    /* Index Of Head To Pop From "Always Inside First View" */
+    size_t m_Head_Index{};
+    /* Start Of First View, Second View Follows At m_Data+m_Capacity */
+    uint8_t *m_Data{};
+};
+}
+/********************************************************************
+ *  END OF FILE:  Mirrored_Circular_Buffer.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,447 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Object_Pool.hpp
+ *  Date: November 30, 2024
+ *  Description: Fixed capacity object pool whose free list is a circular buffer of slot indices
+ *  Class Name:  Object_Pool
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _OBJECT_POOL_HPP_
+#define _OBJECT_POOL_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Which Threads May Use The Pool */
+enum class Pool_Concurrency
+{
+    /* One Thread At A Time, Free List Is A Reject Policy Circular_Buffer */
+    Single_Thread,
+    /* Any Thread, Free List Is An MPMC_Circular_Buffer */
+    Lock_Free
+};
+/* Names One Pooled Object, Small And Trivially Copyable So It Travels Through Any Buffer */
+struct Pool_Handle
+{
+    /* Slot Holding The Object */
+    uint32_t m_Index{};
+    /* Slot Generation When Acquired "Odd While Live, Zero Never Matches" */
+    uint32_t m_Generation{};
+    friend bool operator==(const Pool_Handle&,const Pool_Handle&)=default;
+};
+/*****************************************
+----------    Object_Pool     ------------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=64,Pool_Concurrency CONCURRENCY=Pool_Concurrency::Single_Thread>
+class Object_Pool
+{
+static_assert(TOTAL_SIZE>1,"Object_Pool Size Must Be Greater Than One");
+static_assert(TOTAL_SIZE<=std::numeric_limits<uint32_t>::max(),"Object_Pool Indices Must Fit In A Pool_Handle");
+public:
+/****************************************************************************************************
+* Constructor Name : Object_Pool
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Object_Pool class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Storage is reserved inline, no object is constructed until acquired.
+*****************************************************************************************************/
+Object_Pool();
+Object_Pool(const Object_Pool&)=delete;
+Object_Pool& operator=(const Object_Pool&)=delete;
+/****************************************************************************************************
+* Destructor Name  : ~Object_Pool
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys every object still acquired.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : No other thread may use the pool anymore.
+*****************************************************************************************************/
+~Object_Pool();
+/****************************************************************************************************
+* Function Name    : Acquire
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes a free slot and constructs an object in it.
+* Parameters (in)  : Arguments - Forwarded to the constructor of Type.
+* Parameters (out) : None
+* Return value     : std::optional<Pool_Handle> - Handle to the object, or empty if the pool is exhausted.
+* Notes            : - O(1), one pop from the free list and no heap allocation.
+*                    - If the constructor throws the slot goes back to the free list.
+*****************************************************************************************************/
+template <typename... Arguments_Type>
+std::optional<Pool_Handle> Acquire(Arguments_Type&&... Arguments);
+/****************************************************************************************************
+* Function Name    : Release
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys the object a handle names and returns its slot to the free list.
+* Parameters (in)  : Handle - Handle returned by Acquire.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - O(1), one push to the free list.
+*                    - Throws std::runtime_error for a stale, foreign or already released handle.
+*****************************************************************************************************/
+void Release(Pool_Handle Handle);
+/****************************************************************************************************
+* Function Name    : Get
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the object a handle names.
+* Parameters (in)  : Handle - Handle returned by Acquire.
+* Parameters (out) : None
+* Return value     : Type* - The object, or nullptr if the handle is stale.
+* Notes            : The holder of a handle must not release it while another thread uses Get.
+*****************************************************************************************************/
+Type* Get(Pool_Handle Handle);
+const Type* Get(Pool_Handle Handle)const;
+/****************************************************************************************************
+* Function Name    : Is_Live
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if a handle still names an acquired object.
+* Parameters (in)  : Handle - Handle to check.
+* Parameters (out) : None
+* Return value     : bool - True if the slot was not released since the handle was acquired.
+* Notes            : Generations are 32 bit, a slot reused 2^31 times matches an old handle again.
+*****************************************************************************************************/
+bool Is_Live(Pool_Handle Handle)const;
+/****************************************************************************************************
+* Function Name    : Available
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many slots are free.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Number of free slots.
+* Notes            : Approximate while other threads use a Lock_Free pool.
+*****************************************************************************************************/
+size_t Available(void);
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many objects the pool can hold.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - TOTAL_SIZE.
+* Notes            : None
+*****************************************************************************************************/
+static constexpr size_t Capacity(void);
+private:
+/****************************************************************************************************
+* Function Name    : Take_Index
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Pops a free slot index from the free list.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<uint32_t> - Free slot, or empty if none is left.
+* Notes            : None
+*****************************************************************************************************/
+std::optional<uint32_t> Take_Index(void);
+/****************************************************************************************************
+* Function Name    : Return_Index
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Pushes a slot index back to the free list.
+* Parameters (in)  : Index - Slot no longer in use.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Never fails, the free list has room for every slot.
+*****************************************************************************************************/
+void Return_Index(uint32_t Index);
+/****************************************************************************************************
+* Function Name    : Slot
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the object living in a slot.
+* Parameters (in)  : Index - Slot index.
+* Parameters (out) : None
+* Return value     : Type* - Pointer into the contiguous storage.
+* Notes            : Only valid while the slot is acquired.
+*****************************************************************************************************/
+Type* Slot(uint32_t Index);
+private:
+    /* Free Slot Indices, Popped By Acquire And Pushed By Release */
+    using Free_List_Type=std::conditional_t<CONCURRENCY==Pool_Concurrency::Lock_Free,
+                                            MPMC_Circular_Buffer<uint32_t,TOTAL_SIZE>,
+                                            Circular_Buffer<uint32_t,TOTAL_SIZE,Overflow_Policy::Reject>>;
+    /* Raw Storage For One Object */
+    struct Object_Storage
+    {
+        alignas(Type) std::byte m_Bytes[sizeof(Type)];
+    };
+    Free_List_Type m_Free_List;
+    /* Generation Per Slot "Kept Apart So Objects Stay Contiguous" */
+    std::array<std::atomic<uint32_t>,TOTAL_SIZE> m_Generations{};
+    /* Objects Back To Back In Slot Order "Left Uninitialized Until Acquired" */
+    alignas(CACHE_LINE_SIZE) std::array<Object_Storage,TOTAL_SIZE> m_Storage;
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Object_Pool
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Object_Pool class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Storage is reserved inline, no object is constructed until acquired.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Object_Pool():
+m_Free_List{},m_Generations{}
+{
+    /* Ascending Order So Early Acquires Touch Neighbouring Slots */
+    for(uint32_t Index{};Index<TOTAL_SIZE;Index++){Return_Index(Index);}
+}
+/****************************************************************************************************
+* Destructor Name  : ~Object_Pool
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys every object still acquired.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : No other thread may use the pool anymore.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::~Object_Pool()
+{
+    if constexpr(!std::is_trivially_destructible_v<Type>)
+    {
+        for(uint32_t Index{};Index<TOTAL_SIZE;Index++)
+        {
+            if(m_Generations[Index].load(std::memory_order_acquire)&1U){std::destroy_at(Slot(Index));}
+        }
+    }
+}
+/****************************************************************************************************
+* Function Name    : Acquire
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Takes a free slot and constructs an object in it.
+* Parameters (in)  : Arguments - Forwarded to the constructor of Type.
+* Parameters (out) : None
+* Return value     : std::optional<Pool_Handle> - Handle to the object, or empty if the pool is exhausted.
+* Notes            : - O(1), one pop from the free list and no heap allocation.
+*                    - If the constructor throws the slot goes back to the free list.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+template <typename... Arguments_Type>
+std::optional<Pool_Handle> Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Acquire(Arguments_Type&&... Arguments)
+{
+    const std::optional<uint32_t> Index{Take_Index()};
+    if(!Index){return std::nullopt;}
+    try
+    {
+        std::construct_at(reinterpret_cast<Type*>(m_Storage[*Index].m_Bytes),std::forward<Arguments_Type>(Arguments)...);
+    }
+    catch(...)
+    {
+        Return_Index(*Index);
+        throw;
+    }
+    /* Popping The Index Made This Thread The Only Owner, Plain Increment Publishes The Object */
+    const uint32_t Generation{m_Generations[*Index].load(std::memory_order_relaxed)+1};
+    m_Generations[*Index].store(Generation,std::memory_order_release);
+    return Pool_Handle{*Index,Generation};
+}
+/****************************************************************************************************
+* Function Name    : Release
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destroys the object a handle names and returns its slot to the free list.
+* Parameters (in)  : Handle - Handle returned by Acquire.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - O(1), one push to the free list.
+*                    - Throws std::runtime_error for a stale, foreign or already released handle.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+void Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Release(Pool_Handle Handle)
+{
+    if(Handle.m_Index>=TOTAL_SIZE||!(Handle.m_Generation&1U)){throw std::runtime_error("Stale Pool Handle");}
+    /* Compare Exchange So Two Threads Releasing The Same Handle Cannot Both Win */
+    uint32_t Expected{Handle.m_Generation};
+    if(!m_Generations[Handle.m_Index].compare_exchange_strong(Expected,Expected+1,std::memory_order_acq_rel))
+    {
+        throw std::runtime_error("Stale Pool Handle");
+    }
+    std::destroy_at(Slot(Handle.m_Index));
+    Return_Index(Handle.m_Index);
+}
+/****************************************************************************************************
+* Function Name    : Get
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the object a handle names.
+* Parameters (in)  : Handle - Handle returned by Acquire.
+* Parameters (out) : None
+* Return value     : Type* - The object, or nullptr if the handle is stale.
+* Notes            : The holder of a handle must not release it while another thread uses Get.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+Type* Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Get(Pool_Handle Handle)
+{
+    return Is_Live(Handle)?Slot(Handle.m_Index):nullptr;
+}
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+const Type* Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Get(Pool_Handle Handle)const
+{
+    return const_cast<Object_Pool*>(this)->Get(Handle);
+}
+/****************************************************************************************************
+* Function Name    : Is_Live
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if a handle still names an acquired object.
+* Parameters (in)  : Handle - Handle to check.
+* Parameters (out) : None
+* Return value     : bool - True if the slot was not released since the handle was acquired.
+* Notes            : Generations are 32 bit, a slot reused 2^31 times matches an old handle again.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+bool Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Is_Live(Pool_Handle Handle)const
+{
+    if(Handle.m_Index>=TOTAL_SIZE||!(Handle.m_Generation&1U)){return false;}
+    return m_Generations[Handle.m_Index].load(std::memory_order_acquire)==Handle.m_Generation;
+}
+/****************************************************************************************************
+* Function Name    : Available
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many slots are free.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Number of free slots.
+* Notes            : Approximate while other threads use a Lock_Free pool.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+size_t Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Available(void)
+{
+    return m_Free_List.Size();
+}
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many objects the pool can hold.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - TOTAL_SIZE.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+constexpr size_t Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Capacity(void)
+{
+    return TOTAL_SIZE;
+}
+/****************************************************************************************************
+* Function Name    : Take_Index
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Pops a free slot index from the free list.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<uint32_t> - Free slot, or empty if none is left.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+std::optional<uint32_t> Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Take_Index(void)
+{
+    if constexpr(CONCURRENCY==Pool_Concurrency::Lock_Free)
+    {
+        uint32_t Index{};
+        if(!m_Free_List.Try_Pop(Index)){return std::nullopt;}
+        return Index;
+    }
+    else
+    {
+        return m_Free_List.Try_Pop();
+    }
+}
+/****************************************************************************************************
+* Function Name    : Return_Index
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Pushes a slot index back to the free list.
+* Parameters (in)  : Index - Slot no longer in use.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Never fails, the free list has room for every slot.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+void Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Return_Index(uint32_t Index)
+{
+    /* Each Index Is In The Free List At Most Once, Lock_Free Push Only Waits On A Popper Finishing Its Slot */
+    m_Free_List.Push(Index);
+}
+/****************************************************************************************************
+* Function Name    : Slot
+* Class            : Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the object living in a slot.
+* Parameters (in)  : Index - Slot index.
+* Parameters (out) : None
+* Return value     : Type* - Pointer into the contiguous storage.
+* Notes            : Only valid while the slot is acquired.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, Pool_Concurrency CONCURRENCY>
+Type* Object_Pool<Type, TOTAL_SIZE, CONCURRENCY>::Slot(uint32_t Index)
+{
+    return std::launder(reinterpret_cast<Type*>(m_Storage[Index].m_Bytes));
+}
+}
+/********************************************************************
+ *  END OF FILE:  Object_Pool.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,396 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Persistent_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: File backed ring log of checksummed records that keeps the newest ones across crashes
+ *  Class Name:  Persistent_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _PERSISTENT_CIRCULAR_BUFFER_HPP_
+#define _PERSISTENT_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include <span>
+#include <chrono>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* When Appended Records Are Forced From The Page Cache To The File */
+enum class Sync_Mode
+{
+    /* After Every Append Or Append_N Call */
+    Per_Batch,
+    /* On The First Append After The Interval Elapsed */
+    Periodic,
+    /* Only When Flush Is Called */
+    Manual
+};
+/* Durability Choice Given At Construction */
+struct Sync_Policy
+{
+    Sync_Mode m_Mode{Sync_Mode::Per_Batch};
+    std::chrono::milliseconds m_Interval{100};
+};
+/*****************************************
+----    Persistent_Circular_Buffer     ---
+*****************************************/
+class Persistent_Circular_Buffer
+{
+public:
+    /* Bytes Reserved For The File Header, Records Start Right After It */
+    static constexpr size_t HEADER_SIZE{4096};
+    /* Every Record Starts On This Boundary "Lets Recovery Step Through Overwritten Bytes" */
+    static constexpr size_t RECORD_ALIGNMENT{8};
+    /* Length, Checksum And Sequence In Front Of Every Payload */
+    static constexpr size_t RECORD_HEADER_SIZE{16};
+/****************************************************************************************************
+* Constructor Name : Persistent_Circular_Buffer
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Opens or creates the log file, maps it and recovers the records it holds.
+* Parameters (in)  : Path     - Log file, created when missing.
+*                    Capacity - Bytes of record storage, headers included.
+*                    Policy   - When appended records are synced to the file.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Capacity is rounded up to RECORD_ALIGNMENT.
+*                    - Recovery is one scan over the mapping, records failing their checksum
+*                      are dropped together with everything appended after them.
+*                    - Throws a runtime error if the file cannot be mapped or was created with
+*                      another capacity.
+*****************************************************************************************************/
+Persistent_Circular_Buffer(const std::string& Path,size_t Capacity,Sync_Policy Policy=Sync_Policy{});
+/****************************************************************************************************
+* Function Name    : ~Persistent_Circular_Buffer (Destructor)
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Persistent_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Flushes pending records then unmaps and closes the file.
+*****************************************************************************************************/
+~Persistent_Circular_Buffer();
+Persistent_Circular_Buffer(const Persistent_Circular_Buffer&)=delete;
+Persistent_Circular_Buffer& operator=(const Persistent_Circular_Buffer&)=delete;
+/****************************************************************************************************
+* Function Name    : Append
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Writes a record after the newest one, dropping the oldest ones it overlaps.
+* Parameters (in)  : Record - Payload bytes, fixed size records simply pass the same length.
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence number given to the record.
+* Notes            : Throws a runtime error if the record can never fit the storage.
+*****************************************************************************************************/
+uint64_t Append(std::span<const uint8_t> Record);
+/****************************************************************************************************
+* Function Name    : Append_N
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Writes several records in order and syncs them once as one batch.
+* Parameters (in)  : Records - Payloads to be appended.
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence number of the first record of the batch.
+* Notes            : Throws a runtime error before writing anything if a record can never fit.
+*****************************************************************************************************/
+uint64_t Append_N(std::span<const std::span<const uint8_t>> Records);
+/****************************************************************************************************
+* Function Name    : For_Each
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Visits every record held, oldest first.
+* Parameters (in)  : Visitor - Callable taking (uint64_t Sequence, std::span<const uint8_t> Record).
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Records are views into the mapping, valid until the next append.
+*****************************************************************************************************/
+template <typename Visitor>
+void For_Each(Visitor&& Visit)const;
+/****************************************************************************************************
+* Function Name    : Flush
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Writes every record appended since the last sync to the file.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if msync fails.
+*****************************************************************************************************/
+void Flush(void);
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of records held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Records between First_Sequence and Next_Sequence.
+* Notes            : None
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the log holds no record.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the log is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the bytes of record storage.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Storage after rounding, headers included.
+* Notes            : None
+*****************************************************************************************************/
+size_t Capacity(void)const;
+/****************************************************************************************************
+* Function Name    : First_Sequence
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sequence number of the oldest record held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Equal to Next_Sequence when the log is empty.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t First_Sequence(void)const;
+/****************************************************************************************************
+* Function Name    : Next_Sequence
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sequence number the next appended record gets.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence numbers start at one and survive reopening.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Next_Sequence(void)const;
+private:
+    /* Layout Of The Bytes In Front Of Every Payload */
+    struct Record_Header
+    {
+        /* Payload Bytes, WRAP_MARKER Means The Next Record Starts At Offset Zero */
+        uint32_t m_Length;
+        /* CRC-32C Over Length, Sequence And Payload */
+        uint32_t m_Checksum;
+        /* Consecutive Over The Whole Log, Zero Is Never Used */
+        uint64_t m_Sequence;
+    };
+    static_assert(sizeof(Record_Header)==RECORD_HEADER_SIZE,"Record Header Layout Must Stay Fixed On Disk");
+    static constexpr uint32_t WRAP_MARKER{0xFFFFFFFFu};
+    /* How A Walk Along Consecutive Records Came To An End */
+    enum class Walk_End
+    {
+        Invalid,
+        Marker,
+        Storage_End
+    };
+    /* Records Found By One Walk */
+    struct Walk_Result
+    {
+        size_t m_End{};
+        size_t m_Count{};
+        uint64_t m_First_Sequence{};
+        uint64_t m_Next_Sequence{};
+        Walk_End m_Reason{Walk_End::Invalid};
+    };
+/****************************************************************************************************
+* Function Name    : Recover
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Finds the oldest record, the newest one and the append position in the mapping.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Newest records run from offset zero up to the append position.
+*                    - Older ones are the first chain after it that reaches the end of the storage
+*                      and continues with the sequence found at offset zero.
+*****************************************************************************************************/
+void Recover(void);
+/****************************************************************************************************
+* Function Name    : Walk
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Follows valid records with consecutive sequence numbers from an offset.
+* Parameters (in)  : Offset - Where the first record should start.
+* Parameters (out) : None
+* Return value     : Walk_Result - End of the last valid record and why the walk stopped.
+* Notes            : None
+*****************************************************************************************************/
+Walk_Result Walk(size_t Offset)const;
+/****************************************************************************************************
+* Function Name    : Read_Record
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Checks the record at an offset.
+* Parameters (in)  : Offset   - Where the record should start.
+*                    Sequence - Sequence the record must carry, zero accepts any.
+* Parameters (out) : None
+* Return value     : const Record_Header* - The record, nullptr if it is torn or does not fit.
+* Notes            : Wrap markers are returned as records too.
+*****************************************************************************************************/
+const Record_Header* Read_Record(size_t Offset,uint64_t Sequence)const;
+/****************************************************************************************************
+* Function Name    : Write_Record
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Places one record at the append position, wrapping and dropping as needed.
+* Parameters (in)  : Record - Payload bytes "Already Checked To Fit".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Write_Record(std::span<const uint8_t> Record);
+/****************************************************************************************************
+* Function Name    : Drop_Overlapping
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Drops the oldest records while they start inside a range about to be written.
+* Parameters (in)  : Begin - First storage offset to be written.
+*                    End   - Storage offset after the last byte to be written.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Drop_Overlapping(size_t Begin,size_t End);
+/****************************************************************************************************
+* Function Name    : Next_Offset
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns where the record after the one at an offset starts.
+* Parameters (in)  : Offset - Start of a valid record.
+* Parameters (out) : None
+* Return value     : size_t - Start of the following record, zero after a wrap.
+* Notes            : None
+*****************************************************************************************************/
+size_t Next_Offset(size_t Offset)const;
+/****************************************************************************************************
+* Function Name    : Mark_Dirty
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Extends the range the next sync has to write.
+* Parameters (in)  : Begin - First storage offset written.
+*                    End   - Storage offset after the last byte written.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Mark_Dirty(size_t Begin,size_t End);
+/****************************************************************************************************
+* Function Name    : Apply_Policy
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Syncs after a batch when the policy asks for it.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Apply_Policy(void);
+/****************************************************************************************************
+* Function Name    : Record_Span
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the bytes a record of a given payload length takes in the storage.
+* Parameters (in)  : Length - Payload bytes.
+* Parameters (out) : None
+* Return value     : size_t - Header and payload rounded up to RECORD_ALIGNMENT.
+* Notes            : None
+*****************************************************************************************************/
+static size_t Record_Span(size_t Length);
+private:
+    /* Durability Choice */
+    Sync_Policy m_Policy{};
+    /* Log File Descriptor */
+    int m_File_Descriptor{-1};
+    /* Whole File Mapping, Header First */
+    uint8_t *m_Mapping{};
+    /* Record Storage Inside The Mapping */
+    uint8_t *m_Data{};
+    /* Bytes Of Record Storage */
+    size_t m_Capacity{};
+    /* Storage Offset Of The Oldest Record */
+    size_t m_Head_Offset{};
+    /* Storage Offset The Next Record Is Written At */
+    size_t m_Tail_Offset{};
+    /* Records Held */
+    size_t m_Count{};
+    /* Sequence Of The Oldest Record */
+    uint64_t m_First_Sequence{1};
+    /* Sequence Given To The Next Record */
+    uint64_t m_Next_Sequence{1};
+    /* Storage Range Written Since The Last Sync, Empty When Begin Equals End */
+    size_t m_Dirty_Begin{};
+    size_t m_Dirty_End{};
+    /* Time Of The Last Sync For The Periodic Policy */
+    std::chrono::steady_clock::time_point m_Last_Sync{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Function Name    : For_Each
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Visits every record held, oldest first.
+* Parameters (in)  : Visitor - Callable taking (uint64_t Sequence, std::span<const uint8_t> Record).
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Records are views into the mapping, valid until the next append.
+*****************************************************************************************************/
+template <typename Visitor>
+void Persistent_Circular_Buffer::For_Each(Visitor&& Visit)const
+{
+    size_t Offset{m_Head_Offset};
+    for(size_t Counter{};Counter<m_Count;Counter++)
+    {
+        const auto *Header{reinterpret_cast<const Record_Header*>(m_Data+Offset)};
+        Visit(Header->m_Sequence,std::span<const uint8_t>(m_Data+Offset+RECORD_HEADER_SIZE,Header->m_Length));
+        Offset=Next_Offset(Offset);
+    }
+}
+}
+/********************************************************************
+ *  END OF FILE:  Persistent_Circular_Buffer.hpp
+********************************************************************/
+#endif
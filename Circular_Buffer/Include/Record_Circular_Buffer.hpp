@@ -0,0 +1,463 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Record_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Single producer single consumer byte ring packing variable length records in place
+ *  Class Name:  Record_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _RECORD_CIRCULAR_BUFFER_HPP_
+#define _RECORD_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <span>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+-----    Record_Circular_Buffer     ------
+*****************************************/
+template <size_t TOTAL_SIZE=4096>
+class Record_Circular_Buffer
+{
+static_assert((TOTAL_SIZE&(TOTAL_SIZE-1))==0,"Record_Circular_Buffer Size Must Be A Power Of Two");
+static_assert(TOTAL_SIZE>=16,"Record_Circular_Buffer Must Hold At Least One Header And One Record");
+static_assert(TOTAL_SIZE<=0xFFFFFFFFull,"Record_Circular_Buffer Length Prefix Is 32 Bits");
+public:
+    /* Length Prefix In Front Of Every Payload, Padded So Payloads Stay 8 Byte Aligned */
+    static constexpr size_t RECORD_HEADER_SIZE{8};
+    /* Every Record Starts On This Boundary */
+    static constexpr size_t RECORD_ALIGNMENT{8};
+    /* Largest Payload A Single Record Can Carry */
+    static constexpr size_t MAX_RECORD_SIZE{TOTAL_SIZE-RECORD_HEADER_SIZE};
+/****************************************************************************************************
+* Constructor Name : Record_Circular_Buffer
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Record_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes an empty byte ring.
+*****************************************************************************************************/
+Record_Circular_Buffer();
+Record_Circular_Buffer(const Record_Circular_Buffer&)=delete;
+Record_Circular_Buffer& operator=(const Record_Circular_Buffer&)=delete;
+/****************************************************************************************************
+* Function Name    : Reserve
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Hands out contiguous room for the payload of the next record.
+* Parameters (in)  : Length - Payload bytes to be written.
+* Parameters (out) : None
+* Return value     : std::optional<std::span<uint8_t>> - Payload room inside the ring, empty when
+*                    there is not enough free space yet.
+* Notes            : - Producer only, the record stays invisible until Commit.
+*                    - A record that does not fit before the end of the storage starts over at
+*                      offset zero, a wrap marker tells the consumer to skip the rest.
+*                    - Throws a runtime error if a reservation is already pending or Length is
+*                      larger than MAX_RECORD_SIZE.
+*****************************************************************************************************/
+std::optional<std::span<uint8_t>> Reserve(size_t Length);
+/****************************************************************************************************
+* Function Name    : Commit
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes the reserved record with its full reserved length.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if nothing is reserved.
+*****************************************************************************************************/
+void Commit(void);
+/****************************************************************************************************
+* Function Name    : Commit
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes the reserved record trimmed to the bytes actually written.
+* Parameters (in)  : Length - Payload bytes written, not larger than the reservation.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Unused reserved bytes go back to the ring.
+*                    - Throws a runtime error if nothing is reserved or Length is too large.
+*****************************************************************************************************/
+void Commit(size_t Length);
+/****************************************************************************************************
+* Function Name    : Peek
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the oldest record without removing it.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<std::span<const uint8_t>> - Payload inside the ring, empty when
+*                    no record is published.
+* Notes            : - Consumer only, the view stays valid until Release.
+*                    - Skips wrap markers on the way.
+*****************************************************************************************************/
+std::optional<std::span<const uint8_t>> Peek(void);
+/****************************************************************************************************
+* Function Name    : Release
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the record returned by the last Peek and frees its bytes.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if no record was peeked.
+*****************************************************************************************************/
+void Release(void);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies a whole record into the ring.
+* Parameters (in)  : Record - Payload bytes.
+* Parameters (out) : None
+* Return value     : bool - True if the record was published, false if there is not enough room.
+* Notes            : Reserve, copy and Commit in one call.
+*****************************************************************************************************/
+bool Push(std::span<const uint8_t> Record);
+/****************************************************************************************************
+* Function Name    : Used_Bytes
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the bytes held by published records, headers, padding and markers.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Bytes not yet released by the consumer.
+* Notes            : Only a snapshot while the other side is active.
+*****************************************************************************************************/
+size_t Used_Bytes(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if no record is published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the ring holds no bytes, false otherwise.
+* Notes            : Only a snapshot while the other side is active.
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Has_Room
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks free space, reading the consumer position only when the cached one
+*                    does not leave enough.
+* Parameters (in)  : Tail  - Producer position.
+*                    Bytes - Bytes needed after the tail.
+* Parameters (out) : None
+* Return value     : bool - True if the bytes are free.
+* Notes            : None
+*****************************************************************************************************/
+bool Has_Room(uint64_t Tail,size_t Bytes);
+/****************************************************************************************************
+* Function Name    : Record_Span
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the bytes a record of a given payload length takes in the ring.
+* Parameters (in)  : Length - Payload bytes.
+* Parameters (out) : None
+* Return value     : size_t - Header and payload rounded up to RECORD_ALIGNMENT.
+* Notes            : None
+*****************************************************************************************************/
+static constexpr size_t Record_Span(size_t Length);
+private:
+    /* Length Prefix That Means "Rest Of The Storage Is Unused, Continue At Offset Zero" */
+    static constexpr uint32_t WRAP_MARKER{0xFFFFFFFFu};
+    static constexpr uint64_t MASK{TOTAL_SIZE-1};
+    /* Bytes Ever Released "Written By Consumer Only" */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Head{};
+    /* Consumer Local Copy Of Tail "Refreshed Only When Ring Looks Empty" */
+    uint64_t m_Cached_Tail{};
+    /* Bytes Taken By The Peeked Record, Zero When Nothing Is Peeked */
+    size_t m_Peeked_Span{};
+    /* Bytes Ever Published "Written By Producer Only" */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Tail{};
+    /* Producer Local Copy Of Head "Refreshed Only When Ring Looks Full" */
+    uint64_t m_Cached_Head{};
+    /* Payload Bytes Of The Pending Reservation */
+    size_t m_Reserved_Length{};
+    /* True Between Reserve And Commit */
+    bool m_Reserved{};
+    /* Records Packed Back To Back */
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t,TOTAL_SIZE> m_Data{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Record_Circular_Buffer
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Record_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Initializes an empty byte ring.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+Record_Circular_Buffer<TOTAL_SIZE>::Record_Circular_Buffer():
+m_Head{},m_Cached_Tail{},m_Peeked_Span{},m_Tail{},m_Cached_Head{},m_Reserved_Length{},m_Reserved{},m_Data{}
+{}
+/****************************************************************************************************
+* Function Name    : Reserve
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Hands out contiguous room for the payload of the next record.
+* Parameters (in)  : Length - Payload bytes to be written.
+* Parameters (out) : None
+* Return value     : std::optional<std::span<uint8_t>> - Payload room inside the ring, empty when
+*                    there is not enough free space yet.
+* Notes            : - Producer only, the record stays invisible until Commit.
+*                    - A record that does not fit before the end of the storage starts over at
+*                      offset zero, a wrap marker tells the consumer to skip the rest.
+*                    - Throws a runtime error if a reservation is already pending or Length is
+*                      larger than MAX_RECORD_SIZE.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+std::optional<std::span<uint8_t>> Record_Circular_Buffer<TOTAL_SIZE>::Reserve(size_t Length)
+{
+    if(m_Reserved){throw std::runtime_error("Record Already Reserved");}
+    if(Length>MAX_RECORD_SIZE){throw std::runtime_error("Record Larger Than Buffer");}
+    const size_t Span{Record_Span(Length)};
+    /* Only Producer Writes Tail So Relaxed Load Is Enough */
+    uint64_t Tail{m_Tail.load(std::memory_order_relaxed)};
+    size_t Offset{static_cast<size_t>(Tail&MASK)};
+    if(Offset+Span>TOTAL_SIZE)
+    {
+        /* Publish The Marker On Its Own "Consumer Frees The Skipped Bytes Even If The Record Must Wait" */
+        const size_t Skipped{TOTAL_SIZE-Offset};
+        if(!Has_Room(Tail,Skipped)){return std::nullopt;}
+        std::memcpy(m_Data.data()+Offset,&WRAP_MARKER,sizeof(WRAP_MARKER));
+        Tail+=Skipped;
+        m_Tail.store(Tail,std::memory_order_release);
+        Offset=0;
+    }
+    if(!Has_Room(Tail,Span)){return std::nullopt;}
+    m_Reserved=true;
+    m_Reserved_Length=Length;
+    return std::span<uint8_t>(m_Data.data()+Offset+RECORD_HEADER_SIZE,Length);
+}
+/****************************************************************************************************
+* Function Name    : Commit
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes the reserved record with its full reserved length.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if nothing is reserved.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+void Record_Circular_Buffer<TOTAL_SIZE>::Commit(void)
+{
+    Commit(m_Reserved_Length);
+}
+/****************************************************************************************************
+* Function Name    : Commit
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes the reserved record trimmed to the bytes actually written.
+* Parameters (in)  : Length - Payload bytes written, not larger than the reservation.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Unused reserved bytes go back to the ring.
+*                    - Throws a runtime error if nothing is reserved or Length is too large.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+void Record_Circular_Buffer<TOTAL_SIZE>::Commit(size_t Length)
+{
+    if(!m_Reserved){throw std::runtime_error("No Record Reserved");}
+    if(Length>m_Reserved_Length){throw std::runtime_error("Commit Write Out Of Range");}
+    const uint64_t Tail{m_Tail.load(std::memory_order_relaxed)};
+    const uint32_t Prefix{static_cast<uint32_t>(Length)};
+    std::memcpy(m_Data.data()+(Tail&MASK),&Prefix,sizeof(Prefix));
+    m_Reserved=false;
+    /* Publish Record To Consumer */
+    m_Tail.store(Tail+Record_Span(Length),std::memory_order_release);
+}
+/****************************************************************************************************
+* Function Name    : Peek
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the oldest record without removing it.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::optional<std::span<const uint8_t>> - Payload inside the ring, empty when
+*                    no record is published.
+* Notes            : - Consumer only, the view stays valid until Release.
+*                    - Skips wrap markers on the way.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+std::optional<std::span<const uint8_t>> Record_Circular_Buffer<TOTAL_SIZE>::Peek(void)
+{
+    /* Only Consumer Writes Head So Relaxed Load Is Enough */
+    uint64_t Head{m_Head.load(std::memory_order_relaxed)};
+    while(true)
+    {
+        /* Ring Looks Empty "Refresh Cached Tail From Producer" */
+        if(Head==m_Cached_Tail)
+        {
+            m_Cached_Tail=m_Tail.load(std::memory_order_acquire);
+            if(Head==m_Cached_Tail){return std::nullopt;}
+        }
+        const size_t Offset{static_cast<size_t>(Head&MASK)};
+        uint32_t Prefix{};
+        std::memcpy(&Prefix,m_Data.data()+Offset,sizeof(Prefix));
+        if(Prefix!=WRAP_MARKER)
+        {
+            m_Peeked_Span=Record_Span(Prefix);
+            return std::span<const uint8_t>(m_Data.data()+Offset+RECORD_HEADER_SIZE,Prefix);
+        }
+        /* Hand The Skipped Bytes Back Right Away */
+        Head+=TOTAL_SIZE-Offset;
+        m_Head.store(Head,std::memory_order_release);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Release
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes the record returned by the last Peek and frees its bytes.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if no record was peeked.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+void Record_Circular_Buffer<TOTAL_SIZE>::Release(void)
+{
+    if(m_Peeked_Span==0){throw std::runtime_error("No Record Peeked");}
+    /* Release Bytes Back To Producer */
+    m_Head.store(m_Head.load(std::memory_order_relaxed)+m_Peeked_Span,std::memory_order_release);
+    m_Peeked_Span=0;
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies a whole record into the ring.
+* Parameters (in)  : Record - Payload bytes.
+* Parameters (out) : None
+* Return value     : bool - True if the record was published, false if there is not enough room.
+* Notes            : Reserve, copy and Commit in one call.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+bool Record_Circular_Buffer<TOTAL_SIZE>::Push(std::span<const uint8_t> Record)
+{
+    const auto Room{Reserve(Record.size())};
+    if(!Room){return false;}
+    if(!Record.empty()){std::memcpy(Room->data(),Record.data(),Record.size());}
+    Commit();
+    return true;
+}
+/****************************************************************************************************
+* Function Name    : Used_Bytes
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the bytes held by published records, headers, padding and markers.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Bytes not yet released by the consumer.
+* Notes            : Only a snapshot while the other side is active.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+size_t Record_Circular_Buffer<TOTAL_SIZE>::Used_Bytes(void)const
+{
+    /* Head First, Tail Read After It Is Never Behind */
+    const uint64_t Head{m_Head.load(std::memory_order_acquire)};
+    return static_cast<size_t>(m_Tail.load(std::memory_order_acquire)-Head);
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if no record is published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the ring holds no bytes, false otherwise.
+* Notes            : Only a snapshot while the other side is active.
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+bool Record_Circular_Buffer<TOTAL_SIZE>::Is_Empty(void)const
+{
+    return Used_Bytes()==0;
+}
+/****************************************************************************************************
+* Function Name    : Has_Room
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks free space, reading the consumer position only when the cached one
+*                    does not leave enough.
+* Parameters (in)  : Tail  - Producer position.
+*                    Bytes - Bytes needed after the tail.
+* Parameters (out) : None
+* Return value     : bool - True if the bytes are free.
+* Notes            : None
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+bool Record_Circular_Buffer<TOTAL_SIZE>::Has_Room(uint64_t Tail,size_t Bytes)
+{
+    if(TOTAL_SIZE-(Tail-m_Cached_Head)>=Bytes){return true;}
+    m_Cached_Head=m_Head.load(std::memory_order_acquire);
+    return TOTAL_SIZE-(Tail-m_Cached_Head)>=Bytes;
+}
+/****************************************************************************************************
+* Function Name    : Record_Span
+* Class            : Record_Circular_Buffer<TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the bytes a record of a given payload length takes in the ring.
+* Parameters (in)  : Length - Payload bytes.
+* Parameters (out) : None
+* Return value     : size_t - Header and payload rounded up to RECORD_ALIGNMENT.
+* Notes            : None
+*****************************************************************************************************/
+template <size_t TOTAL_SIZE>
+constexpr size_t Record_Circular_Buffer<TOTAL_SIZE>::Record_Span(size_t Length)
+{
+    return (RECORD_HEADER_SIZE+Length+RECORD_ALIGNMENT-1)&~(RECORD_ALIGNMENT-1);
+}
+}
+/********************************************************************
+ *  END OF FILE:  Record_Circular_Buffer.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,584 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Sequenced_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Sequencer based ring where one producer publishes batches and several consumers read them in place
+ *  Class Name:  Sequenced_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _SEQUENCED_CIRCULAR_BUFFER_HPP_
+#define _SEQUENCED_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+----    Sequenced_Circular_Buffer     ----
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=16>
+class Sequenced_Circular_Buffer
+{
+static_assert(TOTAL_SIZE>0&&(TOTAL_SIZE&(TOTAL_SIZE-1))==0,"Sequenced_Circular_Buffer Size Must Be A Power Of Two \"Sequence To Slot Is A Mask\"");
+static_assert(std::is_default_constructible_v<Type>,"Sequenced_Circular_Buffer Slots Are Built Once And Reused In Place");
+public:
+    /* Slots Handed Out By One Claim, Sequences First To First+Count-1 */
+    struct Sequence_Range
+    {
+        uint64_t m_First{};
+        size_t m_Count{};
+    };
+    /*****************************************
+    ---------    Consumer     ---------
+    *****************************************/
+    class Consumer
+    {
+    public:
+        Consumer(const Consumer&)=delete;
+        Consumer& operator=(const Consumer&)=delete;
+/****************************************************************************************************
+* Function Name    : Available
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many published slots this consumer may read now.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Slots published by the producer and already passed by every dependency.
+* Notes            : Must be called from the thread running this consumer.
+*****************************************************************************************************/
+size_t Available(void);
+/****************************************************************************************************
+* Function Name    : Try_Process
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Hands every readable slot to a handler in place then moves the cursor past them.
+* Parameters (in)  : Handler   - Called as Handler(Type& Element,uint64_t Sequence) in sequence order.
+*                    Max_Count - Largest batch to handle in this call.
+* Parameters (out) : None
+* Return value     : size_t - Number of slots handled, zero if nothing was readable.
+* Notes            : - Never waits, the cursor is stored once per batch.
+*                    - Stages running side by side must not write the same fields of an element.
+*****************************************************************************************************/
+template <typename Function_Type>
+size_t Try_Process(Function_Type&& Handler,size_t Max_Count=TOTAL_SIZE);
+/****************************************************************************************************
+* Function Name    : Process
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Same as Try_Process but waits until at least one slot is readable.
+* Parameters (in)  : Handler   - Called as Handler(Type& Element,uint64_t Sequence) in sequence order.
+*                    Max_Count - Largest batch to handle in this call.
+* Parameters (out) : None
+* Return value     : size_t - Number of slots handled, zero once the buffer is closed and this
+*                    consumer has read everything published.
+* Notes            : Waits by yielding the core, suited to dedicated stage threads.
+*****************************************************************************************************/
+template <typename Function_Type>
+size_t Process(Function_Type&& Handler,size_t Max_Count=TOTAL_SIZE);
+/****************************************************************************************************
+* Function Name    : Cursor
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sequence this consumer reads next.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Number of slots this consumer has handled so far.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+uint64_t Cursor(void)const;
+    private:
+        friend class Sequenced_Circular_Buffer;
+        Consumer(Sequenced_Circular_Buffer& Owner,std::vector<const Consumer*> Dependencies):
+        m_Cursor{},m_Owner{Owner},m_Dependencies{std::move(Dependencies)}
+        {
+        }
+        /* Next Sequence To Read, Producer And Later Stages Gate On It */
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Cursor{};
+        /* Buffer This Consumer Reads From */
+        Sequenced_Circular_Buffer &m_Owner;
+        /* Stages That Must Pass A Slot Before This One Sees It */
+        std::vector<const Consumer*> m_Dependencies{};
+    };
+/****************************************************************************************************
+* Constructor Name : Sequenced_Circular_Buffer
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Sequenced_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Builds every slot once, slots are then overwritten in place.
+*****************************************************************************************************/
+Sequenced_Circular_Buffer();
+/****************************************************************************************************
+* Function Name    : Add_Consumer
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Registers a new consumer with its own cursor.
+* Parameters (in)  : Dependencies - Consumers of this buffer that must handle a slot first.
+* Parameters (out) : None
+* Return value     : Consumer& - Handle used by the thread running the new stage.
+* Notes            : - Consumers must be added before the first publish.
+*                    - The producer only waits for stages no other stage depends on.
+*                    - Throws std::runtime_error on late registration or a foreign dependency.
+*****************************************************************************************************/
+Consumer& Add_Consumer(std::initializer_list<const Consumer*> Dependencies={});
+/****************************************************************************************************
+* Function Name    : Claim
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reserves the next Count slots for the producer, waiting for the slowest stage.
+* Parameters (in)  : Count - Number of slots to reserve.
+* Parameters (out) : None
+* Return value     : Sequence_Range - Sequences to fill through operator[] then Publish.
+* Notes            : - Throws std::runtime_error if Count is zero or larger than the buffer.
+*                    - Single producer only.
+*****************************************************************************************************/
+Sequence_Range Claim(size_t Count=1);
+/****************************************************************************************************
+* Function Name    : Try_Claim
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reserves the next Count slots for the producer without waiting.
+* Parameters (in)  : Count - Number of slots to reserve.
+* Parameters (out) : None
+* Return value     : std::optional<Sequence_Range> - Sequences reserved, empty if a stage still
+*                    reads one of them.
+* Notes            : Throws std::runtime_error if Count is zero or larger than the buffer.
+*****************************************************************************************************/
+std::optional<Sequence_Range> Try_Claim(size_t Count=1);
+/****************************************************************************************************
+* Function Name    : Publish
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Makes every slot of a claimed range visible to the consumers.
+* Parameters (in)  : Range - Range returned by Claim or Try_Claim.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - One release store for the whole batch.
+*                    - Throws std::runtime_error if ranges are not published in claim order.
+*****************************************************************************************************/
+void Publish(const Sequence_Range& Range);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Claims one slot, copies an element into it and publishes it.
+* Parameters (in)  : Element - The element to be published.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Waits like Claim while the slowest stage is a full lap behind.
+*****************************************************************************************************/
+void Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Accesses the slot holding a sequence.
+* Parameters (in)  : Sequence - Sequence of a claimed slot.
+* Parameters (out) : None
+* Return value     : Type& - The slot, filled in place by the producer.
+* Notes            : Unchecked, only sequences of a claimed and unpublished range may be written.
+*****************************************************************************************************/
+Type& operator[](uint64_t Sequence);
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Tells every stage that nothing more will be published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Process returns zero once a stage has read what was published before.
+*****************************************************************************************************/
+void Close(void);
+/****************************************************************************************************
+* Function Name    : Published
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of slots published so far.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence the next published slot will carry.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+uint64_t Published(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Check_Claim
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Rejects batch sizes that can never be claimed.
+* Parameters (in)  : Count - Requested number of slots.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws std::runtime_error if Count is zero or larger than the buffer.
+*****************************************************************************************************/
+static void Check_Claim(size_t Count);
+/****************************************************************************************************
+* Function Name    : Has_Room
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks if the slowest gating stage left room for a batch ending at End.
+* Parameters (in)  : End - Sequence just after the last slot of the batch.
+* Parameters (out) : None
+* Return value     : bool - True if the batch does not overwrite unread slots.
+* Notes            : Reads the gating cursors only when the cached minimum is not enough.
+*****************************************************************************************************/
+bool Has_Room(uint64_t End);
+private:
+    /* Sequence Mask "Size Is A Power Of Two" */
+    static constexpr uint64_t MASK{TOTAL_SIZE-1};
+    /* Slots Up To Here Are Visible To Consumers, Written By Producer Only */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Published{};
+    /* Set Once By Close */
+    std::atomic<bool> m_Closed{};
+    /* Slots Up To Here Are Reserved, Producer Only */
+    alignas(CACHE_LINE_SIZE) uint64_t m_Claimed{};
+    /* Slowest Gating Cursor Last Read By Producer */
+    uint64_t m_Cached_Gating{};
+    /* Cursors Of Stages No Other Stage Depends On */
+    std::vector<const Consumer*> m_Gating{};
+    /* Every Registered Stage "Stable Addresses For Handles" */
+    std::vector<std::unique_ptr<Consumer>> m_Consumers{};
+    /* Slots Shared By Every Stage */
+    alignas(CACHE_LINE_SIZE) std::array<Type,TOTAL_SIZE> m_Data{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Sequenced_Circular_Buffer
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Sequenced_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Builds every slot once, slots are then overwritten in place.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Sequenced_Circular_Buffer():
+m_Published{},m_Closed{},m_Claimed{},m_Cached_Gating{},m_Gating{},m_Consumers{},m_Data{}
+{
+}
+/****************************************************************************************************
+* Function Name    : Add_Consumer
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Registers a new consumer with its own cursor.
+* Parameters (in)  : Dependencies - Consumers of this buffer that must handle a slot first.
+* Parameters (out) : None
+* Return value     : Consumer& - Handle used by the thread running the new stage.
+* Notes            : - Consumers must be added before the first publish.
+*                    - The producer only waits for stages no other stage depends on.
+*                    - Throws std::runtime_error on late registration or a foreign dependency.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+typename Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer& Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Add_Consumer(std::initializer_list<const Consumer*> Dependencies)
+{
+    /* A Late Stage Would Start Behind Slots Already Recycled */
+    if(m_Claimed!=0){throw std::runtime_error("Consumers Must Be Added Before Publishing");}
+    for(const Consumer* Dependency:Dependencies)
+    {
+        if(Dependency==nullptr||&Dependency->m_Owner!=this){throw std::runtime_error("Dependency Belongs To Another Buffer");}
+    }
+    m_Consumers.push_back(std::unique_ptr<Consumer>(new Consumer{*this,std::vector<const Consumer*>(Dependencies)}));
+    /* Dependencies Are Always Ahead Of The New Stage "Producer Only Needs The Last One" */
+    std::erase_if(m_Gating,[&Dependencies](const Consumer* Gating){return std::find(Dependencies.begin(),Dependencies.end(),Gating)!=Dependencies.end();});
+    m_Gating.push_back(m_Consumers.back().get());
+    return *m_Consumers.back();
+}
+/****************************************************************************************************
+* Function Name    : Claim
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reserves the next Count slots for the producer, waiting for the slowest stage.
+* Parameters (in)  : Count - Number of slots to reserve.
+* Parameters (out) : None
+* Return value     : Sequence_Range - Sequences to fill through operator[] then Publish.
+* Notes            : - Throws std::runtime_error if Count is zero or larger than the buffer.
+*                    - Single producer only.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+typename Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Sequence_Range Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Claim(size_t Count)
+{
+    Check_Claim(Count);
+    while(!Has_Room(m_Claimed+Count)){std::this_thread::yield();}
+    const Sequence_Range Range{m_Claimed,Count};
+    m_Claimed+=Count;
+    return Range;
+}
+/****************************************************************************************************
+* Function Name    : Try_Claim
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Reserves the next Count slots for the producer without waiting.
+* Parameters (in)  : Count - Number of slots to reserve.
+* Parameters (out) : None
+* Return value     : std::optional<Sequence_Range> - Sequences reserved, empty if a stage still
+*                    reads one of them.
+* Notes            : Throws std::runtime_error if Count is zero or larger than the buffer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+std::optional<typename Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Sequence_Range> Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Try_Claim(size_t Count)
+{
+    Check_Claim(Count);
+    if(!Has_Room(m_Claimed+Count)){return std::nullopt;}
+    const Sequence_Range Range{m_Claimed,Count};
+    m_Claimed+=Count;
+    return Range;
+}
+/****************************************************************************************************
+* Function Name    : Publish
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Makes every slot of a claimed range visible to the consumers.
+* Parameters (in)  : Range - Range returned by Claim or Try_Claim.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - One release store for the whole batch.
+*                    - Throws std::runtime_error if ranges are not published in claim order.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Publish(const Sequence_Range& Range)
+{
+    /* Only The Producer Writes It, Relaxed Read Is Enough */
+    if(Range.m_First!=m_Published.load(std::memory_order_relaxed)||Range.m_First+Range.m_Count>m_Claimed)
+    {
+        throw std::runtime_error("Ranges Must Be Published In Claim Order");
+    }
+    m_Published.store(Range.m_First+Range.m_Count,std::memory_order_release);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Claims one slot, copies an element into it and publishes it.
+* Parameters (in)  : Element - The element to be published.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Waits like Claim while the slowest stage is a full lap behind.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Push(const Type& Element)
+{
+    const Sequence_Range Range{Claim(1)};
+    (*this)[Range.m_First]=Element;
+    Publish(Range);
+}
+/****************************************************************************************************
+* Function Name    : operator[]
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Accesses the slot holding a sequence.
+* Parameters (in)  : Sequence - Sequence of a claimed slot.
+* Parameters (out) : None
+* Return value     : Type& - The slot, filled in place by the producer.
+* Notes            : Unchecked, only sequences of a claimed and unpublished range may be written.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+Type& Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::operator[](uint64_t Sequence)
+{
+    return m_Data[Sequence&MASK];
+}
+/****************************************************************************************************
+* Function Name    : Close
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Tells every stage that nothing more will be published.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Process returns zero once a stage has read what was published before.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Close(void)
+{
+    m_Closed.store(true,std::memory_order_release);
+}
+/****************************************************************************************************
+* Function Name    : Published
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of slots published so far.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence the next published slot will carry.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+uint64_t Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Published(void)const
+{
+    return m_Published.load(std::memory_order_acquire);
+}
+/****************************************************************************************************
+* Function Name    : Check_Claim
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Rejects batch sizes that can never be claimed.
+* Parameters (in)  : Count - Requested number of slots.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws std::runtime_error if Count is zero or larger than the buffer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Check_Claim(size_t Count)
+{
+    if(Count==0||Count>TOTAL_SIZE){throw std::runtime_error("Claim Size Must Be Between One And Buffer Size");}
+}
+/****************************************************************************************************
+* Function Name    : Has_Room
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks if the slowest gating stage left room for a batch ending at End.
+* Parameters (in)  : End - Sequence just after the last slot of the batch.
+* Parameters (out) : None
+* Return value     : bool - True if the batch does not overwrite unread slots.
+* Notes            : Reads the gating cursors only when the cached minimum is not enough.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Has_Room(uint64_t End)
+{
+    if(End-m_Cached_Gating<=TOTAL_SIZE){return true;}
+    /* Without Stages Nothing Is Ever Read Back */
+    uint64_t Slowest{m_Claimed};
+    for(const Consumer* Gating:m_Gating){Slowest=std::min(Slowest,Gating->m_Cursor.load(std::memory_order_acquire));}
+    m_Cached_Gating=Slowest;
+    return End-m_Cached_Gating<=TOTAL_SIZE;
+}
+/****************************************************************************************************
+* Function Name    : Available
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns how many published slots this consumer may read now.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Slots published by the producer and already passed by every dependency.
+* Notes            : Must be called from the thread running this consumer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+size_t Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer::Available(void)
+{
+    uint64_t Limit{m_Owner.m_Published.load(std::memory_order_acquire)};
+    for(const Consumer* Dependency:m_Dependencies){Limit=std::min(Limit,Dependency->m_Cursor.load(std::memory_order_acquire));}
+    return static_cast<size_t>(Limit-m_Cursor.load(std::memory_order_relaxed));
+}
+/****************************************************************************************************
+* Function Name    : Try_Process
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Hands every readable slot to a handler in place then moves the cursor past them.
+* Parameters (in)  : Handler   - Called as Handler(Type& Element,uint64_t Sequence) in sequence order.
+*                    Max_Count - Largest batch to handle in this call.
+* Parameters (out) : None
+* Return value     : size_t - Number of slots handled, zero if nothing was readable.
+* Notes            : - Never waits, the cursor is stored once per batch.
+*                    - Stages running side by side must not write the same fields of an element.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+template <typename Function_Type>
+size_t Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer::Try_Process(Function_Type&& Handler,size_t Max_Count)
+{
+    const uint64_t Start{m_Cursor.load(std::memory_order_relaxed)};
+    /* Shared Cursors Are Read Once Per Batch Not Once Per Slot */
+    const uint64_t End{Start+std::min<uint64_t>(Available(),Max_Count)};
+    for(uint64_t Sequence{Start};Sequence<End;Sequence++){Handler(m_Owner.m_Data[Sequence&MASK],Sequence);}
+    if(End!=Start){m_Cursor.store(End,std::memory_order_release);}
+    return static_cast<size_t>(End-Start);
+}
+/****************************************************************************************************
+* Function Name    : Process
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Same as Try_Process but waits until at least one slot is readable.
+* Parameters (in)  : Handler   - Called as Handler(Type& Element,uint64_t Sequence) in sequence order.
+*                    Max_Count - Largest batch to handle in this call.
+* Parameters (out) : None
+* Return value     : size_t - Number of slots handled, zero once the buffer is closed and this
+*                    consumer has read everything published.
+* Notes            : Waits by yielding the core, suited to dedicated stage threads.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+template <typename Function_Type>
+size_t Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer::Process(Function_Type&& Handler,size_t Max_Count)
+{
+    while(true)
+    {
+        /* Read Close First, Every Slot Published Before It Is Then Visible */
+        const bool Closed{m_Owner.m_Closed.load(std::memory_order_acquire)};
+        const size_t Handled{Try_Process(Handler,Max_Count)};
+        if(Handled!=0){return Handled;}
+        if(Closed&&m_Cursor.load(std::memory_order_relaxed)==m_Owner.m_Published.load(std::memory_order_acquire)){return 0;}
+        std::this_thread::yield();
+    }
+}
+/****************************************************************************************************
+* Function Name    : Cursor
+* Class            : Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sequence this consumer reads next.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Number of slots this consumer has handled so far.
+* Notes            : Only a snapshot while other threads are active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+uint64_t Sequenced_Circular_Buffer<Type, TOTAL_SIZE>::Consumer::Cursor(void)const
+{
+    return m_Cursor.load(std::memory_order_acquire);
+}
+}
+/********************************************************************
+ *  END OF FILE:  Sequenced_Circular_Buffer.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,833 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Shared_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Single producer single consumer ring placed in POSIX shared memory for same host IPC
+ *  Class Name:  Shared_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _SHARED_CIRCULAR_BUFFER_HPP_
+#define _SHARED_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Side Of The Ring A Process Attaches As, Each Side Has One Owner At A Time */
+enum class Shared_Role
+{
+    Producer,
+    Consumer
+};
+/*****************************************
+-----    Shared_Circular_Buffer     ------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=10>
+class Shared_Circular_Buffer
+{
+static_assert(TOTAL_SIZE>0,"Shared_Circular_Buffer Size Must Be Greater Than Zero");
+static_assert(std::is_trivially_copyable_v<Type>,"Shared_Circular_Buffer Elements Cross Process Boundaries And Must Be Trivially Copyable");
+static_assert(std::atomic<uint64_t>::is_always_lock_free&&std::atomic<int32_t>::is_always_lock_free,
+              "Shared_Circular_Buffer Needs Address Free Atomics To Share Them Between Processes");
+public:
+    /* Same Region Types As Circular_Buffer */
+    using Readable_Regions=std::array<std::span<const Type>,2>;
+    using Writable_Regions=std::array<std::span<Type>,2>;
+    /* Identifies The Segment Layout, Bump SHARED_VERSION When Shared_Header Changes */
+    static constexpr uint64_t SHARED_MAGIC{0x31424346'52414853};
+    static constexpr uint32_t SHARED_VERSION{2};
+/****************************************************************************************************
+* Constructor Name : Shared_Circular_Buffer
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Opens or creates the shared segment and attaches to one side of the ring.
+* Parameters (in)  : Name - POSIX shared memory name, starts with a slash.
+*                    Role - Side this process works on.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - The first process to attach lays out the header, later ones validate it.
+*                    - Attaching again after a restart resumes from the indices left in the segment.
+*                    - A role held by a process that died is taken over.
+*                    - A header left half written by a creator that died is written again.
+*                    - Throws a runtime error if the segment cannot be mapped, the layout does not
+*                      match or the role is held by a live process.
+*****************************************************************************************************/
+Shared_Circular_Buffer(const std::string& Name,Shared_Role Role);
+/****************************************************************************************************
+* Function Name    : ~Shared_Circular_Buffer (Destructor)
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Shared_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Gives the role back and unmaps the segment, the segment itself stays for
+*                    the peer and for reattaching, call Remove to delete it.
+*****************************************************************************************************/
+~Shared_Circular_Buffer();
+Shared_Circular_Buffer(const Shared_Circular_Buffer&)=delete;
+Shared_Circular_Buffer& operator=(const Shared_Circular_Buffer&)=delete;
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies a new element into the ring.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : Producer only, no syscall is made.
+*****************************************************************************************************/
+bool Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the element at the head of the ring out and releases its slot.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : Consumer only, no syscall is made.
+*****************************************************************************************************/
+bool Pop(Type& Element);
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies as many elements of a batch as fit into the ring.
+* Parameters (in)  : Elements - Elements to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements stored from the front of the batch.
+* Notes            : Producer only, one index store publishes the whole batch.
+*****************************************************************************************************/
+size_t Push_N(std::span<const Type> Elements);
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies up to Elements.size() elements out of the ring.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the elements removed, oldest first.
+* Return value     : size_t - Number of elements removed.
+* Notes            : Consumer only, one index store releases the whole batch.
+*****************************************************************************************************/
+size_t Pop_N(std::span<Type> Elements);
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the published elements inside the shared segment.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first, second span is empty unless the
+*                    occupied region wraps around the end of the storage.
+* Notes            : - Consumer only, zero copy, call Commit_Read once the elements are used.
+*                    - Throws a runtime error when called by the producer.
+*****************************************************************************************************/
+Readable_Regions Readable_Spans(void);
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases elements consumed through Readable_Spans.
+* Parameters (in)  : Count - Number of elements consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the current size or when
+*                      called by the producer.
+*                    - Reads the producer index only when the cached one cannot cover Count.
+*****************************************************************************************************/
+void Commit_Read(size_t Count);
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the free slots inside the shared segment.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order, second span is empty unless the
+*                    free region wraps around the end of the storage.
+* Notes            : - Producer only, zero copy, data becomes visible after Commit_Write.
+*                    - Throws a runtime error when called by the consumer.
+*****************************************************************************************************/
+Writable_Regions Writable_Spans(void);
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes elements written through Writable_Spans.
+* Parameters (in)  : Count - Number of elements written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the free space or when
+*                      called by the consumer.
+*                    - Reads the consumer index only when the cached one cannot cover Count.
+*****************************************************************************************************/
+void Commit_Write(size_t Count);
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the current size of the buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Elements pushed and not yet popped.
+* Notes            : Only a snapshot while the peer is active.
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : Only a snapshot while the peer is active.
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+/****************************************************************************************************
+* Function Name    : Peer_Attached
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if a live process holds the other side of the ring.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the peer is attached and its process is alive.
+* Notes            : Lets one side notice the other one crashed without waiting on the data path.
+*****************************************************************************************************/
+bool Peer_Attached(void)const;
+/****************************************************************************************************
+* Function Name    : Remove
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Deletes a shared segment by name.
+* Parameters (in)  : Name - POSIX shared memory name given to the constructor.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Attached processes keep their mapping, the memory goes away with the last one.
+*****************************************************************************************************/
+static void Remove(const std::string& Name);
+private:
+    /* Layout At The Start Of The Segment, Followed By The Slots At m_Data_Offset */
+    struct Shared_Header
+    {
+        /* Written Once By The Creator Before m_State Turns Ready */
+        uint64_t m_Magic;
+        uint32_t m_Version;
+        uint32_t m_Element_Size;
+        uint64_t m_Capacity;
+        uint64_t m_Data_Offset;
+        /* Zero Fresh, One While The Creator Writes The Header, Two Once Ready */
+        std::atomic<uint32_t> m_State;
+        /* Process That Claimed The Right To Write The Header, Zero While Unclaimed */
+        std::atomic<int32_t> m_Initializer_Pid;
+        /* Process Holding Each Side, Zero When Free */
+        alignas(CACHE_LINE_SIZE) std::atomic<int32_t> m_Producer_Pid;
+        std::atomic<int32_t> m_Consumer_Pid;
+        /* Elements Ever Pushed, Written By Producer Only */
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Tail;
+        /* Elements Ever Popped, Written By Consumer Only */
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_Head;
+    };
+    static constexpr uint32_t STATE_FRESH{0};
+    static constexpr uint32_t STATE_INITIALIZING{1};
+    static constexpr uint32_t STATE_READY{2};
+    /* Slots Start On Their Own Cache Line */
+    static constexpr size_t DATA_OFFSET{(sizeof(Shared_Header)+std::max(alignof(Type),CACHE_LINE_SIZE)-1)/std::max(alignof(Type),CACHE_LINE_SIZE)*std::max(alignof(Type),CACHE_LINE_SIZE)};
+    static constexpr size_t SEGMENT_SIZE{DATA_OFFSET+sizeof(Type)*TOTAL_SIZE};
+/****************************************************************************************************
+* Function Name    : Read_Regions
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns views over the published elements, reading the producer index only
+*                    when the cached one cannot cover the request.
+* Parameters (in)  : Wanted - Number of elements the caller is about to consume.
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first.
+* Notes            : Throws a runtime error when called by the producer.
+*****************************************************************************************************/
+Readable_Regions Read_Regions(size_t Wanted);
+/****************************************************************************************************
+* Function Name    : Write_Regions
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns views over the free slots, reading the consumer index only when the
+*                    cached one cannot cover the request.
+* Parameters (in)  : Wanted - Number of elements the caller is about to produce.
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order.
+* Notes            : Throws a runtime error when called by the consumer.
+*****************************************************************************************************/
+Writable_Regions Write_Regions(size_t Wanted);
+/****************************************************************************************************
+* Function Name    : Initialize_Header
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Lays out a fresh segment or waits for and validates one made by the peer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - The claim is recorded as the pid of the writer, a writer that died before
+*                      publishing the header is detected on timeout and the header is written again.
+*                    - Throws a runtime error on a layout mismatch or if a live creator never finishes.
+*****************************************************************************************************/
+void Initialize_Header(void);
+/****************************************************************************************************
+* Function Name    : Claim_Role
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Records this process as the owner of its side of the ring.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Takes the side over from a dead process, throws if a live one holds it.
+*****************************************************************************************************/
+void Claim_Role(void);
+/****************************************************************************************************
+* Function Name    : Require_Role
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Rejects calls made from the wrong side of the ring.
+* Parameters (in)  : Role - Side allowed to make the call.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if this object attached as the other side.
+*****************************************************************************************************/
+void Require_Role(Shared_Role Role)const;
+/****************************************************************************************************
+* Function Name    : Is_Process_Alive
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks if a process id still belongs to a running process.
+* Parameters (in)  : Process_Id - Process id recorded in the header.
+* Parameters (out) : None
+* Return value     : bool - True if the process exists.
+* Notes            : A reused process id looks alive, Remove the segment to recover from that.
+*****************************************************************************************************/
+static bool Is_Process_Alive(int32_t Process_Id);
+private:
+    /* Side This Object Works On */
+    Shared_Role m_Role{};
+    /* Shared Memory Descriptor, Kept Open For The Lifetime Of The Mapping */
+    int m_File_Descriptor{-1};
+    /* Start Of The Mapped Segment */
+    Shared_Header *m_Header{};
+    /* Slots Inside The Segment */
+    Type *m_Data{};
+    /* Last Peer Index Seen "Skips Reading The Peer Cache Line While There Is Room Or Data" */
+    uint64_t m_Cached_Peer_Index{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Shared_Circular_Buffer
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Opens or creates the shared segment and attaches to one side of the ring.
+* Parameters (in)  : Name - POSIX shared memory name, starts with a slash.
+*                    Role - Side this process works on.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - The first process to attach lays out the header, later ones validate it.
+*                    - Attaching again after a restart resumes from the indices left in the segment.
+*                    - A role held by a process that died is taken over.
+*                    - A header left half written by a creator that died is written again.
+*                    - Throws a runtime error if the segment cannot be mapped, the layout does not
+*                      match or the role is held by a live process.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+Shared_Circular_Buffer<Type, TOTAL_SIZE>::Shared_Circular_Buffer(const std::string& Name,Shared_Role Role):
+m_Role{Role},m_File_Descriptor{-1},m_Header{},m_Data{},m_Cached_Peer_Index{}
+{
+    m_File_Descriptor=shm_open(Name.c_str(),O_RDWR|O_CREAT|O_CLOEXEC,S_IRUSR|S_IWUSR);
+    if(m_File_Descriptor<0){throw std::runtime_error("Shared Buffer Open Failed");}
+    /* Both Sides May Grow A Fresh Segment, Never Shrink One Made With Another Layout */
+    struct stat Status{};
+    if(fstat(m_File_Descriptor,&Status)<0||
+       (static_cast<size_t>(Status.st_size)<SEGMENT_SIZE&&ftruncate(m_File_Descriptor,static_cast<off_t>(SEGMENT_SIZE))<0))
+    {
+        close(m_File_Descriptor);
+        throw std::runtime_error("Shared Buffer Resize Failed");
+    }
+    void *Mapping{mmap(nullptr,SEGMENT_SIZE,PROT_READ|PROT_WRITE,MAP_SHARED,m_File_Descriptor,0)};
+    if(Mapping==MAP_FAILED)
+    {
+        close(m_File_Descriptor);
+        throw std::runtime_error("Shared Buffer Mapping Failed");
+    }
+    /* Fresh Pages Are Zero, A Valid Initial State For Every Header Field */
+    m_Header=static_cast<Shared_Header*>(Mapping);
+    m_Data=reinterpret_cast<Type*>(static_cast<uint8_t*>(Mapping)+DATA_OFFSET);
+    try
+    {
+        Initialize_Header();
+        Claim_Role();
+    }
+    catch(...)
+    {
+        munmap(Mapping,SEGMENT_SIZE);
+        close(m_File_Descriptor);
+        throw;
+    }
+    m_Cached_Peer_Index=(m_Role==Shared_Role::Producer)?m_Header->m_Head.load(std::memory_order_acquire):m_Header->m_Tail.load(std::memory_order_acquire);
+}
+/****************************************************************************************************
+* Function Name    : ~Shared_Circular_Buffer (Destructor)
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Shared_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Gives the role back and unmaps the segment, the segment itself stays for
+*                    the peer and for reattaching, call Remove to delete it.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+Shared_Circular_Buffer<Type, TOTAL_SIZE>::~Shared_Circular_Buffer()
+{
+    std::atomic<int32_t> &Owner{(m_Role==Shared_Role::Producer)?m_Header->m_Producer_Pid:m_Header->m_Consumer_Pid};
+    int32_t Self{static_cast<int32_t>(getpid())};
+    Owner.compare_exchange_strong(Self,0,std::memory_order_acq_rel);
+    munmap(m_Header,SEGMENT_SIZE);
+    close(m_File_Descriptor);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies a new element into the ring.
+* Parameters (in)  : Element - The element to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : bool - True if the element was stored, false if the buffer is full.
+* Notes            : Producer only, no syscall is made.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Shared_Circular_Buffer<Type, TOTAL_SIZE>::Push(const Type& Element)
+{
+    return Push_N(std::span<const Type>(&Element,1))==1;
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies the element at the head of the ring out and releases its slot.
+* Parameters (in)  : None
+* Parameters (out) : Element - Receives the element removed from the buffer.
+* Return value     : bool - True if an element was removed, false if the buffer is empty.
+* Notes            : Consumer only, no syscall is made.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Shared_Circular_Buffer<Type, TOTAL_SIZE>::Pop(Type& Element)
+{
+    return Pop_N(std::span<Type>(&Element,1))==1;
+}
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies as many elements of a batch as fit into the ring.
+* Parameters (in)  : Elements - Elements to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements stored from the front of the batch.
+* Notes            : Producer only, one index store publishes the whole batch.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+size_t Shared_Circular_Buffer<Type, TOTAL_SIZE>::Push_N(std::span<const Type> Elements)
+{
+    const Writable_Regions Regions{Write_Regions(Elements.size())};
+    /* Copy First Segment Up To Wrap Point Then The Rest From Start */
+    const size_t First_Count{std::min(Elements.size(),Regions[0].size())};
+    const size_t Second_Count{std::min(Elements.size()-First_Count,Regions[1].size())};
+    std::memcpy(Regions[0].data(),Elements.data(),First_Count*sizeof(Type));
+    std::memcpy(Regions[1].data(),Elements.data()+First_Count,Second_Count*sizeof(Type));
+    if(First_Count+Second_Count){Commit_Write(First_Count+Second_Count);}
+    return First_Count+Second_Count;
+}
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Copies up to Elements.size() elements out of the ring.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the elements removed, oldest first.
+* Return value     : size_t - Number of elements removed.
+* Notes            : Consumer only, one index store releases the whole batch.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+size_t Shared_Circular_Buffer<Type, TOTAL_SIZE>::Pop_N(std::span<Type> Elements)
+{
+    const Readable_Regions Regions{Read_Regions(Elements.size())};
+    /* Copy First Segment Up To Wrap Point Then The Rest From Start */
+    const size_t First_Count{std::min(Elements.size(),Regions[0].size())};
+    const size_t Second_Count{std::min(Elements.size()-First_Count,Regions[1].size())};
+    std::memcpy(Elements.data(),Regions[0].data(),First_Count*sizeof(Type));
+    std::memcpy(Elements.data()+First_Count,Regions[1].data(),Second_Count*sizeof(Type));
+    if(First_Count+Second_Count){Commit_Read(First_Count+Second_Count);}
+    return First_Count+Second_Count;
+}
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the published elements inside the shared segment.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first, second span is empty unless the
+*                    occupied region wraps around the end of the storage.
+* Notes            : - Consumer only, zero copy, call Commit_Read once the elements are used.
+*                    - Throws a runtime error when called by the producer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+typename Shared_Circular_Buffer<Type, TOTAL_SIZE>::Readable_Regions Shared_Circular_Buffer<Type, TOTAL_SIZE>::Readable_Spans(void)
+{
+    return Read_Regions(TOTAL_SIZE);
+}
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases elements consumed through Readable_Spans.
+* Parameters (in)  : Count - Number of elements consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the current size or when
+*                      called by the producer.
+*                    - Reads the producer index only when the cached one cannot cover Count.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Shared_Circular_Buffer<Type, TOTAL_SIZE>::Commit_Read(size_t Count)
+{
+    Require_Role(Shared_Role::Consumer);
+    const uint64_t Head{m_Header->m_Head.load(std::memory_order_relaxed)};
+    /* Spans Were Cut From The Cached Tail, Reload It Only For A Larger Count */
+    if(m_Cached_Peer_Index-Head<Count){m_Cached_Peer_Index=m_Header->m_Tail.load(std::memory_order_acquire);}
+    if(Count>m_Cached_Peer_Index-Head){throw std::runtime_error("Commit Read Out Of Range");}
+    m_Header->m_Head.store(Head+Count,std::memory_order_release);
+}
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns views over the free slots inside the shared segment.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order, second span is empty unless the
+*                    free region wraps around the end of the storage.
+* Notes            : - Producer only, zero copy, data becomes visible after Commit_Write.
+*                    - Throws a runtime error when called by the consumer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+typename Shared_Circular_Buffer<Type, TOTAL_SIZE>::Writable_Regions Shared_Circular_Buffer<Type, TOTAL_SIZE>::Writable_Spans(void)
+{
+    return Write_Regions(TOTAL_SIZE);
+}
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes elements written through Writable_Spans.
+* Parameters (in)  : Count - Number of elements written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Throws a runtime error if Count is larger than the free space or when
+*                      called by the consumer.
+*                    - Reads the consumer index only when the cached one cannot cover Count.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Shared_Circular_Buffer<Type, TOTAL_SIZE>::Commit_Write(size_t Count)
+{
+    Require_Role(Shared_Role::Producer);
+    const uint64_t Tail{m_Header->m_Tail.load(std::memory_order_relaxed)};
+    /* Spans Were Cut From The Cached Head, Reload It Only For A Larger Count */
+    if(TOTAL_SIZE-(Tail-m_Cached_Peer_Index)<Count){m_Cached_Peer_Index=m_Header->m_Head.load(std::memory_order_acquire);}
+    if(Count>TOTAL_SIZE-(Tail-m_Cached_Peer_Index)){throw std::runtime_error("Commit Write Out Of Range");}
+    m_Header->m_Tail.store(Tail+Count,std::memory_order_release);
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the current size of the buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Elements pushed and not yet popped.
+* Notes            : Only a snapshot while the peer is active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+size_t Shared_Circular_Buffer<Type, TOTAL_SIZE>::Size(void)const
+{
+    /* Head First, Tail Read After It Is Never Behind */
+    const uint64_t Head{m_Header->m_Head.load(std::memory_order_acquire)};
+    return static_cast<size_t>(m_Header->m_Tail.load(std::memory_order_acquire)-Head);
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : Only a snapshot while the peer is active.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Shared_Circular_Buffer<Type, TOTAL_SIZE>::Is_Empty(void)const
+{
+    return Size()==0;
+}
+/****************************************************************************************************
+* Function Name    : Peer_Attached
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if a live process holds the other side of the ring.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the peer is attached and its process is alive.
+* Notes            : Lets one side notice the other one crashed without waiting on the data path.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Shared_Circular_Buffer<Type, TOTAL_SIZE>::Peer_Attached(void)const
+{
+    const std::atomic<int32_t> &Peer{(m_Role==Shared_Role::Producer)?m_Header->m_Consumer_Pid:m_Header->m_Producer_Pid};
+    const int32_t Process_Id{Peer.load(std::memory_order_acquire)};
+    return Process_Id!=0&&Is_Process_Alive(Process_Id);
+}
+/****************************************************************************************************
+* Function Name    : Remove
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Deletes a shared segment by name.
+* Parameters (in)  : Name - POSIX shared memory name given to the constructor.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Attached processes keep their mapping, the memory goes away with the last one.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Shared_Circular_Buffer<Type, TOTAL_SIZE>::Remove(const std::string& Name)
+{
+    shm_unlink(Name.c_str());
+}
+/****************************************************************************************************
+* Function Name    : Read_Regions
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns views over the published elements, reading the producer index only
+*                    when the cached one cannot cover the request.
+* Parameters (in)  : Wanted - Number of elements the caller is about to consume.
+* Parameters (out) : None
+* Return value     : Readable_Regions - Oldest elements first.
+* Notes            : Throws a runtime error when called by the producer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+typename Shared_Circular_Buffer<Type, TOTAL_SIZE>::Readable_Regions Shared_Circular_Buffer<Type, TOTAL_SIZE>::Read_Regions(size_t Wanted)
+{
+    Require_Role(Shared_Role::Consumer);
+    const uint64_t Head{m_Header->m_Head.load(std::memory_order_relaxed)};
+    /* Touch The Producer Cache Line Only When Cached Elements Fall Short */
+    if(m_Cached_Peer_Index-Head<Wanted){m_Cached_Peer_Index=m_Header->m_Tail.load(std::memory_order_acquire);}
+    const size_t Occupied{static_cast<size_t>(m_Cached_Peer_Index-Head)};
+    const size_t Head_Slot{static_cast<size_t>(Head%TOTAL_SIZE)};
+    const size_t First_Segment{std::min(Occupied,TOTAL_SIZE-Head_Slot)};
+    return Readable_Regions{std::span<const Type>(m_Data+Head_Slot,First_Segment),
+                            std::span<const Type>(m_Data,Occupied-First_Segment)};
+}
+/****************************************************************************************************
+* Function Name    : Write_Regions
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns views over the free slots, reading the consumer index only when the
+*                    cached one cannot cover the request.
+* Parameters (in)  : Wanted - Number of elements the caller is about to produce.
+* Parameters (out) : None
+* Return value     : Writable_Regions - Free slots in push order.
+* Notes            : Throws a runtime error when called by the consumer.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+typename Shared_Circular_Buffer<Type, TOTAL_SIZE>::Writable_Regions Shared_Circular_Buffer<Type, TOTAL_SIZE>::Write_Regions(size_t Wanted)
+{
+    Require_Role(Shared_Role::Producer);
+    const uint64_t Tail{m_Header->m_Tail.load(std::memory_order_relaxed)};
+    /* Touch The Consumer Cache Line Only When Cached Free Slots Fall Short */
+    if(TOTAL_SIZE-(Tail-m_Cached_Peer_Index)<Wanted){m_Cached_Peer_Index=m_Header->m_Head.load(std::memory_order_acquire);}
+    const size_t Free_Slots{static_cast<size_t>(TOTAL_SIZE-(Tail-m_Cached_Peer_Index))};
+    const size_t Tail_Slot{static_cast<size_t>(Tail%TOTAL_SIZE)};
+    const size_t First_Segment{std::min(Free_Slots,TOTAL_SIZE-Tail_Slot)};
+    return Writable_Regions{std::span<Type>(m_Data+Tail_Slot,First_Segment),
+                            std::span<Type>(m_Data,Free_Slots-First_Segment)};
+}
+/****************************************************************************************************
+* Function Name    : Initialize_Header
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Lays out a fresh segment or waits for and validates one made by the peer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - The claim is recorded as the pid of the writer, a writer that died before
+*                      publishing the header is detected on timeout and the header is written again.
+*                    - Throws a runtime error on a layout mismatch or if a live creator never finishes.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Shared_Circular_Buffer<Type, TOTAL_SIZE>::Initialize_Header(void)
+{
+    const int32_t Self{static_cast<int32_t>(getpid())};
+    while(true)
+    {
+        int32_t Initializer{};
+        uint32_t State{STATE_FRESH};
+        /* Only One Attacher Wins The Right To Write The Header, Its Pid Stays As The Claim */
+        if(m_Header->m_Initializer_Pid.compare_exchange_strong(Initializer,Self,std::memory_order_acq_rel)&&
+           m_Header->m_State.compare_exchange_strong(State,STATE_INITIALIZING,std::memory_order_acq_rel))
+        {
+            m_Header->m_Magic=SHARED_MAGIC;
+            m_Header->m_Version=SHARED_VERSION;
+            m_Header->m_Element_Size=static_cast<uint32_t>(sizeof(Type));
+            m_Header->m_Capacity=TOTAL_SIZE;
+            m_Header->m_Data_Offset=DATA_OFFSET;
+            m_Header->m_State.store(STATE_READY,std::memory_order_release);
+            return;
+        }
+        /* Peer Is Writing The Header Right Now "A Few Stores, Never Long" */
+        const auto Deadline{std::chrono::steady_clock::now()+std::chrono::seconds{1}};
+        while(m_Header->m_State.load(std::memory_order_acquire)!=STATE_READY&&std::chrono::steady_clock::now()<=Deadline)
+        {
+            std::this_thread::yield();
+        }
+        if(m_Header->m_State.load(std::memory_order_acquire)==STATE_READY){break;}
+        Initializer=m_Header->m_Initializer_Pid.load(std::memory_order_acquire);
+        if(Initializer!=0&&Is_Process_Alive(Initializer)){throw std::runtime_error("Shared Buffer Initialization Timed Out");}
+        /* Writer Died Before Publishing "Reopen The Header, State First So No New Claim Sees It Stuck" */
+        State=STATE_INITIALIZING;
+        m_Header->m_State.compare_exchange_strong(State,STATE_FRESH,std::memory_order_acq_rel);
+        m_Header->m_Initializer_Pid.compare_exchange_strong(Initializer,0,std::memory_order_acq_rel);
+    }
+    if(m_Header->m_Magic!=SHARED_MAGIC||m_Header->m_Version!=SHARED_VERSION||m_Header->m_Element_Size!=sizeof(Type)||
+       m_Header->m_Capacity!=TOTAL_SIZE||m_Header->m_Data_Offset!=DATA_OFFSET)
+    {
+        throw std::runtime_error("Shared Buffer Layout Mismatch");
+    }
+}
+/****************************************************************************************************
+* Function Name    : Claim_Role
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Records this process as the owner of its side of the ring.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Takes the side over from a dead process, throws if a live one holds it.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Shared_Circular_Buffer<Type, TOTAL_SIZE>::Claim_Role(void)
+{
+    std::atomic<int32_t> &Owner{(m_Role==Shared_Role::Producer)?m_Header->m_Producer_Pid:m_Header->m_Consumer_Pid};
+    const int32_t Self{static_cast<int32_t>(getpid())};
+    int32_t Current{Owner.load(std::memory_order_acquire)};
+    do
+    {
+        /* Same Process Twice Would Break Single Producer Single Consumer Too */
+        if(Current!=0&&(Current==Self||Is_Process_Alive(Current))){throw std::runtime_error("Shared Buffer Role Already Taken");}
+    }while(!Owner.compare_exchange_weak(Current,Self,std::memory_order_acq_rel));
+}
+/****************************************************************************************************
+* Function Name    : Require_Role
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Rejects calls made from the wrong side of the ring.
+* Parameters (in)  : Role - Side allowed to make the call.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if this object attached as the other side.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+void Shared_Circular_Buffer<Type, TOTAL_SIZE>::Require_Role(Shared_Role Role)const
+{
+    if(m_Role!=Role){throw std::runtime_error("Operation Not Allowed For This Role");}
+}
+/****************************************************************************************************
+* Function Name    : Is_Process_Alive
+* Class            : Shared_Circular_Buffer<Type, TOTAL_SIZE>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Checks if a process id still belongs to a running process.
+* Parameters (in)  : Process_Id - Process id recorded in the header.
+* Parameters (out) : None
+* Return value     : bool - True if the process exists.
+* Notes            : A reused process id looks alive, Remove the segment to recover from that.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE>
+bool Shared_Circular_Buffer<Type, TOTAL_SIZE>::Is_Process_Alive(int32_t Process_Id)
+{
+    /* Signal Zero Only Checks Existence, EPERM Means It Exists Under Another User */
+    return kill(static_cast<pid_t>(Process_Id),0)==0||errno==EPERM;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Shared_Circular_Buffer.hpp
+********************************************************************/
+#endif
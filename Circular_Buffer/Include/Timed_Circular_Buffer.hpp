@@ -0,0 +1,539 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Timed_Circular_Buffer.hpp
+ *  Date: November 30, 2024
+ *  Description: Timestamped circular buffer with age eviction and logarithmic time range queries
+ *  Class Name:  Timed_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _TIMED_CIRCULAR_BUFFER_HPP_
+#define _TIMED_CIRCULAR_BUFFER_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <span>
+#include <stdexcept>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+-----    Timed_Circular_Buffer     -------
+*****************************************/
+template <typename Type=int,size_t TOTAL_SIZE=10,typename CLOCK=std::chrono::steady_clock>
+class Timed_Circular_Buffer
+{
+public:
+    using Time_Point=typename CLOCK::time_point;
+    using Duration=typename CLOCK::duration;
+    /* Values And Timestamps Share Slots, So Both Split At The Same Wrap Point */
+    using Value_Buffer=Circular_Buffer<Type,TOTAL_SIZE,Overflow_Policy::Overwrite>;
+    using Timestamp_Buffer=Circular_Buffer<Time_Point,TOTAL_SIZE,Overflow_Policy::Overwrite>;
+    using Value_Regions=typename Value_Buffer::Readable_Regions;
+    using Timestamp_Regions=typename Timestamp_Buffer::Readable_Regions;
+    /* Zero Copy Result Of A Range Query, Oldest First In Both Members */
+    struct Timed_Regions
+    {
+        Value_Regions m_Values{};
+        Timestamp_Regions m_Timestamps{};
+    };
+/****************************************************************************************************
+* Constructor Name : Timed_Circular_Buffer
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs an empty timed buffer.
+* Parameters (in)  : Max_Age - Elements older than this relative to the newest push are evicted,
+*                              Duration::max() keeps elements until capacity pushes them out.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Max_Age is negative.
+*****************************************************************************************************/
+explicit Timed_Circular_Buffer(Duration Max_Age=Duration::max());
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds an element stamped with the current clock time.
+* Parameters (in)  : Element - The element to be added.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Overwrites the oldest element when full and evicts elements past Max_Age.
+*****************************************************************************************************/
+void Push(const Type& Element);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds an element with an explicit timestamp.
+* Parameters (in)  : Stamp   - Time of the element, not older than the newest stored one.
+*                    Element - The element to be added.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Overwrites the oldest element when full and evicts elements past Max_Age.
+*                    - Throws a runtime error if Stamp goes back in time, range queries rely on
+*                      timestamps being sorted.
+*****************************************************************************************************/
+void Push(Time_Point Stamp,const Type& Element);
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds an element with an explicit timestamp by moving it.
+* Parameters (in)  : Stamp   - Time of the element, not older than the newest stored one.
+*                    Element - The element to be moved.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Overwrites the oldest element when full and evicts elements past Max_Age.
+*                    - Throws a runtime error if Stamp goes back in time.
+*****************************************************************************************************/
+void Push(Time_Point Stamp,Type&& Element);
+/****************************************************************************************************
+* Function Name    : Range
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns every element stamped inside [From, To).
+* Parameters (in)  : From - First time included.
+*                    To   - First time excluded.
+* Parameters (out) : None
+* Return value     : Timed_Regions - Views over the matching values and their timestamps, second
+*                    span of each pair is empty unless the match wraps around the storage end.
+* Notes            : - Two binary searches, O(log N) whatever the window length.
+*                    - Views stay valid until the next push or eviction.
+*****************************************************************************************************/
+Timed_Regions Range(Time_Point From,Time_Point To)const;
+/****************************************************************************************************
+* Function Name    : Since
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns every element stamped at or after a given time.
+* Parameters (in)  : From - First time included.
+* Parameters (out) : None
+* Return value     : Timed_Regions - Views over the matching values and their timestamps.
+* Notes            : "Last 250 ms" is Since(CLOCK::now()-250ms).
+*****************************************************************************************************/
+Timed_Regions Since(Time_Point From)const;
+/****************************************************************************************************
+* Function Name    : Evict_Before
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes every element stamped before a given time.
+* Parameters (in)  : Cutoff - First time kept.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements removed.
+* Notes            : Binary search, then one bulk release of the oldest elements.
+*****************************************************************************************************/
+size_t Evict_Before(Time_Point Cutoff);
+/****************************************************************************************************
+* Function Name    : Evict_Expired
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes every element older than Max_Age at a given time.
+* Parameters (in)  : Now - Time the age is measured from.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements removed.
+* Notes            : Push only ages elements against the newest one, call this when pushes pause.
+*****************************************************************************************************/
+size_t Evict_Expired(Time_Point Now=CLOCK::now());
+/****************************************************************************************************
+* Function Name    : Oldest_Time
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the timestamp of the oldest element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Time_Point - Oldest timestamp.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+Time_Point Oldest_Time(void)const;
+/****************************************************************************************************
+* Function Name    : Newest_Time
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the timestamp of the newest element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Time_Point - Newest timestamp.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+Time_Point Newest_Time(void)const;
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of stored elements.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Current number of elements.
+* Notes            : None
+*****************************************************************************************************/
+size_t Size(void)const;
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer holds no element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Is_Empty(void)const;
+private:
+/****************************************************************************************************
+* Function Name    : Lower_Bound
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Finds the position of the first element stamped at or after a given time.
+* Parameters (in)  : Stamp - Time searched for.
+* Parameters (out) : None
+* Return value     : size_t - Offset from the oldest element, Size() if every element is older.
+* Notes            : Searches the two contiguous timestamp regions directly, the wrapped region only
+*                    when the first one is entirely older.
+*****************************************************************************************************/
+size_t Lower_Bound(Time_Point Stamp)const;
+/****************************************************************************************************
+* Function Name    : Slice
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Cuts [First, Last) out of a pair of regions.
+* Parameters (in)  : Regions - Oldest region first.
+*                    First   - Offset of the first element kept.
+*                    Last    - Offset of the first element dropped.
+* Parameters (out) : None
+* Return value     : Regions_Type - Matching sub spans, second is empty unless the slice wraps.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Regions_Type>
+static Regions_Type Slice(const Regions_Type& Regions,size_t First,size_t Last);
+/****************************************************************************************************
+* Function Name    : Check_Order
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Rejects timestamps older than the newest one and applies age eviction.
+* Parameters (in)  : Stamp - Time of the element about to be pushed.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Stamp goes back in time.
+*****************************************************************************************************/
+void Check_Order(Time_Point Stamp);
+private:
+    Value_Buffer m_Values;
+    Timestamp_Buffer m_Timestamps;
+    Duration m_Max_Age;
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Timed_Circular_Buffer
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Constructs an empty timed buffer.
+* Parameters (in)  : Max_Age - Elements older than this relative to the newest push are evicted,
+*                              Duration::max() keeps elements until capacity pushes them out.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Max_Age is negative.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Timed_Circular_Buffer(Duration Max_Age):
+m_Values{},m_Timestamps{},m_Max_Age{Max_Age}
+{
+    if(Max_Age<Duration::zero()){throw std::runtime_error("Maximum Age Must Not Be Negative");}
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds an element stamped with the current clock time.
+* Parameters (in)  : Element - The element to be added.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Overwrites the oldest element when full and evicts elements past Max_Age.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+void Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Push(const Type& Element)
+{
+    Push(CLOCK::now(),Element);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds an element with an explicit timestamp.
+* Parameters (in)  : Stamp   - Time of the element, not older than the newest stored one.
+*                    Element - The element to be added.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Overwrites the oldest element when full and evicts elements past Max_Age.
+*                    - Throws a runtime error if Stamp goes back in time, range queries rely on
+*                      timestamps being sorted.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+void Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Push(Time_Point Stamp,const Type& Element)
+{
+    Check_Order(Stamp);
+    /* Both Rings Overwrite Together So Slots Stay Paired */
+    m_Values.Push(Element);
+    m_Timestamps.Push(Stamp);
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds an element with an explicit timestamp by moving it.
+* Parameters (in)  : Stamp   - Time of the element, not older than the newest stored one.
+*                    Element - The element to be moved.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Overwrites the oldest element when full and evicts elements past Max_Age.
+*                    - Throws a runtime error if Stamp goes back in time.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+void Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Push(Time_Point Stamp,Type&& Element)
+{
+    Check_Order(Stamp);
+    m_Values.Push(std::move(Element));
+    m_Timestamps.Push(Stamp);
+}
+/****************************************************************************************************
+* Function Name    : Range
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns every element stamped inside [From, To).
+* Parameters (in)  : From - First time included.
+*                    To   - First time excluded.
+* Parameters (out) : None
+* Return value     : Timed_Regions - Views over the matching values and their timestamps, second
+*                    span of each pair is empty unless the match wraps around the storage end.
+* Notes            : - Two binary searches, O(log N) whatever the window length.
+*                    - Views stay valid until the next push or eviction.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+typename Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Timed_Regions Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Range(Time_Point From,Time_Point To)const
+{
+    if(To<=From){return Timed_Regions{};}
+    const size_t First{Lower_Bound(From)};
+    const size_t Last{Lower_Bound(To)};
+    return Timed_Regions{Slice(m_Values.Readable_Spans(),First,Last),Slice(m_Timestamps.Readable_Spans(),First,Last)};
+}
+/****************************************************************************************************
+* Function Name    : Since
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns every element stamped at or after a given time.
+* Parameters (in)  : From - First time included.
+* Parameters (out) : None
+* Return value     : Timed_Regions - Views over the matching values and their timestamps.
+* Notes            : "Last 250 ms" is Since(CLOCK::now()-250ms).
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+typename Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Timed_Regions Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Since(Time_Point From)const
+{
+    const size_t First{Lower_Bound(From)};
+    return Timed_Regions{Slice(m_Values.Readable_Spans(),First,Size()),Slice(m_Timestamps.Readable_Spans(),First,Size())};
+}
+/****************************************************************************************************
+* Function Name    : Evict_Before
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes every element stamped before a given time.
+* Parameters (in)  : Cutoff - First time kept.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements removed.
+* Notes            : Binary search, then one bulk release of the oldest elements.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+size_t Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Evict_Before(Time_Point Cutoff)
+{
+    const size_t Count{Lower_Bound(Cutoff)};
+    if(Count)
+    {
+        m_Values.Commit_Read(Count);
+        m_Timestamps.Commit_Read(Count);
+    }
+    return Count;
+}
+/****************************************************************************************************
+* Function Name    : Evict_Expired
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes every element older than Max_Age at a given time.
+* Parameters (in)  : Now - Time the age is measured from.
+* Parameters (out) : None
+* Return value     : size_t - Number of elements removed.
+* Notes            : Push only ages elements against the newest one, call this when pushes pause.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+size_t Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Evict_Expired(Time_Point Now)
+{
+    /* No Age Limit "Max Would Overflow The Subtraction" */
+    if(m_Max_Age==Duration::max()){return 0;}
+    return Evict_Before(Now-m_Max_Age);
+}
+/****************************************************************************************************
+* Function Name    : Oldest_Time
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the timestamp of the oldest element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Time_Point - Oldest timestamp.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+typename Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Time_Point Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Oldest_Time(void)const
+{
+    if(Is_Empty()){throw std::runtime_error("Buffer Is Empty !");}
+    return m_Timestamps[0];
+}
+/****************************************************************************************************
+* Function Name    : Newest_Time
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the timestamp of the newest element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Time_Point - Newest timestamp.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+typename Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Time_Point Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Newest_Time(void)const
+{
+    if(Is_Empty()){throw std::runtime_error("Buffer Is Empty !");}
+    return m_Timestamps[Size()-1];
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of stored elements.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Current number of elements.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+size_t Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Size(void)const
+{
+    const auto Regions{m_Timestamps.Readable_Spans()};
+    return Regions[0].size()+Regions[1].size();
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the buffer holds no element.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+bool Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Is_Empty(void)const
+{
+    return Size()==0;
+}
+/****************************************************************************************************
+* Function Name    : Lower_Bound
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Finds the position of the first element stamped at or after a given time.
+* Parameters (in)  : Stamp - Time searched for.
+* Parameters (out) : None
+* Return value     : size_t - Offset from the oldest element, Size() if every element is older.
+* Notes            : Searches the two contiguous timestamp regions directly, the wrapped region only
+*                    when the first one is entirely older.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+size_t Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Lower_Bound(Time_Point Stamp)const
+{
+    const auto Regions{m_Timestamps.Readable_Spans()};
+    /* Wrapped Region Starts Older Than Stamp, So The Whole First Region Is Older Too */
+    if(!Regions[1].empty()&&Regions[1].front()<Stamp)
+    {
+        return Regions[0].size()+static_cast<size_t>(std::lower_bound(Regions[1].begin(),Regions[1].end(),Stamp)-Regions[1].begin());
+    }
+    return static_cast<size_t>(std::lower_bound(Regions[0].begin(),Regions[0].end(),Stamp)-Regions[0].begin());
+}
+/****************************************************************************************************
+* Function Name    : Slice
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Cuts [First, Last) out of a pair of regions.
+* Parameters (in)  : Regions - Oldest region first.
+*                    First   - Offset of the first element kept.
+*                    Last    - Offset of the first element dropped.
+* Parameters (out) : None
+* Return value     : Regions_Type - Matching sub spans, second is empty unless the slice wraps.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+template <typename Regions_Type>
+Regions_Type Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Slice(const Regions_Type& Regions,size_t First,size_t Last)
+{
+    const size_t Split{Regions[0].size()};
+    if(First>=Split){return Regions_Type{Regions[1].subspan(First-Split,Last-First),Regions[1].first(0)};}
+    if(Last<=Split){return Regions_Type{Regions[0].subspan(First,Last-First),Regions[1].first(0)};}
+    return Regions_Type{Regions[0].subspan(First),Regions[1].first(Last-Split)};
+}
+/****************************************************************************************************
+* Function Name    : Check_Order
+* Class            : Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Rejects timestamps older than the newest one and applies age eviction.
+* Parameters (in)  : Stamp - Time of the element about to be pushed.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Stamp goes back in time.
+*****************************************************************************************************/
+template <typename Type, size_t TOTAL_SIZE, typename CLOCK>
+void Timed_Circular_Buffer<Type, TOTAL_SIZE, CLOCK>::Check_Order(Time_Point Stamp)
+{
+    if(!Is_Empty()&&Stamp<Newest_Time()){throw std::runtime_error("Timestamp Out Of Order");}
+    Evict_Expired(Stamp);
+}
+}
+/********************************************************************
+ *  END OF FILE:  Timed_Circular_Buffer.hpp
+********************************************************************/
+#endif
@@ -0,0 +1,561 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Window_Statistics.hpp
+ *  Date: November 30, 2024
+ *  Description: Vectorized and incremental sum, min, max, mean and variance over a window of samples
+ *  Class Name:  Rolling_Window_Statistics
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+#ifndef _WINDOW_STATISTICS_HPP_
+#define _WINDOW_STATISTICS_HPP_
+/******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Instruction Sets The Reductions Can Run On, Ordered From Slowest */
+enum class Simd_Level
+{
+    /* Plain Loop, Any Target */
+    Scalar,
+    /* 128 Bit Lanes */
+    SSE,
+    /* 256 Bit Lanes */
+    AVX2
+};
+/* Statistics Of One Window, Variance Is The Population Variance */
+template <typename Type>
+struct Window_Summary
+{
+    size_t m_Count{};
+    double m_Sum{};
+    Type m_Min{};
+    Type m_Max{};
+    double m_Mean{};
+    double m_Variance{};
+};
+/****************************************************************************************************
+* Function Name    : Best_Simd_Level
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Returns the widest instruction set the running CPU supports.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Simd_Level - Level used when callers do not ask for one.
+* Notes            : Checked once, Scalar on targets other than x86.
+*****************************************************************************************************/
+Simd_Level Best_Simd_Level(void);
+/****************************************************************************************************
+* Function Name    : Window_Statistics
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Reduces two contiguous segments of samples as one window.
+* Parameters (in)  : First  - Oldest samples, usually the first region of a ring.
+*                    Second - Remaining samples, usually the wrapped region of a ring.
+*                    Level  - Instruction set to run the reductions on.
+* Parameters (out) : None
+* Return value     : Window_Summary<float> - Statistics of both segments, all zero when empty.
+* Notes            : - Sums are accumulated in double lanes, variance is computed in a second pass.
+*                    - Throws std::runtime_error if Level is not supported by the CPU.
+*****************************************************************************************************/
+Window_Summary<float> Window_Statistics(std::span<const float> First,std::span<const float> Second,Simd_Level Level=Best_Simd_Level());
+/****************************************************************************************************
+* Function Name    : Window_Statistics
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Reduces two contiguous segments of samples as one window.
+* Parameters (in)  : First  - Oldest samples, usually the first region of a ring.
+*                    Second - Remaining samples, usually the wrapped region of a ring.
+*                    Level  - Instruction set to run the reductions on.
+* Parameters (out) : None
+* Return value     : Window_Summary<double> - Statistics of both segments, all zero when empty.
+* Notes            : - Variance is computed in a second pass around the mean.
+*                    - Throws std::runtime_error if Level is not supported by the CPU.
+*****************************************************************************************************/
+Window_Summary<double> Window_Statistics(std::span<const double> First,std::span<const double> Second,Simd_Level Level=Best_Simd_Level());
+/****************************************************************************************************
+* Function Name    : Window_Statistics
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Reduces every element of a circular buffer without walking its iterators.
+* Parameters (in)  : Buffer - Buffer holding the window.
+*                    Level  - Instruction set to run the reductions on.
+* Parameters (out) : None
+* Return value     : Window_Summary<Type> - Statistics of the buffer contents, all zero when empty.
+* Notes            : Works on the two storage regions returned by Readable_Spans.
+*****************************************************************************************************/
+template <typename Type,size_t TOTAL_SIZE,Overflow_Policy POLICY,typename STATISTICS>
+requires (std::is_same_v<Type,float>||std::is_same_v<Type,double>)
+Window_Summary<Type> Window_Statistics(const Circular_Buffer<Type,TOTAL_SIZE,POLICY,STATISTICS>& Buffer,Simd_Level Level=Best_Simd_Level())
+{
+    const auto Regions{Buffer.Readable_Spans()};
+    return Window_Statistics(Regions[0],Regions[1],Level);
+}
+/*****************************************
+----    Rolling_Window_Statistics     ----
+*****************************************/
+template <typename Type=float,size_t WINDOW_SIZE=64>
+class Rolling_Window_Statistics
+{
+static_assert(std::is_same_v<Type,float>||std::is_same_v<Type,double>,"Rolling_Window_Statistics Supports float And double Samples");
+static_assert(WINDOW_SIZE>0,"Rolling_Window_Statistics Window Must Hold At Least One Sample");
+public:
+/****************************************************************************************************
+* Constructor Name : Rolling_Window_Statistics
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Rolling_Window_Statistics class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Window starts empty.
+*****************************************************************************************************/
+Rolling_Window_Statistics();
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds a sample, dropping the oldest one once the window is full.
+* Parameters (in)  : Sample - The new sample.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Constant time, sum and variance are updated and min and max come from
+*                      monotonic deques.
+*                    - Every RESYNC_PERIOD samples sum and variance are recomputed from the window
+*                      so rounding never builds up "Amortized Constant Time".
+*****************************************************************************************************/
+void Push(Type Sample);
+/****************************************************************************************************
+* Function Name    : Count
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Samples in the window, at most WINDOW_SIZE.
+* Notes            : None
+*****************************************************************************************************/
+size_t Count(void)const;
+/****************************************************************************************************
+* Function Name    : Sum
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sum of the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Sum of the window, zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+double Sum(void)const;
+/****************************************************************************************************
+* Function Name    : Mean
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the average of the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Mean of the window, zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+double Mean(void)const;
+/****************************************************************************************************
+* Function Name    : Variance
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the population variance of the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Variance of the window, zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+double Variance(void)const;
+/****************************************************************************************************
+* Function Name    : Min
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the smallest sample in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - Smallest sample.
+* Notes            : Throws a runtime error if the window is empty.
+*****************************************************************************************************/
+Type Min(void)const;
+/****************************************************************************************************
+* Function Name    : Max
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the largest sample in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - Largest sample.
+* Notes            : Throws a runtime error if the window is empty.
+*****************************************************************************************************/
+Type Max(void)const;
+/****************************************************************************************************
+* Function Name    : Summary
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns every statistic of the window at once.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Window_Summary<Type> - Same layout Window_Statistics returns, all zero when empty.
+* Notes            : Constant time.
+*****************************************************************************************************/
+Window_Summary<Type> Summary(void)const;
+/****************************************************************************************************
+* Function Name    : Window
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Gives read access to the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Circular_Buffer<Type, WINDOW_SIZE>& - Samples, oldest first.
+* Notes            : None
+*****************************************************************************************************/
+const Circular_Buffer<Type,WINDOW_SIZE>& Window(void)const;
+    /* Pushes Between Two Exact Recomputations Of Sum And Variance */
+    static constexpr uint64_t RESYNC_PERIOD{64*static_cast<uint64_t>(WINDOW_SIZE)};
+private:
+    /*****************************************
+    ---------    Monotonic_Deque     ---------
+    *****************************************/
+    /* Candidates For The Window Extreme, Front Is The Extreme, Values Grow Less Extreme Towards The Back */
+    template <bool MINIMUM>
+    class Monotonic_Deque
+    {
+    public:
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>::Monotonic_Deque<MINIMUM>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds a sample after dropping candidates it beats and candidates out of the window.
+* Parameters (in)  : Sequence - Position of the sample in the stream.
+*                    Sample   - The new sample.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Amortized constant time, every sample enters and leaves once.
+*****************************************************************************************************/
+void Push(uint64_t Sequence,Type Sample);
+/****************************************************************************************************
+* Function Name    : Front
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>::Monotonic_Deque<MINIMUM>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the extreme of the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - Smallest sample if MINIMUM, largest otherwise.
+* Notes            : Only valid after the first Push.
+*****************************************************************************************************/
+Type Front(void)const;
+    private:
+        /* Sample Tagged With Its Stream Position "Tells When It Leaves The Window" */
+        struct Entry
+        {
+            uint64_t m_Sequence{};
+            Type m_Sample{};
+        };
+        /* Ring Of Candidates, Never More Than The Window */
+        std::array<Entry,WINDOW_SIZE> m_Entries{};
+        size_t m_Head{};
+        size_t m_Count{};
+    };
+private:
+    /* Samples In The Window, Oldest Overwritten First */
+    Circular_Buffer<Type,WINDOW_SIZE> m_Window{};
+    /* Candidates For The Smallest Sample */
+    Monotonic_Deque<true> m_Minimum{};
+    /* Candidates For The Largest Sample */
+    Monotonic_Deque<false> m_Maximum{};
+    /* Number Of Samples Pushed Since Construction */
+    uint64_t m_Pushed{};
+    /* Running Sum Of The Window */
+    double m_Sum{};
+    /* Running Mean Of The Window */
+    double m_Mean{};
+    /* Running Sum Of Squared Deviations From The Mean "Welford" */
+    double m_Squared_Deviation{};
+};
+/****************************************************************************************************
+-----------------------------------------    Definition     -----------------------------------------
+****************************************************************************************************/
+/****************************************************************************************************
+* Constructor Name : Rolling_Window_Statistics
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Rolling_Window_Statistics class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Window starts empty.
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+Rolling_Window_Statistics<Type, WINDOW_SIZE>::Rolling_Window_Statistics():
+m_Window{},m_Minimum{},m_Maximum{},m_Pushed{},m_Sum{},m_Mean{},m_Squared_Deviation{}
+{
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds a sample, dropping the oldest one once the window is full.
+* Parameters (in)  : Sample - The new sample.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Constant time, sum and variance are updated and min and max come from
+*                      monotonic deques.
+*                    - Every RESYNC_PERIOD samples sum and variance are recomputed from the window
+*                      so rounding never builds up "Amortized Constant Time".
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+void Rolling_Window_Statistics<Type, WINDOW_SIZE>::Push(Type Sample)
+{
+    const double New_Sample{static_cast<double>(Sample)};
+    if(m_Window.Size()<WINDOW_SIZE)
+    {
+        /* Growing Window "Plain Welford Step" */
+        m_Window.Push(Sample);
+        const double Delta{New_Sample-m_Mean};
+        m_Mean+=Delta/static_cast<double>(m_Window.Size());
+        m_Squared_Deviation+=Delta*(New_Sample-m_Mean);
+    }
+    else
+    {
+        /* Full Window "Swap Oldest Sample For New One In A Single Step" */
+        const double Old_Sample{static_cast<double>(m_Window[0])};
+        m_Window.Push(Sample);
+        const double Old_Mean{m_Mean};
+        m_Mean+=(New_Sample-Old_Sample)/static_cast<double>(WINDOW_SIZE);
+        m_Squared_Deviation+=(New_Sample-Old_Sample)*(New_Sample-m_Mean+Old_Sample-Old_Mean);
+        m_Sum-=Old_Sample;
+    }
+    m_Sum+=New_Sample;
+    m_Minimum.Push(m_Pushed,Sample);
+    m_Maximum.Push(m_Pushed,Sample);
+    m_Pushed++;
+    /* Drop Rounding Error Collected By The Running Updates */
+    if((m_Pushed%RESYNC_PERIOD)==0)
+    {
+        const Window_Summary<Type> Exact{Window_Statistics(m_Window)};
+        m_Sum=Exact.m_Sum;
+        m_Mean=Exact.m_Mean;
+        m_Squared_Deviation=Exact.m_Variance*static_cast<double>(Exact.m_Count);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Count
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Samples in the window, at most WINDOW_SIZE.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+size_t Rolling_Window_Statistics<Type, WINDOW_SIZE>::Count(void)const
+{
+    return static_cast<size_t>(std::min<uint64_t>(m_Pushed,WINDOW_SIZE));
+}
+/****************************************************************************************************
+* Function Name    : Sum
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sum of the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Sum of the window, zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+double Rolling_Window_Statistics<Type, WINDOW_SIZE>::Sum(void)const
+{
+    return m_Sum;
+}
+/****************************************************************************************************
+* Function Name    : Mean
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the average of the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Mean of the window, zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+double Rolling_Window_Statistics<Type, WINDOW_SIZE>::Mean(void)const
+{
+    return m_Mean;
+}
+/****************************************************************************************************
+* Function Name    : Variance
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the population variance of the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Variance of the window, zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+double Rolling_Window_Statistics<Type, WINDOW_SIZE>::Variance(void)const
+{
+    /* Running Updates May Dip Just Below Zero On Constant Input */
+    return (m_Pushed==0)?0.0:std::max(0.0,m_Squared_Deviation/static_cast<double>(Count()));
+}
+/****************************************************************************************************
+* Function Name    : Min
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the smallest sample in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - Smallest sample.
+* Notes            : Throws a runtime error if the window is empty.
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+Type Rolling_Window_Statistics<Type, WINDOW_SIZE>::Min(void)const
+{
+    if(m_Pushed==0){throw std::runtime_error("Window Is Empty !");}
+    return m_Minimum.Front();
+}
+/****************************************************************************************************
+* Function Name    : Max
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the largest sample in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - Largest sample.
+* Notes            : Throws a runtime error if the window is empty.
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+Type Rolling_Window_Statistics<Type, WINDOW_SIZE>::Max(void)const
+{
+    if(m_Pushed==0){throw std::runtime_error("Window Is Empty !");}
+    return m_Maximum.Front();
+}
+/****************************************************************************************************
+* Function Name    : Summary
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns every statistic of the window at once.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Window_Summary<Type> - Same layout Window_Statistics returns, all zero when empty.
+* Notes            : Constant time.
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+Window_Summary<Type> Rolling_Window_Statistics<Type, WINDOW_SIZE>::Summary(void)const
+{
+    if(m_Pushed==0){return Window_Summary<Type>{};}
+    return Window_Summary<Type>{Count(),m_Sum,m_Minimum.Front(),m_Maximum.Front(),m_Mean,Variance()};
+}
+/****************************************************************************************************
+* Function Name    : Window
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Gives read access to the samples in the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const Circular_Buffer<Type, WINDOW_SIZE>& - Samples, oldest first.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+const Circular_Buffer<Type,WINDOW_SIZE>& Rolling_Window_Statistics<Type, WINDOW_SIZE>::Window(void)const
+{
+    return m_Window;
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>::Monotonic_Deque<MINIMUM>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds a sample after dropping candidates it beats and candidates out of the window.
+* Parameters (in)  : Sequence - Position of the sample in the stream.
+*                    Sample   - The new sample.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Amortized constant time, every sample enters and leaves once.
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+template <bool MINIMUM>
+void Rolling_Window_Statistics<Type, WINDOW_SIZE>::Monotonic_Deque<MINIMUM>::Push(uint64_t Sequence,Type Sample)
+{
+    /* Front Leaves Once It Is A Full Window Old */
+    if(m_Count&&(Sequence-m_Entries[m_Head].m_Sequence>=WINDOW_SIZE))
+    {
+        m_Head=(m_Head+1)%WINDOW_SIZE;
+        m_Count--;
+    }
+    /* Back Candidates No Better Than The New Sample Can Never Be The Extreme Again */
+    while(m_Count)
+    {
+        const Type Back{m_Entries[(m_Head+m_Count-1)%WINDOW_SIZE].m_Sample};
+        if(MINIMUM?(Back<Sample):(Back>Sample)){break;}
+        m_Count--;
+    }
+    m_Entries[(m_Head+m_Count)%WINDOW_SIZE]=Entry{Sequence,Sample};
+    m_Count++;
+}
+/****************************************************************************************************
+* Function Name    : Front
+* Class            : Rolling_Window_Statistics<Type, WINDOW_SIZE>::Monotonic_Deque<MINIMUM>
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the extreme of the window.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Type - Smallest sample if MINIMUM, largest otherwise.
+* Notes            : Only valid after the first Push.
+*****************************************************************************************************/
+template <typename Type, size_t WINDOW_SIZE>
+template <bool MINIMUM>
+Type Rolling_Window_Statistics<Type, WINDOW_SIZE>::Monotonic_Deque<MINIMUM>::Front(void)const
+{
+    return m_Entries[m_Head].m_Sample;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Window_Statistics.hpp
+********************************************************************/
+#endif
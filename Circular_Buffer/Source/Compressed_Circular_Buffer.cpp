@@ -0,0 +1,230 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Compressed_Circular_Buffer.cpp
+ *  Date: November 30, 2024
+ *  Description: Scalar and vectorized decoders for delta of delta varint blocks
+ *  Class Name:  None
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Compressed_Circular_Buffer.hpp"
+#include <algorithm>
+#include <cstring>
+#if defined(__x86_64__)||defined(__i386__)
+#include <immintrin.h>
+#define COMPRESSED_CIRCULAR_BUFFER_HAS_X86
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Varint Decoder Writing Unzigzagged Values, Returns Bytes Consumed */
+using Varint_Decoder=size_t(*)(std::span<const uint8_t>,std::span<int64_t>);
+/*****************************************
+------------    Scalar     ---------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : Unzigzag
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Turns a zigzag encoded value back into a signed one.
+* Parameters (in)  : Value - Zigzag value, bit zero holds the sign.
+* Parameters (out) : None
+* Return value     : int64_t - Signed value.
+* Notes            : None
+*****************************************************************************************************/
+static inline int64_t Unzigzag(uint64_t Value)
+{
+    return static_cast<int64_t>((Value>>1)^(~(Value&1)+1));
+}
+/****************************************************************************************************
+* Function Name    : Scalar_Decode_One
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Decodes one varint a byte at a time.
+* Parameters (in)  : Bytes    - Encoded stream.
+*                    Position - Offset of the first byte of the varint.
+* Parameters (out) : Value    - Receives the signed value.
+* Return value     : size_t - Offset just after the varint.
+* Notes            : Throws std::runtime_error if the stream ends early or the varint is too long.
+*****************************************************************************************************/
+static inline size_t Scalar_Decode_One(std::span<const uint8_t> Bytes,size_t Position,int64_t& Value)
+{
+    uint64_t Zigzag{};
+    for(unsigned Shift{};Shift<7*MAX_VARINT_BYTES;Shift+=7)
+    {
+        if(Position>=Bytes.size()){break;}
+        const uint8_t Byte{Bytes[Position++]};
+        Zigzag|=static_cast<uint64_t>(Byte&0x7F)<<Shift;
+        if(!(Byte&0x80))
+        {
+            Value=Unzigzag(Zigzag);
+            return Position;
+        }
+    }
+    throw std::runtime_error("Corrupt Compressed Block");
+}
+/****************************************************************************************************
+* Function Name    : Scalar_Decode_Varints
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Decodes a run of varints one byte at a time.
+* Parameters (in)  : Bytes  - Encoded stream.
+* Parameters (out) : Values - Receives Values.size() signed values.
+* Return value     : size_t - Number of bytes consumed.
+* Notes            : Also finishes the tail the vector decoders leave behind.
+*****************************************************************************************************/
+static size_t Scalar_Decode_Varints(std::span<const uint8_t> Bytes,std::span<int64_t> Values)
+{
+    size_t Position{};
+    for(int64_t& Value:Values){Position=Scalar_Decode_One(Bytes,Position,Value);}
+    return Position;
+}
+#ifdef COMPRESSED_CIRCULAR_BUFFER_HAS_X86
+/*****************************************
+--------------    SSE     ----------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : SSE_Decode_Varints
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Decodes varints finding runs of one byte values sixteen bytes at a time.
+* Parameters (in)  : Bytes  - Encoded stream.
+* Parameters (out) : Values - Receives Values.size() signed values.
+* Return value     : size_t - Number of bytes consumed.
+* Notes            : The byte mask tells how many leading bytes have no continuation bit, those
+*                    are widened in a plain loop the compiler vectorizes.
+*****************************************************************************************************/
+__attribute__((target("sse2")))
+static size_t SSE_Decode_Varints(std::span<const uint8_t> Bytes,std::span<int64_t> Values)
+{
+    size_t Position{};
+    size_t Index{};
+    while(Index<Values.size()&&Bytes.size()-Position>=16)
+    {
+        const __m128i Chunk{_mm_loadu_si128(reinterpret_cast<const __m128i*>(Bytes.data()+Position))};
+        const unsigned Mask{static_cast<unsigned>(_mm_movemask_epi8(Chunk))};
+        /* Leading Bytes Without Continuation Bit Are Whole Varints */
+        const size_t Run{std::min<size_t>(Mask?static_cast<size_t>(__builtin_ctz(Mask)):16,Values.size()-Index)};
+        for(size_t Counter{};Counter<Run;Counter++){Values[Index+Counter]=Unzigzag(Bytes[Position+Counter]);}
+        Position+=Run;
+        Index+=Run;
+        if(Run<16&&Index<Values.size()){Position=Scalar_Decode_One(Bytes,Position,Values[Index++]);}
+    }
+    return Position+Scalar_Decode_Varints(Bytes.subspan(Position),Values.subspan(Index));
+}
+/*****************************************
+--------------    AVX2     ---------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : AVX2_Decode_Varints
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Decodes varints finding runs of one byte values thirty two bytes at a time.
+* Parameters (in)  : Bytes  - Encoded stream.
+* Parameters (out) : Values - Receives Values.size() signed values.
+* Return value     : size_t - Number of bytes consumed.
+* Notes            : Runs are widened four bytes to four 64 bit lanes and unzigzagged in registers.
+*****************************************************************************************************/
+__attribute__((target("avx2")))
+static size_t AVX2_Decode_Varints(std::span<const uint8_t> Bytes,std::span<int64_t> Values)
+{
+    const __m256i One{_mm256_set1_epi64x(1)};
+    const __m256i Zero{_mm256_setzero_si256()};
+    size_t Position{};
+    size_t Index{};
+    while(Index<Values.size()&&Bytes.size()-Position>=32)
+    {
+        const __m256i Chunk{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Bytes.data()+Position))};
+        const unsigned Mask{static_cast<unsigned>(_mm256_movemask_epi8(Chunk))};
+        /* Leading Bytes Without Continuation Bit Are Whole Varints */
+        const size_t Run{std::min<size_t>(Mask?static_cast<size_t>(__builtin_ctz(Mask)):32,Values.size()-Index)};
+        size_t Counter{};
+        for(;Counter+4<=Run;Counter+=4)
+        {
+            int32_t Four{};
+            std::memcpy(&Four,Bytes.data()+Position+Counter,sizeof(Four));
+            const __m256i Wide{_mm256_cvtepu8_epi64(_mm_cvtsi32_si128(Four))};
+            /* (Value >> 1) ^ -(Value & 1) */
+            const __m256i Sign{_mm256_sub_epi64(Zero,_mm256_and_si256(Wide,One))};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(Values.data()+Index+Counter),_mm256_xor_si256(_mm256_srli_epi64(Wide,1),Sign));
+        }
+        for(;Counter<Run;Counter++){Values[Index+Counter]=Unzigzag(Bytes[Position+Counter]);}
+        Position+=Run;
+        Index+=Run;
+        if(Run<32&&Index<Values.size()){Position=Scalar_Decode_One(Bytes,Position,Values[Index++]);}
+    }
+    return Position+Scalar_Decode_Varints(Bytes.subspan(Position),Values.subspan(Index));
+}
+#endif
+/*****************************************
+-----------    Dispatch     --------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : Select_Decoder
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Returns the varint decoder built for an instruction set.
+* Parameters (in)  : Level - Instruction set asked for.
+* Parameters (out) : None
+* Return value     : Varint_Decoder - Decoder to run.
+* Notes            : Throws std::runtime_error if Level is wider than Best_Simd_Level.
+*****************************************************************************************************/
+static Varint_Decoder Select_Decoder(Simd_Level Level)
+{
+    if(Level>Best_Simd_Level()){throw std::runtime_error("Simd Level Not Supported By This Cpu");}
+#ifdef COMPRESSED_CIRCULAR_BUFFER_HAS_X86
+    if(Level==Simd_Level::AVX2){return AVX2_Decode_Varints;}
+    if(Level==Simd_Level::SSE){return SSE_Decode_Varints;}
+#endif
+    return Scalar_Decode_Varints;
+}
+/****************************************************************************************************
+* Function Name    : Decode_Delta_Block
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Rebuilds the samples of one block from its first value and encoded deltas of deltas.
+* Parameters (in)  : Bytes - Encoded stream, may extend past the encoded data.
+*                    First - First sample of the block.
+*                    Level - Instruction set to run the varint decoder on.
+* Parameters (out) : Samples - Receives Samples.size() samples, the first one is First.
+* Return value     : size_t - Number of bytes consumed.
+* Notes            : - Runs of one byte varints are found with a byte mask compare and widened a
+*                      vector at a time, longer varints fall back to the scalar decoder.
+*                    - Throws std::runtime_error if the stream ends early or a varint is too long.
+*                    - Throws std::runtime_error if Level is not supported by the CPU.
+*****************************************************************************************************/
+size_t Decode_Delta_Block(std::span<const uint8_t> Bytes,int64_t First,std::span<int64_t> Samples,Simd_Level Level)
+{
+    const Varint_Decoder Decoder{Select_Decoder(Level)};
+    if(Samples.empty()){return 0;}
+    /* Deltas Of Deltas Land In Place, Then Two Running Sums Turn Them Into Samples */
+    const size_t Consumed{Decoder(Bytes,Samples.subspan(1))};
+    Samples[0]=First;
+    uint64_t Value{static_cast<uint64_t>(First)};
+    uint64_t Delta{};
+    for(size_t Index{1};Index<Samples.size();Index++)
+    {
+        Delta+=static_cast<uint64_t>(Samples[Index]);
+        Value+=Delta;
+        Samples[Index]=static_cast<int64_t>(Value);
+    }
+    return Consumed;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Compressed_Circular_Buffer.cpp
+********************************************************************/
@@ -0,0 +1,231 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Latency_Histogram.cpp
+ *  Date: November 30, 2024
+ *  Description: Log bucketed histogram with bounded relative error for latency percentiles
+ *  Class Name:  Latency_Histogram
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Latency_Histogram.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+--------    Latency_Histogram     --------
+*****************************************/
+/****************************************************************************************************
+* Constructor Name : Latency_Histogram
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Default constructor for the Latency_Histogram class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Allocates every bucket up front so Record never allocates.
+*****************************************************************************************************/
+Latency_Histogram::Latency_Histogram():
+m_Counts(BUCKET_COUNT,0),m_Total_Count{},m_Min{},m_Max{},m_Sum{}
+{
+}
+/****************************************************************************************************
+* Function Name    : Record
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Counts one value.
+* Parameters (in)  : Value - Value to count, usually a latency in nanoseconds.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Constant time, a bit scan and a shift "No Floating Point".
+*****************************************************************************************************/
+void Latency_Histogram::Record(uint64_t Value)
+{
+    m_Counts[Bucket_Index(Value)]++;
+    /* First Value Sets Both Bounds */
+    m_Min=(m_Total_Count==0)?Value:std::min(m_Min,Value);
+    m_Max=std::max(m_Max,Value);
+    m_Sum+=static_cast<double>(Value);
+    m_Total_Count++;
+}
+/****************************************************************************************************
+* Function Name    : Merge
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Adds the counts of another histogram to this one.
+* Parameters (in)  : Object - Histogram to add, usually filled by another thread.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Latency_Histogram::Merge(const Latency_Histogram& Object)
+{
+    if(Object.m_Total_Count==0){return;}
+    for(size_t Index{};Index<BUCKET_COUNT;Index++){m_Counts[Index]+=Object.m_Counts[Index];}
+    m_Min=(m_Total_Count==0)?Object.m_Min:std::min(m_Min,Object.m_Min);
+    m_Max=std::max(m_Max,Object.m_Max);
+    m_Sum+=Object.m_Sum;
+    m_Total_Count+=Object.m_Total_Count;
+}
+/****************************************************************************************************
+* Function Name    : Percentile
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the value below which a given share of the recorded values fall.
+* Parameters (in)  : Percent - Share of values in percent, 50 for the median.
+* Parameters (out) : None
+* Return value     : uint64_t - Highest value equivalent to the bucket holding the percentile.
+* Notes            : - Relative error is below 2^(1-SUB_BUCKET_BITS) "Under 1.6%".
+*                    - Never larger than Max, zero when nothing was recorded.
+*****************************************************************************************************/
+uint64_t Latency_Histogram::Percentile(double Percent)const
+{
+    if(m_Total_Count==0){return 0;}
+    /* Rank Of The Wanted Value, At Least The First One */
+    Percent=std::clamp(Percent,0.0,100.0);
+    const uint64_t Rank{std::max<uint64_t>(1,static_cast<uint64_t>(std::ceil(Percent/100.0*static_cast<double>(m_Total_Count))))};
+    uint64_t Seen{};
+    for(size_t Index{};Index<BUCKET_COUNT;Index++)
+    {
+        Seen+=m_Counts[Index];
+        if(Seen>=Rank){return std::clamp(Highest_Equivalent_Value(Index),m_Min,m_Max);}
+    }
+    return m_Max;
+}
+/****************************************************************************************************
+* Function Name    : Count
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of recorded values.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Number of recorded values.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Latency_Histogram::Count(void)const
+{
+    return m_Total_Count;
+}
+/****************************************************************************************************
+* Function Name    : Min
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the smallest recorded value.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Exact smallest value, zero when nothing was recorded.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Latency_Histogram::Min(void)const
+{
+    return m_Min;
+}
+/****************************************************************************************************
+* Function Name    : Max
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the largest recorded value.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Exact largest value, zero when nothing was recorded.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Latency_Histogram::Max(void)const
+{
+    return m_Max;
+}
+/****************************************************************************************************
+* Function Name    : Mean
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the average of the recorded values.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : double - Exact average, zero when nothing was recorded.
+* Notes            : None
+*****************************************************************************************************/
+double Latency_Histogram::Mean(void)const
+{
+    return (m_Total_Count==0)?0.0:(m_Sum/static_cast<double>(m_Total_Count));
+}
+/****************************************************************************************************
+* Function Name    : Reset
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Forgets every recorded value.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Keeps the buckets allocated.
+*****************************************************************************************************/
+void Latency_Histogram::Reset(void)
+{
+    std::fill(m_Counts.begin(),m_Counts.end(),0);
+    m_Total_Count=0;
+    m_Min=0;
+    m_Max=0;
+    m_Sum=0.0;
+}
+/****************************************************************************************************
+* Function Name    : Bucket_Index
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the bucket counting a value.
+* Parameters (in)  : Value - Value to place.
+* Parameters (out) : None
+* Return value     : size_t - Index inside the bucket array.
+* Notes            : None
+*****************************************************************************************************/
+size_t Latency_Histogram::Bucket_Index(uint64_t Value)
+{
+    /* Small Values Get One Bucket Each */
+    if(Value<SUB_BUCKET_COUNT){return static_cast<size_t>(Value);}
+    /* Keep Top SUB_BUCKET_BITS-1 Bits Below The Leading One "Same Relative Width In Every Octave" */
+    const size_t Exponent{static_cast<size_t>(std::bit_width(Value))-1};
+    const size_t Shift{Exponent-(SUB_BUCKET_BITS-1)};
+    return SUB_BUCKET_COUNT+(Exponent-SUB_BUCKET_BITS)*HALF_SUB_BUCKET_COUNT+(static_cast<size_t>(Value>>Shift)-HALF_SUB_BUCKET_COUNT);
+}
+/****************************************************************************************************
+* Function Name    : Highest_Equivalent_Value
+* Class            : Latency_Histogram
+* Namespace        : Data_Structure
+* Type             : Private
+* Description      : Returns the largest value that falls in a bucket.
+* Parameters (in)  : Index - Index inside the bucket array.
+* Parameters (out) : None
+* Return value     : uint64_t - Upper bound of the bucket "Inclusive".
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Latency_Histogram::Highest_Equivalent_Value(size_t Index)
+{
+    if(Index<SUB_BUCKET_COUNT){return Index;}
+    /* Undo Bucket_Index "Octave Then Position Inside It" */
+    const size_t Exponent{(Index-SUB_BUCKET_COUNT)/HALF_SUB_BUCKET_COUNT+SUB_BUCKET_BITS};
+    const size_t Sub_Bucket{(Index-SUB_BUCKET_COUNT)%HALF_SUB_BUCKET_COUNT};
+    const size_t Shift{Exponent-(SUB_BUCKET_BITS-1)};
+    const uint64_t Lowest{static_cast<uint64_t>(HALF_SUB_BUCKET_COUNT+Sub_Bucket)<<Shift};
+    return Lowest+((uint64_t{1}<<Shift)-1);
+}
+}
+/********************************************************************
+ *  END OF FILE:  Latency_Histogram.cpp
+********************************************************************/
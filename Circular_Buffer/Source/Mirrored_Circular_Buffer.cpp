@@ -0,0 +1,355 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Mirrored_Circular_Buffer.cpp
+ *  Date: November 30, 2024
+ *  Description: Byte ring whose storage is mapped twice back to back so every region is contiguous
+ *  Class Name:  Mirrored_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Mirrored_Circular_Buffer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/*****************************************
+-----    Mirrored_Circular_Buffer     ----
+*****************************************/
+/****************************************************************************************************
+* Constructor Name : Mirrored_Circular_Buffer
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Allocates the byte ring and maps its pages twice back to back.
+* Parameters (in)  : Minimum_Capacity - Requested capacity in bytes.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Capacity is rounded up to a whole number of pages.
+*                    - Throws a runtime error if the memfd or any mapping cannot be created.
+*****************************************************************************************************/
+Mirrored_Circular_Buffer::Mirrored_Circular_Buffer(size_t Minimum_Capacity):
+m_Capacity{},m_Current_Size{},m_Head_Index{},m_Data{}
+{
+    /* Round Capacity Up To Whole Pages "Mappings Are Page Granular" */
+    const size_t Page_Size{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+    m_Capacity=((Minimum_Capacity?Minimum_Capacity:1)+Page_Size-1)/Page_Size*Page_Size;
+    /* Anonymous File Backing Both Views */
+    const int File_Descriptor{memfd_create("Mirrored_Circular_Buffer",MFD_CLOEXEC)};
+    if(File_Descriptor<0){throw std::runtime_error("Buffer Memory File Creation Failed");}
+    if(ftruncate(File_Descriptor,static_cast<off_t>(m_Capacity))<0)
+    {
+        close(File_Descriptor);
+        throw std::runtime_error("Buffer Memory File Resize Failed");
+    }
+    /* Reserve Twice The Capacity Then Map The Same Pages Into Both Halves */
+    void *Reserved{mmap(nullptr,2*m_Capacity,PROT_NONE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0)};
+    if(Reserved==MAP_FAILED)
+    {
+        close(File_Descriptor);
+        throw std::runtime_error("Buffer Address Reservation Failed");
+    }
+    m_Data=static_cast<uint8_t*>(Reserved);
+    const bool First_View{mmap(m_Data,m_Capacity,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_FIXED,File_Descriptor,0)!=MAP_FAILED};
+    const bool Second_View{First_View&&(mmap(m_Data+m_Capacity,m_Capacity,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_FIXED,File_Descriptor,0)!=MAP_FAILED)};
+    /* Mappings Keep The File Alive */
+    close(File_Descriptor);
+    if(!Second_View)
+    {
+        munmap(m_Data,2*m_Capacity);
+        throw std::runtime_error("Buffer Mirror Mapping Failed");
+    }
+}
+/****************************************************************************************************
+* Function Name    : ~Mirrored_Circular_Buffer (Destructor)
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Mirrored_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Unmaps both views of the storage.
+*****************************************************************************************************/
+Mirrored_Circular_Buffer::~Mirrored_Circular_Buffer()
+{
+    munmap(m_Data,2*m_Capacity);
+}
+/****************************************************************************************************
+* Function Name    : Head
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns a reference to the byte at the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : const uint8_t& - Reference to the byte at the head of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+const uint8_t& Mirrored_Circular_Buffer::Head(void)const
+{
+    return m_Data[m_Head_Index];
+}
+/****************************************************************************************************
+* Function Name    : Push
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a new byte into the circular buffer.
+* Parameters (in)  : Element - The byte to be pushed into the buffer.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Overwrites the oldest byte when the buffer is full "Same As Circular_Buffer".
+*****************************************************************************************************/
+void Mirrored_Circular_Buffer::Push(uint8_t Element)
+{
+    /* Appned New Byte */
+    m_Data[Tail_Index()]=Element;
+    /* Check If Head Need Move "Care About Head Overflow" */
+    if(m_Current_Size==m_Capacity){Advance_Head(1);}
+    m_Current_Size++;
+}
+/****************************************************************************************************
+* Function Name    : Pop
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes and returns the byte from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint8_t - The byte removed from the buffer.
+* Notes            : Throws a runtime error if the buffer is empty.
+*****************************************************************************************************/
+uint8_t Mirrored_Circular_Buffer::Pop(void)
+{
+    /* Buffer Is Empty */
+    if(Is_Empty()){throw std::runtime_error("Buffer Is Empty !");}
+    const uint8_t Return_Data{m_Data[m_Head_Index]};
+    Advance_Head(1);
+    return Return_Data;
+}
+/****************************************************************************************************
+* Function Name    : Push_N
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Pushes a batch of bytes into the circular buffer.
+* Parameters (in)  : Elements - Contiguous bytes to be pushed in order.
+* Parameters (out) : None
+* Return value     : size_t - Number of bytes taken from Elements.
+* Notes            : Single memcpy thanks to the mirror, overwrites the oldest bytes on overflow.
+*****************************************************************************************************/
+size_t Mirrored_Circular_Buffer::Push_N(std::span<const uint8_t> Elements)
+{
+    const size_t Total_Elements{Elements.size()};
+    /* Bytes That Would Be Overwritten In The Same Batch Are Skipped */
+    if(Total_Elements>m_Capacity){Elements=Elements.last(m_Capacity);}
+    /* Drop Oldest Bytes To Make Room "Care About Head Overflow" */
+    const size_t Free_Bytes{m_Capacity-m_Current_Size};
+    if(Elements.size()>Free_Bytes){Advance_Head(Elements.size()-Free_Bytes);}
+    /* Tail View Is Contiguous Across The Wrap Point */
+    if(!Elements.empty()){std::memcpy(m_Data+Tail_Index(),Elements.data(),Elements.size());}
+    m_Current_Size+=Elements.size();
+    return Total_Elements;
+}
+/****************************************************************************************************
+* Function Name    : Pop_N
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Removes a batch of bytes from the head of the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : Elements - Receives the removed bytes in order.
+* Return value     : size_t - Number of bytes removed "Smaller Of Size And Elements Size".
+* Notes            : Single memcpy thanks to the mirror, never throws.
+*****************************************************************************************************/
+size_t Mirrored_Circular_Buffer::Pop_N(std::span<uint8_t> Elements)
+{
+    const size_t Total_Elements{std::min(Elements.size(),m_Current_Size)};
+    if(Total_Elements){std::memcpy(Elements.data(),m_Data+m_Head_Index,Total_Elements);}
+    Advance_Head(Total_Elements);
+    return Total_Elements;
+}
+/****************************************************************************************************
+* Function Name    : Readable_Span
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns one contiguous view over every occupied byte.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::span<const uint8_t> - Oldest byte first, never split at the wrap point.
+* Notes            : Parsers can run straight over the view, call Commit_Read when done.
+*****************************************************************************************************/
+std::span<const uint8_t> Mirrored_Circular_Buffer::Readable_Span(void)const
+{
+    return std::span<const uint8_t>(m_Data+m_Head_Index,m_Current_Size);
+}
+/****************************************************************************************************
+* Function Name    : Writable_Span
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns one contiguous view over every free byte.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : std::span<uint8_t> - Free bytes in push order, never split at the wrap point.
+* Notes            : Data written into the view becomes visible after Commit_Write.
+*****************************************************************************************************/
+std::span<uint8_t> Mirrored_Circular_Buffer::Writable_Span(void)
+{
+    return std::span<uint8_t>(m_Data+Tail_Index(),m_Capacity-m_Current_Size);
+}
+/****************************************************************************************************
+* Function Name    : Readable_Spans
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Circular_Buffer compatible form of Readable_Span.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Readable_Regions - Whole occupied region first, second span always empty.
+* Notes            : None
+*****************************************************************************************************/
+Mirrored_Circular_Buffer::Readable_Regions Mirrored_Circular_Buffer::Readable_Spans(void)const
+{
+    return Readable_Regions{Readable_Span(),std::span<const uint8_t>{}};
+}
+/****************************************************************************************************
+* Function Name    : Writable_Spans
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Circular_Buffer compatible form of Writable_Span.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Writable_Regions - Whole free region first, second span always empty.
+* Notes            : None
+*****************************************************************************************************/
+Mirrored_Circular_Buffer::Writable_Regions Mirrored_Circular_Buffer::Writable_Spans(void)
+{
+    return Writable_Regions{Writable_Span(),std::span<uint8_t>{}};
+}
+/****************************************************************************************************
+* Function Name    : Commit_Read
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Releases bytes consumed through Readable_Span.
+* Parameters (in)  : Count - Number of bytes consumed from the head.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the current size.
+*****************************************************************************************************/
+void Mirrored_Circular_Buffer::Commit_Read(size_t Count)
+{
+    if(Count<=m_Current_Size){Advance_Head(Count);}
+    else{throw std::runtime_error("Commit Read Out Of Range");}
+}
+/****************************************************************************************************
+* Function Name    : Commit_Write
+* Class            : Mirrored_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Publishes bytes written through Writable_Span.
+* Parameters (in)  : Count - Number of bytes written after the tail.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if Count is larger than the free space.
+*****************************************************************************************************/
+void Mirrored_Circular_Buffer::Commit_Write(size_t Count)
+{
+    if(Count<=m_Capacity-m_Current_Size){m_Current_Size+=Count;}
+    else{throw std::runtime_error("Commit Write Out Of Range");}
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Mirrored_Circular_Buffer
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the current number of bytes in the circular buffer.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - The current size of the buffer.
+* Notes            : None
+*****************************************************************************************************/
+size_t Mirrored_Circular_Buffer::Size(void)const
+{
+    return m_Current_Size;
+}
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Mirrored_Circular_Buffer
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Returns the total number of bytes the circular buffer can hold.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Capacity after rounding up to whole pages.
+* Notes            : None
+*****************************************************************************************************/
+size_t Mirrored_Circular_Buffer::Capacity(void)const
+{
+    return m_Capacity;
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Mirrored_Circular_Buffer
+* Type             : Public
+* Namespace        : Data_Structure
+* Description      : Checks if the circular buffer is empty.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the buffer is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Mirrored_Circular_Buffer::Is_Empty(void)const
+{
+    return m_Current_Size==0;
+}
+/****************************************************************************************************
+* Function Name    : Tail_Index
+* Class            : Mirrored_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the index of the next byte to push in.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Tail index inside the first view.
+* Notes            : None
+*****************************************************************************************************/
+size_t Mirrored_Circular_Buffer::Tail_Index(void)const
+{
+    const size_t Tail{m_Head_Index+m_Current_Size};
+    return (Tail>=m_Capacity)?(Tail-m_Capacity):Tail;
+}
+/****************************************************************************************************
+* Function Name    : Advance_Head
+* Class            : Mirrored_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Drops bytes from the head.
+* Parameters (in)  : Count - Number of bytes to drop "Not Larger Than Size".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Mirrored_Circular_Buffer::Advance_Head(size_t Count)
+{
+    m_Head_Index+=Count;
+    m_Head_Index=(m_Head_Index>=m_Capacity)?(m_Head_Index-m_Capacity):m_Head_Index;
+    m_Current_Size-=Count;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Mirrored_Circular_Buffer.cpp
+********************************************************************/
@@ -0,0 +1,599 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Persistent_Circular_Buffer.cpp
+ *  Date: November 30, 2024
+ *  Description: File backed ring log of checksummed records that keeps the newest ones across crashes
+ *  Class Name:  Persistent_Circular_Buffer
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Persistent_Circular_Buffer.hpp"
+#include <array>
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define PERSISTENT_CIRCULAR_BUFFER_HAS_CRC32
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* First Bytes Of The File, Identify The Layout The Records Were Written With */
+struct File_Header
+{
+    uint64_t m_Magic;
+    uint32_t m_Version;
+    uint32_t m_Header_Size;
+    uint64_t m_Capacity;
+};
+static constexpr uint64_t FILE_MAGIC{0x474F4C474E495250};
+static constexpr uint32_t FILE_VERSION{1};
+/* Reflected CRC-32C "Castagnoli" Polynomial, Same One The SSE4.2 Instruction Uses */
+static constexpr uint32_t CRC32C_POLYNOMIAL{0x82F63B78u};
+static constexpr std::array<uint32_t,256> CRC32C_TABLE{[]
+{
+    std::array<uint32_t,256> Table{};
+    for(uint32_t Byte{};Byte<256;Byte++)
+    {
+        uint32_t Remainder{Byte};
+        for(int Bit{};Bit<8;Bit++){Remainder=(Remainder>>1)^((Remainder&1u)?CRC32C_POLYNOMIAL:0u);}
+        Table[Byte]=Remainder;
+    }
+    return Table;
+}()};
+/*****************************************
+------------    Checksum     -------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : Scalar_Crc32c
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Folds bytes into a running CRC-32C one byte at a time.
+* Parameters (in)  : Crc   - Running value.
+*                    Bytes - Data to fold in.
+* Parameters (out) : None
+* Return value     : uint32_t - Updated running value.
+* Notes            : Used when the CPU has no CRC32 instruction.
+*****************************************************************************************************/
+static uint32_t Scalar_Crc32c(uint32_t Crc,std::span<const uint8_t> Bytes)
+{
+    for(const uint8_t Byte:Bytes){Crc=(Crc>>8)^CRC32C_TABLE[(Crc^Byte)&0xFFu];}
+    return Crc;
+}
+#ifdef PERSISTENT_CIRCULAR_BUFFER_HAS_CRC32
+/****************************************************************************************************
+* Function Name    : SSE42_Crc32c
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Folds bytes into a running CRC-32C eight bytes at a time.
+* Parameters (in)  : Crc   - Running value.
+*                    Bytes - Data to fold in.
+* Parameters (out) : None
+* Return value     : uint32_t - Updated running value, same as Scalar_Crc32c.
+* Notes            : Recovery checksums every record, this keeps the startup scan short.
+*****************************************************************************************************/
+__attribute__((target("sse4.2")))
+static uint32_t SSE42_Crc32c(uint32_t Crc,std::span<const uint8_t> Bytes)
+{
+    const uint8_t *Data{Bytes.data()};
+    size_t Remaining{Bytes.size()};
+    uint64_t Wide_Crc{Crc};
+    for(;Remaining>=8;Remaining-=8,Data+=8)
+    {
+        uint64_t Word{};
+        std::memcpy(&Word,Data,8);
+        Wide_Crc=_mm_crc32_u64(Wide_Crc,Word);
+    }
+    Crc=static_cast<uint32_t>(Wide_Crc);
+    for(;Remaining;Remaining--,Data++){Crc=_mm_crc32_u8(Crc,*Data);}
+    return Crc;
+}
+#endif
+/****************************************************************************************************
+* Function Name    : Record_Checksum
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Computes the checksum stored in a record header.
+* Parameters (in)  : Length   - Length field of the header.
+*                    Sequence - Sequence field of the header.
+*                    Payload  - Payload bytes, empty for wrap markers.
+* Parameters (out) : None
+* Return value     : uint32_t - CRC-32C over length, sequence and payload.
+* Notes            : Instruction set is picked once.
+*****************************************************************************************************/
+static uint32_t Record_Checksum(uint32_t Length,uint64_t Sequence,std::span<const uint8_t> Payload)
+{
+#ifdef PERSISTENT_CIRCULAR_BUFFER_HAS_CRC32
+    static uint32_t (*const Crc32c)(uint32_t,std::span<const uint8_t>){__builtin_cpu_supports("sse4.2")?SSE42_Crc32c:Scalar_Crc32c};
+#else
+    static uint32_t (*const Crc32c)(uint32_t,std::span<const uint8_t>){Scalar_Crc32c};
+#endif
+    uint8_t Fields[12]{};
+    std::memcpy(Fields,&Length,4);
+    std::memcpy(Fields+4,&Sequence,8);
+    return ~Crc32c(Crc32c(0xFFFFFFFFu,std::span<const uint8_t>(Fields)),Payload);
+}
+/*****************************************
+----    Persistent_Circular_Buffer     ---
+*****************************************/
+/****************************************************************************************************
+* Constructor Name : Persistent_Circular_Buffer
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Opens or creates the log file, maps it and recovers the records it holds.
+* Parameters (in)  : Path     - Log file, created when missing.
+*                    Capacity - Bytes of record storage, headers included.
+*                    Policy   - When appended records are synced to the file.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Capacity is rounded up to RECORD_ALIGNMENT.
+*                    - Recovery is one scan over the mapping, records failing their checksum
+*                      are dropped together with everything appended after them.
+*                    - Throws a runtime error if the file cannot be mapped or was created with
+*                      another capacity.
+*****************************************************************************************************/
+Persistent_Circular_Buffer::Persistent_Circular_Buffer(const std::string& Path,size_t Capacity,Sync_Policy Policy):
+m_Policy{Policy},m_File_Descriptor{-1},m_Mapping{},m_Data{},m_Capacity{}
+{
+    /* Room For At Least One Empty Record And One Wrap Marker */
+    m_Capacity=(std::max(Capacity,2*RECORD_HEADER_SIZE)+RECORD_ALIGNMENT-1)/RECORD_ALIGNMENT*RECORD_ALIGNMENT;
+    const size_t File_Size{HEADER_SIZE+m_Capacity};
+    m_File_Descriptor=open(Path.c_str(),O_RDWR|O_CREAT|O_CLOEXEC,S_IRUSR|S_IWUSR|S_IRGRP);
+    if(m_File_Descriptor<0){throw std::runtime_error("Persistent Buffer Open Failed");}
+    struct stat Status{};
+    if(fstat(m_File_Descriptor,&Status)<0)
+    {
+        close(m_File_Descriptor);
+        throw std::runtime_error("Persistent Buffer Open Failed");
+    }
+    /* New Files Are Sized Once, Existing Ones Must Already Match */
+    if(Status.st_size==0&&ftruncate(m_File_Descriptor,static_cast<off_t>(File_Size))<0)
+    {
+        close(m_File_Descriptor);
+        throw std::runtime_error("Persistent Buffer Resize Failed");
+    }
+    if(Status.st_size!=0&&static_cast<size_t>(Status.st_size)!=File_Size)
+    {
+        close(m_File_Descriptor);
+        throw std::runtime_error("Persistent Buffer Layout Mismatch");
+    }
+    void *Mapping{mmap(nullptr,File_Size,PROT_READ|PROT_WRITE,MAP_SHARED,m_File_Descriptor,0)};
+    if(Mapping==MAP_FAILED)
+    {
+        close(m_File_Descriptor);
+        throw std::runtime_error("Persistent Buffer Mapping Failed");
+    }
+    m_Mapping=static_cast<uint8_t*>(Mapping);
+    m_Data=m_Mapping+HEADER_SIZE;
+    auto *Header{reinterpret_cast<File_Header*>(m_Mapping)};
+    /* Zero Magic Is A New File Or A Crash Before Its Header Reached The Disk */
+    if(Header->m_Magic==0)
+    {
+        *Header=File_Header{FILE_MAGIC,FILE_VERSION,static_cast<uint32_t>(HEADER_SIZE),m_Capacity};
+        msync(m_Mapping,HEADER_SIZE,MS_SYNC);
+    }
+    else if(Header->m_Magic!=FILE_MAGIC||Header->m_Version!=FILE_VERSION||Header->m_Header_Size!=HEADER_SIZE||Header->m_Capacity!=m_Capacity)
+    {
+        munmap(m_Mapping,File_Size);
+        close(m_File_Descriptor);
+        throw std::runtime_error("Persistent Buffer Layout Mismatch");
+    }
+    Recover();
+    m_Last_Sync=std::chrono::steady_clock::now();
+}
+/****************************************************************************************************
+* Function Name    : ~Persistent_Circular_Buffer (Destructor)
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Destructor for the Persistent_Circular_Buffer class.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Flushes pending records then unmaps and closes the file.
+*****************************************************************************************************/
+Persistent_Circular_Buffer::~Persistent_Circular_Buffer()
+{
+    /* Nothing To Report From Here, Pages Still Reach The File Through The Page Cache */
+    try{Flush();}
+    catch(const std::runtime_error&){}
+    munmap(m_Mapping,HEADER_SIZE+m_Capacity);
+    close(m_File_Descriptor);
+}
+/****************************************************************************************************
+* Function Name    : Append
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Writes a record after the newest one, dropping the oldest ones it overlaps.
+* Parameters (in)  : Record - Payload bytes, fixed size records simply pass the same length.
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence number given to the record.
+* Notes            : Throws a runtime error if the record can never fit the storage.
+*****************************************************************************************************/
+uint64_t Persistent_Circular_Buffer::Append(std::span<const uint8_t> Record)
+{
+    return Append_N(std::span<const std::span<const uint8_t>>(&Record,1));
+}
+/****************************************************************************************************
+* Function Name    : Append_N
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Writes several records in order and syncs them once as one batch.
+* Parameters (in)  : Records - Payloads to be appended.
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence number of the first record of the batch.
+* Notes            : Throws a runtime error before writing anything if a record can never fit.
+*****************************************************************************************************/
+uint64_t Persistent_Circular_Buffer::Append_N(std::span<const std::span<const uint8_t>> Records)
+{
+    for(const auto &Record:Records)
+    {
+        if(Record.size()>=WRAP_MARKER||Record_Span(Record.size())>m_Capacity){throw std::runtime_error("Record Larger Than Buffer");}
+    }
+    const uint64_t First{m_Next_Sequence};
+    for(const auto &Record:Records){Write_Record(Record);}
+    Apply_Policy();
+    return First;
+}
+/****************************************************************************************************
+* Function Name    : Flush
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Writes every record appended since the last sync to the file.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : Throws a runtime error if msync fails.
+*****************************************************************************************************/
+void Persistent_Circular_Buffer::Flush(void)
+{
+    m_Last_Sync=std::chrono::steady_clock::now();
+    if(m_Dirty_Begin==m_Dirty_End){return;}
+    /* msync Wants A Page Aligned Start, Mapping Itself Is Page Aligned */
+    const size_t Page_Size{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+    const size_t Begin{(HEADER_SIZE+m_Dirty_Begin)/Page_Size*Page_Size};
+    const size_t End{HEADER_SIZE+m_Dirty_End};
+    m_Dirty_Begin=m_Dirty_End=0;
+    if(msync(m_Mapping+Begin,End-Begin,MS_SYNC)<0){throw std::runtime_error("Persistent Buffer Sync Failed");}
+}
+/****************************************************************************************************
+* Function Name    : Size
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the number of records held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Records between First_Sequence and Next_Sequence.
+* Notes            : None
+*****************************************************************************************************/
+size_t Persistent_Circular_Buffer::Size(void)const
+{
+    return m_Count;
+}
+/****************************************************************************************************
+* Function Name    : Is_Empty
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Checks if the log holds no record.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : bool - True if the log is empty, false otherwise.
+* Notes            : None
+*****************************************************************************************************/
+bool Persistent_Circular_Buffer::Is_Empty(void)const
+{
+    return m_Count==0;
+}
+/****************************************************************************************************
+* Function Name    : Capacity
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the bytes of record storage.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : size_t - Storage after rounding, headers included.
+* Notes            : None
+*****************************************************************************************************/
+size_t Persistent_Circular_Buffer::Capacity(void)const
+{
+    return m_Capacity;
+}
+/****************************************************************************************************
+* Function Name    : First_Sequence
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sequence number of the oldest record held.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Equal to Next_Sequence when the log is empty.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Persistent_Circular_Buffer::First_Sequence(void)const
+{
+    return m_Count?m_First_Sequence:m_Next_Sequence;
+}
+/****************************************************************************************************
+* Function Name    : Next_Sequence
+* Class            : Persistent_Circular_Buffer
+* Namespace        : Data_Structure
+* Type             : Public
+* Description      : Returns the sequence number the next appended record gets.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : uint64_t - Sequence numbers start at one and survive reopening.
+* Notes            : None
+*****************************************************************************************************/
+uint64_t Persistent_Circular_Buffer::Next_Sequence(void)const
+{
+    return m_Next_Sequence;
+}
+/****************************************************************************************************
+* Function Name    : Recover
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Finds the oldest record, the newest one and the append position in the mapping.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : - Newest records run from offset zero up to the append position.
+*                    - Older ones are the first chain after it that reaches the end of the storage
+*                      and continues with the sequence found at offset zero.
+*****************************************************************************************************/
+void Persistent_Circular_Buffer::Recover(void)
+{
+    const Walk_Result Newest{Walk(0)};
+    m_Head_Offset=0;
+    m_Tail_Offset=Newest.m_End;
+    m_Count=Newest.m_Count;
+    m_First_Sequence=Newest.m_First_Sequence;
+    m_Next_Sequence=std::max<uint64_t>(Newest.m_Next_Sequence,1);
+    /* Chain From Zero Reached The Wrap Point, Nothing Older Can Be Left */
+    if(Newest.m_Reason!=Walk_End::Invalid){return;}
+    /* Step Over What The Last Appends Partly Overwrote Until An Older Chain Links Up */
+    const uint64_t Oldest_Possible{(Newest.m_Count&&Newest.m_First_Sequence>m_Capacity/RECORD_HEADER_SIZE)?
+                                   Newest.m_First_Sequence-m_Capacity/RECORD_HEADER_SIZE:1};
+    for(size_t Offset{m_Tail_Offset};Offset+RECORD_HEADER_SIZE<=m_Capacity;Offset+=RECORD_ALIGNMENT)
+    {
+        const Record_Header *Candidate{Read_Record(Offset,0)};
+        if(!Candidate||Candidate->m_Length==WRAP_MARKER){continue;}
+        if(Newest.m_Count&&(Candidate->m_Sequence>=Newest.m_First_Sequence||Candidate->m_Sequence<Oldest_Possible)){continue;}
+        const Walk_Result Older{Walk(Offset)};
+        if(Older.m_Reason==Walk_End::Invalid){continue;}
+        if(Newest.m_Count&&Older.m_Next_Sequence!=Newest.m_First_Sequence){continue;}
+        m_Head_Offset=Offset;
+        m_Count+=Older.m_Count;
+        m_First_Sequence=Older.m_First_Sequence;
+        if(Newest.m_Count==0){m_Next_Sequence=Older.m_Next_Sequence;}
+        return;
+    }
+    /* Only Torn Bytes Behind The Newest Chain */
+    if(m_Count==0){m_Head_Offset=m_Tail_Offset;}
+}
+/****************************************************************************************************
+* Function Name    : Walk
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Follows valid records with consecutive sequence numbers from an offset.
+* Parameters (in)  : Offset - Where the first record should start.
+* Parameters (out) : None
+* Return value     : Walk_Result - End of the last valid record and why the walk stopped.
+* Notes            : None
+*****************************************************************************************************/
+Persistent_Circular_Buffer::Walk_Result Persistent_Circular_Buffer::Walk(size_t Offset)const
+{
+    Walk_Result Result{Offset,0,0,0,Walk_End::Invalid};
+    while(true)
+    {
+        /* Too Little Room Left For A Header Wraps Without A Marker */
+        if(Offset+RECORD_HEADER_SIZE>m_Capacity)
+        {
+            Result.m_Reason=Walk_End::Storage_End;
+            return Result;
+        }
+        const Record_Header *Header{Read_Record(Offset,Result.m_Next_Sequence)};
+        if(!Header){return Result;}
+        if(Header->m_Length==WRAP_MARKER)
+        {
+            /* Marker Carries The Sequence Written At Offset Zero After It */
+            Result.m_Next_Sequence=Header->m_Sequence;
+            Result.m_Reason=Walk_End::Marker;
+            return Result;
+        }
+        if(Result.m_Count++==0){Result.m_First_Sequence=Header->m_Sequence;}
+        Result.m_Next_Sequence=Header->m_Sequence+1;
+        Offset+=Record_Span(Header->m_Length);
+        Result.m_End=Offset;
+    }
+}
+/****************************************************************************************************
+* Function Name    : Read_Record
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Checks the record at an offset.
+* Parameters (in)  : Offset   - Where the record should start.
+*                    Sequence - Sequence the record must carry, zero accepts any.
+* Parameters (out) : None
+* Return value     : const Record_Header* - The record, nullptr if it is torn or does not fit.
+* Notes            : Wrap markers are returned as records too.
+*****************************************************************************************************/
+const Persistent_Circular_Buffer::Record_Header* Persistent_Circular_Buffer::Read_Record(size_t Offset,uint64_t Sequence)const
+{
+    if(Offset+RECORD_HEADER_SIZE>m_Capacity){return nullptr;}
+    const auto *Header{reinterpret_cast<const Record_Header*>(m_Data+Offset)};
+    /* Cheap Field Checks First, Checksum Only For Plausible Headers */
+    if(Header->m_Sequence==0||(Sequence&&Header->m_Sequence!=Sequence)){return nullptr;}
+    const bool Is_Marker{Header->m_Length==WRAP_MARKER};
+    if(!Is_Marker&&Offset+Record_Span(Header->m_Length)>m_Capacity){return nullptr;}
+    const std::span<const uint8_t> Payload{m_Data+Offset+RECORD_HEADER_SIZE,Is_Marker?0:Header->m_Length};
+    return (Record_Checksum(Header->m_Length,Header->m_Sequence,Payload)==Header->m_Checksum)?Header:nullptr;
+}
+/****************************************************************************************************
+* Function Name    : Write_Record
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Places one record at the append position, wrapping and dropping as needed.
+* Parameters (in)  : Record - Payload bytes "Already Checked To Fit".
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Persistent_Circular_Buffer::Write_Record(std::span<const uint8_t> Record)
+{
+    const size_t Span{Record_Span(Record.size())};
+    if(m_Tail_Offset+Span>m_Capacity)
+    {
+        /* Rest Of The Storage Is Given Up, Marker Tells Recovery Where The Chain Continues */
+        Drop_Overlapping(m_Tail_Offset,m_Capacity);
+        if(m_Tail_Offset+RECORD_HEADER_SIZE<=m_Capacity)
+        {
+            const Record_Header Marker{WRAP_MARKER,Record_Checksum(WRAP_MARKER,m_Next_Sequence,{}),m_Next_Sequence};
+            std::memcpy(m_Data+m_Tail_Offset,&Marker,RECORD_HEADER_SIZE);
+            Mark_Dirty(m_Tail_Offset,m_Tail_Offset+RECORD_HEADER_SIZE);
+        }
+        m_Tail_Offset=0;
+    }
+    Drop_Overlapping(m_Tail_Offset,m_Tail_Offset+Span);
+    const uint32_t Length{static_cast<uint32_t>(Record.size())};
+    const Record_Header Header{Length,Record_Checksum(Length,m_Next_Sequence,Record),m_Next_Sequence};
+    std::memcpy(m_Data+m_Tail_Offset+RECORD_HEADER_SIZE,Record.data(),Record.size());
+    std::memcpy(m_Data+m_Tail_Offset,&Header,RECORD_HEADER_SIZE);
+    Mark_Dirty(m_Tail_Offset,m_Tail_Offset+Span);
+    if(m_Count==0)
+    {
+        m_Head_Offset=m_Tail_Offset;
+        m_First_Sequence=m_Next_Sequence;
+    }
+    m_Tail_Offset+=Span;
+    m_Count++;
+    m_Next_Sequence++;
+}
+/****************************************************************************************************
+* Function Name    : Drop_Overlapping
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Drops the oldest records while they start inside a range about to be written.
+* Parameters (in)  : Begin - First storage offset to be written.
+*                    End   - Storage offset after the last byte to be written.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Persistent_Circular_Buffer::Drop_Overlapping(size_t Begin,size_t End)
+{
+    /* Oldest Records Only Sit Ahead Of The Append Position Once The Log Wrapped */
+    while(m_Count&&m_Head_Offset>=Begin&&m_Head_Offset<End)
+    {
+        m_Head_Offset=Next_Offset(m_Head_Offset);
+        m_First_Sequence++;
+        m_Count--;
+    }
+}
+/****************************************************************************************************
+* Function Name    : Next_Offset
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns where the record after the one at an offset starts.
+* Parameters (in)  : Offset - Start of a valid record.
+* Parameters (out) : None
+* Return value     : size_t - Start of the following record, zero after a wrap.
+* Notes            : None
+*****************************************************************************************************/
+size_t Persistent_Circular_Buffer::Next_Offset(size_t Offset)const
+{
+    const auto *Header{reinterpret_cast<const Record_Header*>(m_Data+Offset)};
+    const size_t Next{Offset+Record_Span(Header->m_Length)};
+    if(Next+RECORD_HEADER_SIZE>m_Capacity){return 0;}
+    return (reinterpret_cast<const Record_Header*>(m_Data+Next)->m_Length==WRAP_MARKER)?0:Next;
+}
+/****************************************************************************************************
+* Function Name    : Mark_Dirty
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Extends the range the next sync has to write.
+* Parameters (in)  : Begin - First storage offset written.
+*                    End   - Storage offset after the last byte written.
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Persistent_Circular_Buffer::Mark_Dirty(size_t Begin,size_t End)
+{
+    if(m_Dirty_Begin==m_Dirty_End)
+    {
+        m_Dirty_Begin=Begin;
+        m_Dirty_End=End;
+        return;
+    }
+    m_Dirty_Begin=std::min(m_Dirty_Begin,Begin);
+    m_Dirty_End=std::max(m_Dirty_End,End);
+}
+/****************************************************************************************************
+* Function Name    : Apply_Policy
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Syncs after a batch when the policy asks for it.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+void Persistent_Circular_Buffer::Apply_Policy(void)
+{
+    switch(m_Policy.m_Mode)
+    {
+        case Sync_Mode::Per_Batch:Flush();break;
+        case Sync_Mode::Periodic:
+            if(std::chrono::steady_clock::now()-m_Last_Sync>=m_Policy.m_Interval){Flush();}
+            break;
+        case Sync_Mode::Manual:break;
+    }
+}
+/****************************************************************************************************
+* Function Name    : Record_Span
+* Class            : Persistent_Circular_Buffer
+* Type             : Private
+* Namespace        : Data_Structure
+* Description      : Returns the bytes a record of a given payload length takes in the storage.
+* Parameters (in)  : Length - Payload bytes.
+* Parameters (out) : None
+* Return value     : size_t - Header and payload rounded up to RECORD_ALIGNMENT.
+* Notes            : None
+*****************************************************************************************************/
+size_t Persistent_Circular_Buffer::Record_Span(size_t Length)
+{
+    return (RECORD_HEADER_SIZE+Length+RECORD_ALIGNMENT-1)/RECORD_ALIGNMENT*RECORD_ALIGNMENT;
+}
+}
+/********************************************************************
+ *  END OF FILE:  Persistent_Circular_Buffer.cpp
+********************************************************************/
@@ -0,0 +1,480 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Window_Statistics.cpp
+ *  Date: November 30, 2024
+ *  Description: Vectorized and incremental sum, min, max, mean and variance over a window of samples
+ *  Class Name:  None
+ *  Namespace:  Data_Structure
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Window_Statistics.hpp"
+#include <algorithm>
+#include <limits>
+#if defined(__x86_64__)||defined(__i386__)
+#include <immintrin.h>
+#define WINDOW_STATISTICS_HAS_X86
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+namespace Data_Structure
+{
+/* Totals Of The First Pass, Carried From One Segment To The Next */
+template <typename Type>
+struct First_Pass
+{
+    double m_Sum{};
+    Type m_Min{std::numeric_limits<Type>::infinity()};
+    Type m_Max{-std::numeric_limits<Type>::infinity()};
+};
+/* One Pair Of Reductions Per Instruction Set */
+template <typename Type>
+struct Reduction_Kernels
+{
+    void (*m_Sum_Min_Max)(std::span<const Type>,First_Pass<Type>&);
+    double (*m_Squared_Deviation)(std::span<const Type>,double);
+};
+/*****************************************
+------------    Scalar     ---------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : Scalar_Sum_Min_Max
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Adds a segment to the sum, min and max of the first pass one sample at a time.
+* Parameters (in)  : Values - Samples of the segment.
+* Parameters (out) : Pass   - Totals updated with the segment.
+* Return value     : None
+* Notes            : Also finishes the tail the vector kernels leave behind.
+*****************************************************************************************************/
+template <typename Type>
+static void Scalar_Sum_Min_Max(std::span<const Type> Values,First_Pass<Type>& Pass)
+{
+    for(const Type Value:Values)
+    {
+        Pass.m_Sum+=static_cast<double>(Value);
+        Pass.m_Min=std::min(Pass.m_Min,Value);
+        Pass.m_Max=std::max(Pass.m_Max,Value);
+    }
+}
+/****************************************************************************************************
+* Function Name    : Scalar_Squared_Deviation
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Sums the squared distance of every sample of a segment from the mean.
+* Parameters (in)  : Values - Samples of the segment.
+*                    Mean   - Mean of the whole window.
+* Parameters (out) : None
+* Return value     : double - Sum of squared deviations of the segment.
+* Notes            : Also finishes the tail the vector kernels leave behind.
+*****************************************************************************************************/
+template <typename Type>
+static double Scalar_Squared_Deviation(std::span<const Type> Values,double Mean)
+{
+    double Total{};
+    for(const Type Value:Values)
+    {
+        const double Deviation{static_cast<double>(Value)-Mean};
+        Total+=Deviation*Deviation;
+    }
+    return Total;
+}
+#ifdef WINDOW_STATISTICS_HAS_X86
+/*****************************************
+--------------    SSE     ----------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : SSE_Sum_Min_Max
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : First pass over a float segment four samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+* Parameters (out) : Pass   - Totals updated with the segment.
+* Return value     : None
+* Notes            : Samples are widened to double before summing so long windows keep precision.
+*****************************************************************************************************/
+__attribute__((target("sse2")))
+static void SSE_Sum_Min_Max(std::span<const float> Values,First_Pass<float>& Pass)
+{
+    __m128 Minimum{_mm_set1_ps(Pass.m_Min)};
+    __m128 Maximum{_mm_set1_ps(Pass.m_Max)};
+    __m128d Sum_Low{_mm_setzero_pd()};
+    __m128d Sum_High{_mm_setzero_pd()};
+    size_t Index{};
+    for(;Index+4<=Values.size();Index+=4)
+    {
+        const __m128 Lane{_mm_loadu_ps(Values.data()+Index)};
+        Minimum=_mm_min_ps(Minimum,Lane);
+        Maximum=_mm_max_ps(Maximum,Lane);
+        Sum_Low=_mm_add_pd(Sum_Low,_mm_cvtps_pd(Lane));
+        Sum_High=_mm_add_pd(Sum_High,_mm_cvtps_pd(_mm_movehl_ps(Lane,Lane)));
+    }
+    /* Fold Lanes Back Into Scalars */
+    alignas(16) float Minimum_Lanes[4];
+    alignas(16) float Maximum_Lanes[4];
+    alignas(16) double Sum_Lanes[2];
+    _mm_store_ps(Minimum_Lanes,Minimum);
+    _mm_store_ps(Maximum_Lanes,Maximum);
+    _mm_store_pd(Sum_Lanes,_mm_add_pd(Sum_Low,Sum_High));
+    Pass.m_Min=*std::min_element(Minimum_Lanes,Minimum_Lanes+4);
+    Pass.m_Max=*std::max_element(Maximum_Lanes,Maximum_Lanes+4);
+    Pass.m_Sum+=Sum_Lanes[0]+Sum_Lanes[1];
+    Scalar_Sum_Min_Max(Values.subspan(Index),Pass);
+}
+/****************************************************************************************************
+* Function Name    : SSE_Squared_Deviation
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Second pass over a float segment four samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+*                    Mean   - Mean of the whole window.
+* Parameters (out) : None
+* Return value     : double - Sum of squared deviations of the segment.
+* Notes            : None
+*****************************************************************************************************/
+__attribute__((target("sse2")))
+static double SSE_Squared_Deviation(std::span<const float> Values,double Mean)
+{
+    const __m128d Mean_Lanes{_mm_set1_pd(Mean)};
+    __m128d Total{_mm_setzero_pd()};
+    size_t Index{};
+    for(;Index+4<=Values.size();Index+=4)
+    {
+        const __m128 Lane{_mm_loadu_ps(Values.data()+Index)};
+        const __m128d Low{_mm_sub_pd(_mm_cvtps_pd(Lane),Mean_Lanes)};
+        const __m128d High{_mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(Lane,Lane)),Mean_Lanes)};
+        Total=_mm_add_pd(Total,_mm_add_pd(_mm_mul_pd(Low,Low),_mm_mul_pd(High,High)));
+    }
+    alignas(16) double Total_Lanes[2];
+    _mm_store_pd(Total_Lanes,Total);
+    return Total_Lanes[0]+Total_Lanes[1]+Scalar_Squared_Deviation(Values.subspan(Index),Mean);
+}
+/****************************************************************************************************
+* Function Name    : SSE_Sum_Min_Max
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : First pass over a double segment two samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+* Parameters (out) : Pass   - Totals updated with the segment.
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+__attribute__((target("sse2")))
+static void SSE_Sum_Min_Max(std::span<const double> Values,First_Pass<double>& Pass)
+{
+    __m128d Minimum{_mm_set1_pd(Pass.m_Min)};
+    __m128d Maximum{_mm_set1_pd(Pass.m_Max)};
+    __m128d Sum{_mm_setzero_pd()};
+    size_t Index{};
+    for(;Index+2<=Values.size();Index+=2)
+    {
+        const __m128d Lane{_mm_loadu_pd(Values.data()+Index)};
+        Minimum=_mm_min_pd(Minimum,Lane);
+        Maximum=_mm_max_pd(Maximum,Lane);
+        Sum=_mm_add_pd(Sum,Lane);
+    }
+    alignas(16) double Minimum_Lanes[2];
+    alignas(16) double Maximum_Lanes[2];
+    alignas(16) double Sum_Lanes[2];
+    _mm_store_pd(Minimum_Lanes,Minimum);
+    _mm_store_pd(Maximum_Lanes,Maximum);
+    _mm_store_pd(Sum_Lanes,Sum);
+    Pass.m_Min=std::min(Minimum_Lanes[0],Minimum_Lanes[1]);
+    Pass.m_Max=std::max(Maximum_Lanes[0],Maximum_Lanes[1]);
+    Pass.m_Sum+=Sum_Lanes[0]+Sum_Lanes[1];
+    Scalar_Sum_Min_Max(Values.subspan(Index),Pass);
+}
+/****************************************************************************************************
+* Function Name    : SSE_Squared_Deviation
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Second pass over a double segment two samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+*                    Mean   - Mean of the whole window.
+* Parameters (out) : None
+* Return value     : double - Sum of squared deviations of the segment.
+* Notes            : None
+*****************************************************************************************************/
+__attribute__((target("sse2")))
+static double SSE_Squared_Deviation(std::span<const double> Values,double Mean)
+{
+    const __m128d Mean_Lanes{_mm_set1_pd(Mean)};
+    __m128d Total{_mm_setzero_pd()};
+    size_t Index{};
+    for(;Index+2<=Values.size();Index+=2)
+    {
+        const __m128d Deviation{_mm_sub_pd(_mm_loadu_pd(Values.data()+Index),Mean_Lanes)};
+        Total=_mm_add_pd(Total,_mm_mul_pd(Deviation,Deviation));
+    }
+    alignas(16) double Total_Lanes[2];
+    _mm_store_pd(Total_Lanes,Total);
+    return Total_Lanes[0]+Total_Lanes[1]+Scalar_Squared_Deviation(Values.subspan(Index),Mean);
+}
+/*****************************************
+-------------    AVX2     ----------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : AVX2_Sum_Min_Max
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : First pass over a float segment eight samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+* Parameters (out) : Pass   - Totals updated with the segment.
+* Return value     : None
+* Notes            : Samples are widened to double before summing so long windows keep precision.
+*****************************************************************************************************/
+__attribute__((target("avx2")))
+static void AVX2_Sum_Min_Max(std::span<const float> Values,First_Pass<float>& Pass)
+{
+    __m256 Minimum{_mm256_set1_ps(Pass.m_Min)};
+    __m256 Maximum{_mm256_set1_ps(Pass.m_Max)};
+    __m256d Sum_Low{_mm256_setzero_pd()};
+    __m256d Sum_High{_mm256_setzero_pd()};
+    size_t Index{};
+    for(;Index+8<=Values.size();Index+=8)
+    {
+        const __m256 Lane{_mm256_loadu_ps(Values.data()+Index)};
+        Minimum=_mm256_min_ps(Minimum,Lane);
+        Maximum=_mm256_max_ps(Maximum,Lane);
+        Sum_Low=_mm256_add_pd(Sum_Low,_mm256_cvtps_pd(_mm256_castps256_ps128(Lane)));
+        Sum_High=_mm256_add_pd(Sum_High,_mm256_cvtps_pd(_mm256_extractf128_ps(Lane,1)));
+    }
+    alignas(32) float Minimum_Lanes[8];
+    alignas(32) float Maximum_Lanes[8];
+    alignas(32) double Sum_Lanes[4];
+    _mm256_store_ps(Minimum_Lanes,Minimum);
+    _mm256_store_ps(Maximum_Lanes,Maximum);
+    _mm256_store_pd(Sum_Lanes,_mm256_add_pd(Sum_Low,Sum_High));
+    Pass.m_Min=*std::min_element(Minimum_Lanes,Minimum_Lanes+8);
+    Pass.m_Max=*std::max_element(Maximum_Lanes,Maximum_Lanes+8);
+    Pass.m_Sum+=(Sum_Lanes[0]+Sum_Lanes[1])+(Sum_Lanes[2]+Sum_Lanes[3]);
+    Scalar_Sum_Min_Max(Values.subspan(Index),Pass);
+}
+/****************************************************************************************************
+* Function Name    : AVX2_Squared_Deviation
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Second pass over a float segment eight samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+*                    Mean   - Mean of the whole window.
+* Parameters (out) : None
+* Return value     : double - Sum of squared deviations of the segment.
+* Notes            : None
+*****************************************************************************************************/
+__attribute__((target("avx2")))
+static double AVX2_Squared_Deviation(std::span<const float> Values,double Mean)
+{
+    const __m256d Mean_Lanes{_mm256_set1_pd(Mean)};
+    __m256d Total_Low{_mm256_setzero_pd()};
+    __m256d Total_High{_mm256_setzero_pd()};
+    size_t Index{};
+    for(;Index+8<=Values.size();Index+=8)
+    {
+        const __m256 Lane{_mm256_loadu_ps(Values.data()+Index)};
+        const __m256d Low{_mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(Lane)),Mean_Lanes)};
+        const __m256d High{_mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(Lane,1)),Mean_Lanes)};
+        Total_Low=_mm256_add_pd(Total_Low,_mm256_mul_pd(Low,Low));
+        Total_High=_mm256_add_pd(Total_High,_mm256_mul_pd(High,High));
+    }
+    alignas(32) double Total_Lanes[4];
+    _mm256_store_pd(Total_Lanes,_mm256_add_pd(Total_Low,Total_High));
+    return (Total_Lanes[0]+Total_Lanes[1])+(Total_Lanes[2]+Total_Lanes[3])+Scalar_Squared_Deviation(Values.subspan(Index),Mean);
+}
+/****************************************************************************************************
+* Function Name    : AVX2_Sum_Min_Max
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : First pass over a double segment four samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+* Parameters (out) : Pass   - Totals updated with the segment.
+* Return value     : None
+* Notes            : None
+*****************************************************************************************************/
+__attribute__((target("avx2")))
+static void AVX2_Sum_Min_Max(std::span<const double> Values,First_Pass<double>& Pass)
+{
+    __m256d Minimum{_mm256_set1_pd(Pass.m_Min)};
+    __m256d Maximum{_mm256_set1_pd(Pass.m_Max)};
+    __m256d Sum{_mm256_setzero_pd()};
+    size_t Index{};
+    for(;Index+4<=Values.size();Index+=4)
+    {
+        const __m256d Lane{_mm256_loadu_pd(Values.data()+Index)};
+        Minimum=_mm256_min_pd(Minimum,Lane);
+        Maximum=_mm256_max_pd(Maximum,Lane);
+        Sum=_mm256_add_pd(Sum,Lane);
+    }
+    alignas(32) double Minimum_Lanes[4];
+    alignas(32) double Maximum_Lanes[4];
+    alignas(32) double Sum_Lanes[4];
+    _mm256_store_pd(Minimum_Lanes,Minimum);
+    _mm256_store_pd(Maximum_Lanes,Maximum);
+    _mm256_store_pd(Sum_Lanes,Sum);
+    Pass.m_Min=*std::min_element(Minimum_Lanes,Minimum_Lanes+4);
+    Pass.m_Max=*std::max_element(Maximum_Lanes,Maximum_Lanes+4);
+    Pass.m_Sum+=(Sum_Lanes[0]+Sum_Lanes[1])+(Sum_Lanes[2]+Sum_Lanes[3]);
+    Scalar_Sum_Min_Max(Values.subspan(Index),Pass);
+}
+/****************************************************************************************************
+* Function Name    : AVX2_Squared_Deviation
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Second pass over a double segment four samples at a time.
+* Parameters (in)  : Values - Samples of the segment.
+*                    Mean   - Mean of the whole window.
+* Parameters (out) : None
+* Return value     : double - Sum of squared deviations of the segment.
+* Notes            : None
+*****************************************************************************************************/
+__attribute__((target("avx2")))
+static double AVX2_Squared_Deviation(std::span<const double> Values,double Mean)
+{
+    const __m256d Mean_Lanes{_mm256_set1_pd(Mean)};
+    __m256d Total{_mm256_setzero_pd()};
+    size_t Index{};
+    for(;Index+4<=Values.size();Index+=4)
+    {
+        const __m256d Deviation{_mm256_sub_pd(_mm256_loadu_pd(Values.data()+Index),Mean_Lanes)};
+        Total=_mm256_add_pd(Total,_mm256_mul_pd(Deviation,Deviation));
+    }
+    alignas(32) double Total_Lanes[4];
+    _mm256_store_pd(Total_Lanes,Total);
+    return (Total_Lanes[0]+Total_Lanes[1])+(Total_Lanes[2]+Total_Lanes[3])+Scalar_Squared_Deviation(Values.subspan(Index),Mean);
+}
+#endif
+/*****************************************
+-----------    Dispatch     --------------
+*****************************************/
+/****************************************************************************************************
+* Function Name    : Select_Kernels
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Returns the reductions built for an instruction set.
+* Parameters (in)  : Level - Instruction set asked for.
+* Parameters (out) : None
+* Return value     : Reduction_Kernels<Type> - Pair of reductions to run.
+* Notes            : Throws std::runtime_error if Level is wider than Best_Simd_Level.
+*****************************************************************************************************/
+template <typename Type>
+static Reduction_Kernels<Type> Select_Kernels(Simd_Level Level)
+{
+    if(Level>Best_Simd_Level()){throw std::runtime_error("Simd Level Not Supported By This Cpu");}
+#ifdef WINDOW_STATISTICS_HAS_X86
+    /* Overloads Are Picked By Sample Type */
+    if(Level==Simd_Level::AVX2)
+    {
+        return Reduction_Kernels<Type>{static_cast<void(*)(std::span<const Type>,First_Pass<Type>&)>(AVX2_Sum_Min_Max),
+                                       static_cast<double(*)(std::span<const Type>,double)>(AVX2_Squared_Deviation)};
+    }
+    if(Level==Simd_Level::SSE)
+    {
+        return Reduction_Kernels<Type>{static_cast<void(*)(std::span<const Type>,First_Pass<Type>&)>(SSE_Sum_Min_Max),
+                                       static_cast<double(*)(std::span<const Type>,double)>(SSE_Squared_Deviation)};
+    }
+#endif
+    return Reduction_Kernels<Type>{Scalar_Sum_Min_Max<Type>,Scalar_Squared_Deviation<Type>};
+}
+/****************************************************************************************************
+* Function Name    : Reduce_Window
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Static
+* Description      : Runs both passes over the two segments of a window.
+* Parameters (in)  : First  - Oldest samples.
+*                    Second - Remaining samples.
+*                    Level  - Instruction set to run the reductions on.
+* Parameters (out) : None
+* Return value     : Window_Summary<Type> - Statistics of both segments, all zero when empty.
+* Notes            : None
+*****************************************************************************************************/
+template <typename Type>
+static Window_Summary<Type> Reduce_Window(std::span<const Type> First,std::span<const Type> Second,Simd_Level Level)
+{
+    const Reduction_Kernels<Type> Kernels{Select_Kernels<Type>(Level)};
+    const size_t Count{First.size()+Second.size()};
+    if(Count==0){return Window_Summary<Type>{};}
+    First_Pass<Type> Pass{};
+    Kernels.m_Sum_Min_Max(First,Pass);
+    Kernels.m_Sum_Min_Max(Second,Pass);
+    const double Mean{Pass.m_Sum/static_cast<double>(Count)};
+    /* Second Pass Around The Mean "Stable Even When Mean Is Far From Zero" */
+    const double Squared_Deviation{Kernels.m_Squared_Deviation(First,Mean)+Kernels.m_Squared_Deviation(Second,Mean)};
+    return Window_Summary<Type>{Count,Pass.m_Sum,Pass.m_Min,Pass.m_Max,Mean,Squared_Deviation/static_cast<double>(Count)};
+}
+/****************************************************************************************************
+* Function Name    : Best_Simd_Level
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Returns the widest instruction set the running CPU supports.
+* Parameters (in)  : None
+* Parameters (out) : None
+* Return value     : Simd_Level - Level used when callers do not ask for one.
+* Notes            : Checked once, Scalar on targets other than x86.
+*****************************************************************************************************/
+Simd_Level Best_Simd_Level(void)
+{
+#ifdef WINDOW_STATISTICS_HAS_X86
+    static const Simd_Level Level{__builtin_cpu_supports("avx2")?Simd_Level::AVX2:
+                                  (__builtin_cpu_supports("sse2")?Simd_Level::SSE:Simd_Level::Scalar)};
+    return Level;
+#else
+    return Simd_Level::Scalar;
+#endif
+}
+/****************************************************************************************************
+* Function Name    : Window_Statistics
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Reduces two contiguous segments of samples as one window.
+* Parameters (in)  : First  - Oldest samples, usually the first region of a ring.
+*                    Second - Remaining samples, usually the wrapped region of a ring.
+*                    Level  - Instruction set to run the reductions on.
+* Parameters (out) : None
+* Return value     : Window_Summary<float> - Statistics of both segments, all zero when empty.
+* Notes            : - Sums are accumulated in double lanes, variance is computed in a second pass.
+*                    - Throws std::runtime_error if Level is not supported by the CPU.
+*****************************************************************************************************/
+Window_Summary<float> Window_Statistics(std::span<const float> First,std::span<const float> Second,Simd_Level Level)
+{
+    return Reduce_Window<float>(First,Second,Level);
+}
+/****************************************************************************************************
+* Function Name    : Window_Statistics
+* Class            : None
+* Namespace        : Data_Structure
+* Type             : Global
+* Description      : Reduces two contiguous segments of samples as one window.
+* Parameters (in)  : First  - Oldest samples, usually the first region of a ring.
+*                    Second - Remaining samples, usually the wrapped region of a ring.
+*                    Level  - Instruction set to run the reductions on.
+* Parameters (out) : None
+* Return value     : Window_Summary<double> - Statistics of both segments, all zero when empty.
+* Notes            : - Variance is computed in a second pass around the mean.
+*                    - Throws std::runtime_error if Level is not supported by the CPU.
+*****************************************************************************************************/
+Window_Summary<double> Window_Statistics(std::span<const double> First,std::span<const double> Second,Simd_Level Level)
+{
+    return Reduce_Window<double>(First,Second,Level);
+}
+}
+/********************************************************************
+ *  END OF FILE:  Window_Statistics.cpp
+********************************************************************/
@@ -0,0 +1,136 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Asio_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Asio_Circular_Buffer Implementation
+ *  Class Name:  Asio_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#if __has_include(<boost/asio.hpp>)
+#include "Asio_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/use_future.hpp>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Asio_Circular_Buffer;
+using boost::system::error_code;
+/*****************************************
+----    Asio_Circular_Buffer_Test     ----
+*****************************************/
+class Asio_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Asio_Circular_Buffer_Test,CALLBACK_HANDLERS)
+{
+    boost::asio::io_context Context{};
+    Asio_Circular_Buffer<std::string,2> Buffer{Context.get_executor()};
+    std::vector<std::string> Received{};
+    std::vector<error_code> Push_Results{};
+    std::function<void(error_code,std::string)> Next_Pop{};
+    Next_Pop=[&](error_code Error,std::string Element)
+    {
+        if(Error){Received.push_back(Error==boost::asio::error::eof?"eof":"error");return;}
+        Received.push_back(std::move(Element));
+        Buffer.async_pop(Next_Pop);
+    };
+    for(const char* Element:{"a","b","c","d","e"}){Buffer.async_push(Element,[&](error_code Error){Push_Results.push_back(Error);});}
+    Buffer.Close();
+    /* Nothing Runs Before The io_context Does */
+    EXPECT_TRUE(Push_Results.empty());
+    Buffer.async_pop(Next_Pop);
+    Context.run();
+    /* Two Buffered, Three Refused By Close */
+    EXPECT_EQ(Received,(std::vector<std::string>{"a","b","eof"}));
+    ASSERT_EQ(Push_Results.size(),5);
+    EXPECT_FALSE(Push_Results[0]);
+    EXPECT_FALSE(Push_Results[1]);
+    EXPECT_EQ(Push_Results[4],boost::asio::error::broken_pipe);
+}
+
+TEST_F(Asio_Circular_Buffer_Test,USE_AWAITABLE_COROUTINES)
+{
+    boost::asio::io_context Context{};
+    Asio_Circular_Buffer<int,4> Buffer{Context.get_executor()};
+    std::vector<int> Received{};
+    error_code Final_Error{};
+    boost::asio::co_spawn(Context,[&]()->boost::asio::awaitable<void>
+    {
+        while(true)
+        {
+            error_code Error{};
+            const int Element{co_await Buffer.async_pop(boost::asio::redirect_error(boost::asio::use_awaitable,Error))};
+            if(Error){Final_Error=Error;co_return;}
+            Received.push_back(Element);
+        }
+    },boost::asio::detached);
+    boost::asio::co_spawn(Context,[&]()->boost::asio::awaitable<void>
+    {
+        for(int Counter{};Counter<1000;Counter++){co_await Buffer.async_push(Counter,boost::asio::use_awaitable);}
+        Buffer.Close();
+    },boost::asio::detached);
+    Context.run();
+    EXPECT_EQ(Final_Error,boost::asio::error::eof);
+    ASSERT_EQ(Received.size(),1000);
+    for(int Counter{};Counter<1000;Counter++){EXPECT_EQ(Received[Counter],Counter);}
+}
+
+TEST_F(Asio_Circular_Buffer_Test,FUTURES_ON_STRAND_ACROSS_THREADS)
+{
+    constexpr int ELEMENTS{2000};
+    boost::asio::io_context Context{};
+    auto Guard{boost::asio::make_work_guard(Context)};
+    std::vector<std::thread> Runners{};
+    for(int Counter{};Counter<2;Counter++){Runners.emplace_back([&Context]{Context.run();});}
+    {
+        /* Context Runs On Two Threads, The Strand Keeps Buffer State Serialized */
+        Asio_Circular_Buffer<int,8,boost::asio::strand<boost::asio::io_context::executor_type>> Buffer{boost::asio::make_strand(Context)};
+        std::thread Producer{[&Buffer]
+        {
+            for(int Counter{};Counter<ELEMENTS;Counter++){Buffer.async_push(Counter,boost::asio::use_future).get();}
+        }};
+        long long Sum{};
+        bool Ordered{true};
+        for(int Counter{};Counter<ELEMENTS;Counter++)
+        {
+            const int Element{Buffer.async_pop(boost::asio::use_future).get()};
+            Ordered&=(Element==Counter);
+            Sum+=Element;
+        }
+        Producer.join();
+        EXPECT_TRUE(Ordered);
+        EXPECT_EQ(Sum,static_cast<long long>(ELEMENTS)*(ELEMENTS-1)/2);
+        /* Future Carries The Error As A system_error */
+        std::future<int> Pending{Buffer.async_pop(boost::asio::use_future)};
+        Buffer.Close();
+        EXPECT_THROW(Pending.get(),boost::system::system_error);
+        EXPECT_THROW(Buffer.async_push(1,boost::asio::use_future).get(),boost::system::system_error);
+    }
+    Guard.reset();
+    for(auto& Runner:Runners){Runner.join();}
+}
+#endif
+/********************************************************************
+ *  END OF FILE:  Asio_Circular_Buffer_Test.cpp
+********************************************************************/
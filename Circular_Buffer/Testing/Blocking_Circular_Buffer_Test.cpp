@@ -0,0 +1,170 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Blocking_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Blocking_Circular_Buffer Implementation
+ *  Class Name:  Blocking_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Blocking_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <thread>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Element Without Default Constructor */
+struct Blocking_Ticket
+{
+    explicit Blocking_Ticket(int Value):m_Value{Value}{}
+    int m_Value;
+};
+/*****************************************
+---    Blocking_Circular_Buffer_Test     --
+*****************************************/
+class Blocking_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Blocking_Circular_Buffer_Test,TRY_PUSH_TRY_POP)
+{
+    Data_Structure::Blocking_Circular_Buffer<int,3> Buffer{};
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+    EXPECT_FALSE(Buffer.Try_Pop().has_value());
+    for(int Counter{};Counter<3;Counter++){EXPECT_TRUE(Buffer.Try_Push(Counter));}
+    EXPECT_FALSE(Buffer.Try_Push(3));
+    EXPECT_EQ(Buffer.Size(),3);
+    for(int Counter{};Counter<3;Counter++){EXPECT_EQ(Buffer.Try_Pop(),Counter);}
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(Blocking_Circular_Buffer_Test,POP_FOR_TIMEOUT)
+{
+    using namespace std::chrono_literals;
+    Data_Structure::Blocking_Circular_Buffer<int,3> Buffer{};
+    const auto Start{std::chrono::steady_clock::now()};
+    EXPECT_FALSE(Buffer.Pop_For(20ms).has_value());
+    EXPECT_GE(std::chrono::steady_clock::now()-Start,20ms);
+    /* Element Already There Is Returned Without Sleeping */
+    Buffer.Try_Push(7);
+    EXPECT_EQ(Buffer.Pop_For(0ms),7);
+    /* Element Arriving While Sleeping Wakes The Consumer */
+    std::thread Producer{[&Buffer]()
+    {
+        std::this_thread::sleep_for(10ms);
+        Buffer.Push_Wait(8);
+    }};
+    EXPECT_EQ(Buffer.Pop_For(10s),8);
+    Producer.join();
+}
+
+TEST_F(Blocking_Circular_Buffer_Test,PRODUCER_CONSUMER_WAIT)
+{
+    constexpr uint64_t ELEMENTS{100000};
+    Data_Structure::Blocking_Circular_Buffer<uint64_t,8> Buffer{};
+    uint64_t Received{};
+    uint64_t Sum{};
+    std::thread Consumer{[&Buffer,&Received,&Sum]()
+    {
+        while(auto Element{Buffer.Pop_Wait()})
+        {
+            /* Elements Of A Single Producer Arrive In Order */
+            EXPECT_EQ(*Element,Received);
+            Sum+=*Element;
+            Received++;
+        }
+    }};
+    for(uint64_t Counter{};Counter<ELEMENTS;Counter++){EXPECT_TRUE(Buffer.Push_Wait(Counter));}
+    /* Consumer Drains What Is Left Then Stops */
+    Buffer.Close();
+    Consumer.join();
+    EXPECT_EQ(Received,ELEMENTS);
+    EXPECT_EQ(Sum,ELEMENTS*(ELEMENTS-1)/2);
+}
+
+TEST_F(Blocking_Circular_Buffer_Test,CLOSE_WAKES_WAITERS)
+{
+    using namespace std::chrono_literals;
+    Data_Structure::Blocking_Circular_Buffer<int,2> Empty{};
+    Data_Structure::Blocking_Circular_Buffer<int,2> Full{};
+    Full.Try_Push(1);
+    Full.Try_Push(2);
+    std::vector<std::thread> Threads{};
+    for(int Counter{};Counter<2;Counter++)
+    {
+        Threads.emplace_back([&Empty](){EXPECT_FALSE(Empty.Pop_Wait().has_value());});
+        Threads.emplace_back([&Full](){EXPECT_FALSE(Full.Push_Wait(3));});
+    }
+    /* Let Every Thread Go To Sleep First */
+    std::this_thread::sleep_for(20ms);
+    Empty.Close();
+    Full.Close();
+    for(auto &Thread:Threads){Thread.join();}
+    EXPECT_TRUE(Full.Is_Closed());
+    EXPECT_FALSE(Full.Try_Push(3));
+    /* Elements Pushed Before Close Are Still Delivered */
+    EXPECT_EQ(Full.Pop_Wait(),1);
+    EXPECT_EQ(Full.Pop_Wait(),2);
+    EXPECT_FALSE(Full.Pop_Wait().has_value());
+}
+
+TEST_F(Blocking_Circular_Buffer_Test,NO_DEFAULT_CONSTRUCTOR)
+{
+    Data_Structure::Blocking_Circular_Buffer<Blocking_Ticket,2> Buffer{};
+    EXPECT_TRUE(Buffer.Try_Push(Blocking_Ticket{5}));
+    const auto Ticket{Buffer.Try_Pop()};
+    ASSERT_TRUE(Ticket.has_value());
+    EXPECT_EQ(Ticket->m_Value,5);
+    EXPECT_FALSE(Buffer.Try_Pop().has_value());
+}
+
+TEST_F(Blocking_Circular_Buffer_Test,ACCEPTED_PUSHES_SURVIVE_CLOSE)
+{
+    using namespace std::chrono_literals;
+    constexpr int ROUNDS{30};
+    constexpr int PRODUCERS{3};
+    for(int Round{};Round<ROUNDS;Round++)
+    {
+        Data_Structure::Blocking_Circular_Buffer<uint64_t,4> Buffer{};
+        std::atomic<uint64_t> Accepted{};
+        uint64_t Received{};
+        std::thread Consumer{[&Buffer,&Received]()
+        {
+            while(Buffer.Pop_Wait()){Received++;}
+        }};
+        std::vector<std::thread> Producers{};
+        for(int Producer{};Producer<PRODUCERS;Producer++)
+        {
+            Producers.emplace_back([&Buffer,&Accepted]()
+            {
+                /* Keep Pushing Right Through Close */
+                while(!Buffer.Is_Closed())
+                {
+                    if(Buffer.Try_Push(1)){Accepted.fetch_add(1,std::memory_order_relaxed);}
+                    else{std::this_thread::yield();}
+                }
+            });
+        }
+        std::this_thread::sleep_for(1ms);
+        Buffer.Close();
+        for(auto &Producer:Producers){Producer.join();}
+        Consumer.join();
+        /* Every Push Reported As Stored Reached The Consumer */
+        EXPECT_EQ(Received,Accepted.load());
+    }
+}
+/********************************************************************
+ *  END OF FILE:  Blocking_Circular_Buffer_Test.cpp
+********************************************************************/
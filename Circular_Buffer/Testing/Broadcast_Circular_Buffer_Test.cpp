@@ -0,0 +1,171 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Broadcast_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Broadcast_Circular_Buffer Implementation
+ *  Class Name:  Broadcast_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Broadcast_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Broadcast_Circular_Buffer;
+using Data_Structure::Broadcast_Policy;
+using Data_Structure::Read_Status;
+/* Every Field Derived From The Sequence So A Torn Copy Is Detectable */
+struct Sample
+{
+    uint64_t m_Sequence;
+    uint64_t m_Square;
+    uint64_t m_Check;
+};
+/*****************************************
+---    Broadcast_Circular_Buffer_Test   ---
+*****************************************/
+class Broadcast_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Broadcast_Circular_Buffer_Test,LAPPED_READER_REPORTS_GAP)
+{
+    Broadcast_Circular_Buffer<int,8> Buffer{};
+    auto Early{Buffer.Subscribe()};
+    for(int Counter{};Counter<20;Counter++){Buffer.Write(Counter);}
+    EXPECT_EQ(Early.Lag(),20);
+    int Element{};
+    /* Twelve Overwritten, Oldest Surviving Element Comes With The Gap */
+    auto Result{Early.Try_Read(Element)};
+    EXPECT_EQ(Result.m_Status,Read_Status::Element);
+    EXPECT_EQ(Result.m_Sequence,12);
+    EXPECT_EQ(Result.m_Missed,12);
+    EXPECT_EQ(Element,12);
+    for(int Counter{13};Counter<20;Counter++)
+    {
+        Result=Early.Try_Read(Element);
+        EXPECT_EQ(Element,Counter);
+        EXPECT_EQ(Result.m_Missed,0);
+    }
+    EXPECT_EQ(Early.Try_Read(Element).m_Status,Read_Status::Empty);
+    /* Late Subscriber Only Sees What Comes After It */
+    auto Late{Buffer.Subscribe()};
+    EXPECT_EQ(Late.Try_Read(Element).m_Status,Read_Status::Empty);
+    Buffer.Write(20);
+    EXPECT_EQ(Late.Try_Read(Element).m_Sequence,20);
+    EXPECT_EQ(Early.Try_Read(Element).m_Sequence,20);
+    Buffer.Close();
+    EXPECT_EQ(Early.Read(Element).m_Status,Read_Status::Closed);
+    EXPECT_EQ(Late.Try_Read(Element).m_Status,Read_Status::Closed);
+}
+
+TEST_F(Broadcast_Circular_Buffer_Test,BACKPRESSURE_WAITS_FOR_SLOWEST_READER)
+{
+    Broadcast_Circular_Buffer<int,4,Broadcast_Policy::Backpressure,2> Buffer{};
+    /* Nobody Subscribed, Nobody To Wait For */
+    for(int Counter{};Counter<10;Counter++){EXPECT_TRUE(Buffer.Try_Write(Counter));}
+    auto Fast{Buffer.Subscribe()};
+    {
+        auto Slow{Buffer.Subscribe()};
+        EXPECT_THROW(Buffer.Subscribe(),std::runtime_error);
+        for(int Counter{};Counter<4;Counter++){EXPECT_TRUE(Buffer.Try_Write(Counter));}
+        EXPECT_FALSE(Buffer.Try_Write(4));
+        int Element{};
+        for(int Counter{};Counter<4;Counter++){EXPECT_EQ(Fast.Try_Read(Element).m_Missed,0);}
+        /* Fast Reader Is Done, Slow Reader Still Holds The Whole Ring */
+        EXPECT_FALSE(Buffer.Try_Write(4));
+        EXPECT_EQ(Slow.Try_Read(Element).m_Sequence,10);
+        EXPECT_TRUE(Buffer.Try_Write(4));
+        EXPECT_FALSE(Buffer.Try_Write(5));
+    }
+    /* Dropping The Slow Reader Frees Its Slot And Unblocks The Writer */
+    EXPECT_TRUE(Buffer.Try_Write(5));
+    auto Again{Buffer.Subscribe()};
+    int Element{};
+    EXPECT_EQ(Fast.Try_Read(Element).m_Sequence,14);
+    EXPECT_EQ(Element,4);
+}
+
+TEST_F(Broadcast_Circular_Buffer_Test,BACKPRESSURE_CONCURRENT_READERS_LOSE_NOTHING)
+{
+    constexpr uint64_t ELEMENTS{100000};
+    Broadcast_Circular_Buffer<uint64_t,64,Broadcast_Policy::Backpressure,4> Buffer{};
+    std::vector<decltype(Buffer)::Reader> Readers{};
+    for(int Counter{};Counter<3;Counter++){Readers.push_back(Buffer.Subscribe());}
+    std::array<uint64_t,3> Sums{};
+    std::array<bool,3> Ordered{true,true,true};
+    std::vector<std::thread> Threads{};
+    for(size_t Index{};Index<Readers.size();Index++)
+    {
+        Threads.emplace_back([&,Index]
+        {
+            uint64_t Element{};
+            uint64_t Expected{};
+            while(Readers[Index].Read(Element).m_Status==Read_Status::Element)
+            {
+                Ordered[Index]&=(Element==Expected++);
+                Sums[Index]+=Element;
+            }
+        });
+    }
+    for(uint64_t Counter{};Counter<ELEMENTS;Counter++){Buffer.Write(Counter);}
+    Buffer.Close();
+    for(auto& Thread:Threads){Thread.join();}
+    for(size_t Index{};Index<Readers.size();Index++)
+    {
+        EXPECT_TRUE(Ordered[Index]);
+        EXPECT_EQ(Sums[Index],ELEMENTS*(ELEMENTS-1)/2);
+    }
+}
+
+TEST_F(Broadcast_Circular_Buffer_Test,LAPPING_CONCURRENT_READER_NEVER_TEARS)
+{
+    constexpr uint64_t ELEMENTS{200000};
+    Broadcast_Circular_Buffer<Sample,16> Buffer{};
+    auto Reader{Buffer.Subscribe()};
+    uint64_t Read{};
+    uint64_t Missed{};
+    bool Consistent{true};
+    std::thread Consumer{[&]
+    {
+        Sample Element{};
+        uint64_t Last{};
+        bool First{true};
+        while(true)
+        {
+            const auto Result{Reader.Read(Element)};
+            if(Result.m_Status!=Read_Status::Element){break;}
+            Consistent&=(Element.m_Sequence==Result.m_Sequence);
+            Consistent&=(Element.m_Square==Element.m_Sequence*Element.m_Sequence);
+            Consistent&=(Element.m_Check==~Element.m_Sequence);
+            Consistent&=(First||Result.m_Sequence>Last);
+            Last=Result.m_Sequence;
+            First=false;
+            Read++;
+            Missed+=Result.m_Missed;
+        }
+    }};
+    for(uint64_t Counter{};Counter<ELEMENTS;Counter++){Buffer.Write(Sample{Counter,Counter*Counter,~Counter});}
+    Buffer.Close();
+    Consumer.join();
+    EXPECT_TRUE(Consistent);
+    /* Every Element Is Either Read Or Reported Missed */
+    EXPECT_EQ(Read+Missed,ELEMENTS);
+}
+/********************************************************************
+ *  END OF FILE:  Broadcast_Circular_Buffer_Test.cpp
+********************************************************************/
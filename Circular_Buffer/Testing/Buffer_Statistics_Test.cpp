@@ -0,0 +1,122 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Buffer_Statistics_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Buffer_Statistics Implementation
+ *  Class Name:  Buffer_Statistics_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Overflow_Policy;
+template <typename Type,size_t TOTAL_SIZE,Overflow_Policy POLICY=Overflow_Policy::Overwrite>
+using Counted_Buffer=Data_Structure::Circular_Buffer<Type,TOTAL_SIZE,POLICY,Data_Structure::Atomic_Statistics>;
+/* Default Policy Leaves Layout And Interface As They Were */
+static_assert(sizeof(Data_Structure::Circular_Buffer<int,8>)==3*sizeof(size_t)+8*sizeof(int));
+template <typename Buffer_Type>
+concept Has_Statistics=requires(const Buffer_Type& Buffer){Buffer.Statistics();};
+static_assert(!Has_Statistics<Data_Structure::Circular_Buffer<int,8>>);
+static_assert(Has_Statistics<Counted_Buffer<int,8>>);
+/*****************************************
+------    Buffer_Statistics_Test     -----
+*****************************************/
+class Buffer_Statistics_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Buffer_Statistics_Test,OVERWRITE_COUNTS)
+{
+    Counted_Buffer<int,4> Buffer{};
+    for(int Counter{};Counter<6;Counter++){Buffer.Push(Counter);}
+    auto Statistics{Buffer.Statistics()};
+    EXPECT_EQ(Statistics.m_Pushes,6);
+    EXPECT_EQ(Statistics.m_Overwrites,2);
+    EXPECT_EQ(Statistics.m_High_Water_Mark,4);
+    EXPECT_EQ(Statistics.m_Drops,0);
+    Buffer.Pop();
+    Buffer.Pop();
+    Buffer.Pop();
+    /* One Left, Five More Overwrite It And Skip One Of Their Own */
+    const std::array<int,5> Batch{10,11,12,13,14};
+    Buffer.Push_N(Batch);
+    std::array<int,2> Out{};
+    Buffer.Pop_N(Out);
+    Buffer.Commit_Read(1);
+    Buffer.Emplace(20);
+    Statistics=Buffer.Statistics();
+    EXPECT_EQ(Statistics.m_Pushes,12);
+    EXPECT_EQ(Statistics.m_Pops,6);
+    EXPECT_EQ(Statistics.m_Overwrites,4);
+    EXPECT_EQ(Statistics.m_High_Water_Mark,4);
+    /* Copies Carry The Counters, Rebuilding Is Not Counted Again */
+    const Counted_Buffer<int,4> Copy{Buffer};
+    EXPECT_EQ(Copy.Statistics().m_Pushes,12);
+    EXPECT_EQ(Copy.Statistics().m_Pops,6);
+}
+
+TEST_F(Buffer_Statistics_Test,REJECT_DROPS_AND_TIME_AT_FULL)
+{
+    Counted_Buffer<int,2,Overflow_Policy::Reject> Buffer{};
+    Buffer.Push(1);
+    Buffer.Push(2);
+    EXPECT_FALSE(Buffer.Push(3));
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    const auto While_Full{Buffer.Statistics()};
+    EXPECT_EQ(While_Full.m_Drops,1);
+    EXPECT_GE(While_Full.m_Time_At_Full,std::chrono::milliseconds{5});
+    Buffer.Pop();
+    const auto After_Full{Buffer.Statistics()};
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    /* Clock Stops Once The Buffer Is No Longer Full */
+    EXPECT_EQ(Buffer.Statistics().m_Time_At_Full,After_Full.m_Time_At_Full);
+    const std::array<int,3> Batch{4,5,6};
+    EXPECT_EQ(Buffer.Push_N(Batch),1);
+    const auto Final{Buffer.Statistics()};
+    EXPECT_EQ(Final.m_Drops,3);
+    EXPECT_EQ(Final.m_Pushes,3);
+    EXPECT_GT(Data_Structure::Push_Rate({},Final),0.0);
+    EXPECT_EQ(Data_Structure::Pop_Rate(Final,Final),0.0);
+}
+
+TEST_F(Buffer_Statistics_Test,SNAPSHOT_FROM_ANOTHER_THREAD)
+{
+    constexpr uint64_t PUSHES{100000};
+    Counted_Buffer<uint64_t,64> Buffer{};
+    std::atomic<bool> Done{false};
+    uint64_t Last_Seen{};
+    bool Monotonic{true};
+    std::thread Monitor{[&]
+    {
+        while(!Done.load(std::memory_order_acquire))
+        {
+            const uint64_t Seen{Buffer.Statistics().m_Pushes};
+            Monotonic&=(Seen>=Last_Seen);
+            Last_Seen=Seen;
+        }
+    }};
+    for(uint64_t Counter{};Counter<PUSHES;Counter++){Buffer.Push(Counter);}
+    Done.store(true,std::memory_order_release);
+    Monitor.join();
+    EXPECT_TRUE(Monotonic);
+    EXPECT_EQ(Buffer.Statistics().m_Pushes,PUSHES);
+    EXPECT_EQ(Buffer.Statistics().m_Overwrites,PUSHES-64);
+}
+/********************************************************************
+ *  END OF FILE:  Buffer_Statistics_Test.cpp
+********************************************************************/
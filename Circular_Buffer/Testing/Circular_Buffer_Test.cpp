@@ -16,10 +16,29 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <stdexcept>
+#include <string>
+#include <memory>
+#include <vector>
 #include <array>
+#include <span>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <iterator>
 /*****************************************
 ----------    GLOBAL DATA     ------------
 *****************************************/
+/* Not Default Constructible And Counts Live Objects */
+struct Tracked
+{
+    explicit Tracked(int Value):m_Value{Value}{s_Live++;}
+    Tracked(const Tracked& Object):m_Value{Object.m_Value}{s_Live++;}
+    Tracked& operator=(const Tracked&)=default;
+    ~Tracked(){s_Live--;}
+    bool operator==(const Tracked& Object)const{return m_Value==Object.m_Value;}
+    int m_Value;
+    static inline int s_Live{};
+};
 /*****************************************
 -------    Circular_Buffer_Test     ------
 *****************************************/
@@ -36,28 +55,33 @@ TEST_F(Circular_Buffer_Test,PUSH_BACK_CHECK_HEAD_TAIL)
     EXPECT_EQ(Buffer.Is_Empty(),true);
     /* [ 0 0 0 0 0 ] */
     /* [ X         ] */
-    EXPECT_EQ(Buffer.Head(),0);
-    EXPECT_EQ(Buffer.Tail(),0);
+    EXPECT_EQ(Buffer.Size(),0);
+    EXPECT_THROW(Buffer.Head(),std::runtime_error);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
     /* [ 1 0 0 0 0 ] */
     /* [ H T       ] */
     Buffer.Push(1);
     EXPECT_EQ(Buffer.Head(),1);
-    EXPECT_EQ(Buffer.Tail(),0);
+    EXPECT_EQ(Buffer.Size(),1);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
     /* [ 1 2 0 0 0 ] */
     /* [ H   T     ] */
     Buffer.Push(2);
     EXPECT_EQ(Buffer.Head(),1);
-    EXPECT_EQ(Buffer.Tail(),0);
+    EXPECT_EQ(Buffer.Size(),2);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
     /* [ 1 2 3 0 0 ] */
     /* [ H     T   ] */
     Buffer.Push(3);
     EXPECT_EQ(Buffer.Head(),1);
-    EXPECT_EQ(Buffer.Tail(),0);
+    EXPECT_EQ(Buffer.Size(),3);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
     /* [ 1 2 3 4 0 ] */
     /* [ H       T ] */
     Buffer.Push(4);
     EXPECT_EQ(Buffer.Head(),1);
-    EXPECT_EQ(Buffer.Tail(),0);
+    EXPECT_EQ(Buffer.Size(),4);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
     /* [ 1 2 3 4 5 ] */
     /* [ X         ] */
     Buffer.Push(5);
@@ -154,11 +178,11 @@ TEST_F(Circular_Buffer_Test,PUSH_BACK_CHECK_HEAD_2)
     }
     /* [ 6 7 8 9 10 ] */
     /* [ X          ] */
-    EXPECT_EQ(Buffer.Head(),6);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
     EXPECT_EQ(Buffer.Size(),0);
     EXPECT_THROW(Buffer.Pop(),std::runtime_error);
-    EXPECT_EQ(Buffer.Head(),6);
-    EXPECT_EQ(Buffer.Tail(),6);
+    EXPECT_THROW(Buffer.Head(),std::runtime_error);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
     EXPECT_EQ(Buffer.Size(),0);
 }
 
@@ -191,17 +215,20 @@ TEST_F(Circular_Buffer_Test,EXAMPLE_TEST)
     /* [ 30 10 15 20 25 ] */
     /* [     T  H       ] */
     EXPECT_EQ(Q.Head(), 15);
-    EXPECT_EQ(Q.Tail(), 10);
+    EXPECT_EQ(Q.Size(), 4);
+    EXPECT_THROW(Q.Tail(), std::runtime_error);
     Q.Pop();
     /* [ 30 10 15 20 25 ] */
     /* [     T     H    ] */
     EXPECT_EQ(Q.Head(), 20);
-    EXPECT_EQ(Q.Tail(), 10);
+    EXPECT_EQ(Q.Size(), 3);
+    EXPECT_THROW(Q.Tail(), std::runtime_error);
     Q.Push(35);
     /* [ 30 35 15 20 25 ] */
     /* [        T  H    ] */  
     EXPECT_EQ(Q.Head(), 20);
-    EXPECT_EQ(Q.Tail(), 15);
+    EXPECT_EQ(Q.Size(), 4);
+    EXPECT_THROW(Q.Tail(), std::runtime_error);
     Q.Push(40);
     /* [ 30 35 40 20 25 ] */
     /* [          X    ] */  
@@ -250,13 +277,16 @@ TEST_F(Circular_Buffer_Test,CUSTOM_ITERATOR_FOREACH)
     EXPECT_EQ(Q.Tail(), 10);
     Q.Pop();
     EXPECT_EQ(Q.Head(), 15);
-    EXPECT_EQ(Q.Tail(), 10);
+    EXPECT_EQ(Q.Size(), 4);
+    EXPECT_THROW(Q.Tail(), std::runtime_error);
     Q.Pop();
     EXPECT_EQ(Q.Head(), 20);
-    EXPECT_EQ(Q.Tail(), 10);
+    EXPECT_EQ(Q.Size(), 3);
+    EXPECT_THROW(Q.Tail(), std::runtime_error);
     Q.Push(35); 
     EXPECT_EQ(Q.Head(), 20);
-    EXPECT_EQ(Q.Tail(), 15);
+    EXPECT_EQ(Q.Size(), 4);
+    EXPECT_THROW(Q.Tail(), std::runtime_error);
     Q.Push(40);
     EXPECT_EQ(Q.Head(), 20);
     EXPECT_EQ(Q.Tail(), 20);
@@ -277,6 +307,256 @@ TEST_F(Circular_Buffer_Test,CUSTOM_ITERATOR_FORLOOP)
     for(auto &Value:Q1){Q2.Push(Value);}
     EXPECT_EQ(Q1, Q2);
 }
+TEST_F(Circular_Buffer_Test,PUSH_N_POP_N_WRAP_AROUND)
+{
+    Data_Structure::Circular_Buffer<int,5> Buffer{1,2,3};
+    std::array<int,3> Output{};
+    /* [ 1 2 3 0 0 ] -> [ X X 3 0 0 ] */
+    EXPECT_EQ(Buffer.Pop_N(std::span<int>(Output.data(),2)),2);
+    EXPECT_EQ(Output[0],1);
+    EXPECT_EQ(Output[1],2);
+    /* [ 6 2 3 4 5 ] "Second Segment Wraps To Start" */
+    std::array<int,3> Input{4,5,6};
+    EXPECT_EQ(Buffer.Push_N(Input),3);
+    EXPECT_EQ(Buffer.Size(),4);
+    EXPECT_EQ(Buffer.Head(),3);
+    std::array<int,5> Result{};
+    EXPECT_EQ(Buffer.Pop_N(Result),4);
+    EXPECT_EQ(Result,(std::array<int,5>{3,4,5,6,0}));
+    EXPECT_EQ(Buffer.Pop_N(Result),0);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(Circular_Buffer_Test,PUSH_N_OVERWRITE_MATCHES_PUSH)
+{
+    std::vector<int> Input{};
+    for(int Counter{};Counter<13;Counter++){Input.push_back(Counter);}
+    for(size_t Batch{1};Batch<=Input.size();Batch++)
+    {
+        Data_Structure::Circular_Buffer<int,5> Single{7,8};
+        Data_Structure::Circular_Buffer<int,5> Bulk{7,8};
+        for(size_t Counter{};Counter<Batch;Counter++){Single.Push(Input[Counter]);}
+        EXPECT_EQ(Bulk.Push_N(std::span<const int>(Input.data(),Batch)),Batch);
+        EXPECT_EQ(Single,Bulk);
+        EXPECT_EQ(Single.Head(),Bulk.Head());
+        EXPECT_EQ(Single.Size(),Bulk.Size());
+    }
+}
+
+TEST_F(Circular_Buffer_Test,PUSH_N_POWER_OF_TWO)
+{
+    Data_Structure::Circular_Buffer<int,4> Buffer{};
+    std::array<int,6> Input{1,2,3,4,5,6};
+    EXPECT_EQ(Buffer.Push_N(Input),6);
+    std::array<int,4> Output{};
+    EXPECT_EQ(Buffer.Pop_N(Output),4);
+    EXPECT_EQ(Output,(std::array<int,4>{3,4,5,6}));
+}
+
+TEST_F(Circular_Buffer_Test,PUSH_N_NON_TRIVIAL_TYPE)
+{
+    Data_Structure::Circular_Buffer<std::string,3> Buffer{"A"};
+    std::array<std::string,3> Input{"B","C","D"};
+    EXPECT_EQ(Buffer.Push_N(Input),3);
+    std::array<std::string,3> Output{};
+    EXPECT_EQ(Buffer.Pop_N(Output),3);
+    EXPECT_EQ(Output,(std::array<std::string,3>{"B","C","D"}));
+}
+TEST_F(Circular_Buffer_Test,READABLE_WRITABLE_SPANS)
+{
+    Data_Structure::Circular_Buffer<char,8> Buffer{};
+    const std::string Message{"HELLO WORLD"};
+    /* Producer Writes Directly Into Free Region "Like read()" */
+    auto Writable=Buffer.Writable_Spans();
+    EXPECT_EQ(Writable[0].size(),8);
+    EXPECT_EQ(Writable[1].size(),0);
+    std::copy_n(Message.begin(),6,Writable[0].begin());
+    Buffer.Commit_Write(6);
+    EXPECT_EQ(Buffer.Size(),6);
+    /* Consumer Sends Part Directly From Occupied Region "Like send()" */
+    auto Readable=Buffer.Readable_Spans();
+    EXPECT_EQ(std::string(Readable[0].begin(),Readable[0].end()),"HELLO ");
+    EXPECT_EQ(Readable[1].size(),0);
+    Buffer.Commit_Read(4);
+    /* Free Region Now Wraps Around The End */
+    Writable=Buffer.Writable_Spans();
+    EXPECT_EQ(Writable[0].size(),2);
+    EXPECT_EQ(Writable[1].size(),4);
+    std::copy_n(Message.begin()+6,2,Writable[0].begin());
+    std::copy_n(Message.begin()+8,3,Writable[1].begin());
+    Buffer.Commit_Write(5);
+    /* Occupied Region Wraps Around The End */
+    Readable=Buffer.Readable_Spans();
+    std::string Received(Readable[0].begin(),Readable[0].end());
+    Received.append(Readable[1].begin(),Readable[1].end());
+    EXPECT_EQ(Received,"O WORLD");
+    Buffer.Commit_Read(Readable[0].size()+Readable[1].size());
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(Circular_Buffer_Test,COMMIT_OUT_OF_RANGE)
+{
+    Data_Structure::Circular_Buffer<int,5> Buffer{1,2,3};
+    EXPECT_THROW(Buffer.Commit_Read(4),std::runtime_error);
+    EXPECT_THROW(Buffer.Commit_Write(3),std::runtime_error);
+    Buffer.Commit_Write(2);
+    EXPECT_EQ(Buffer.Size(),5);
+    EXPECT_EQ(Buffer.Writable_Spans()[0].size()+Buffer.Writable_Spans()[1].size(),0);
+}
+TEST_F(Circular_Buffer_Test,MOVE_ONLY_ELEMENTS)
+{
+    Data_Structure::Circular_Buffer<std::unique_ptr<int>,3> Buffer{};
+    Buffer.Push(std::make_unique<int>(1));
+    Buffer.Emplace(new int(2));
+    Buffer.Push(std::make_unique<int>(3));
+    /* Overflow Replaces Oldest Element */
+    Buffer.Push(std::make_unique<int>(4));
+    EXPECT_EQ(*Buffer.Head(),2);
+    std::unique_ptr<int> Element{};
+    EXPECT_EQ(Buffer.Pop(Element),true);
+    EXPECT_EQ(*Element,2);
+    EXPECT_EQ(*Buffer.Pop(),3);
+    /* Buffers Of Move Only Elements Are Movable */
+    Data_Structure::Circular_Buffer<std::unique_ptr<int>,3> Moved{std::move(Buffer)};
+    EXPECT_EQ(*Moved.Pop(),4);
+    EXPECT_EQ(Moved.Pop(Element),false);
+}
+
+TEST_F(Circular_Buffer_Test,LIVE_ELEMENTS_ONLY)
+{
+    {
+        Data_Structure::Circular_Buffer<Tracked,4> Buffer{};
+        /* Construction Touches No Slot */
+        EXPECT_EQ(Tracked::s_Live,0);
+        Buffer.Emplace(1);
+        Buffer.Emplace(2);
+        EXPECT_EQ(Tracked::s_Live,2);
+        EXPECT_EQ(Buffer.Pop().m_Value,1);
+        EXPECT_EQ(Tracked::s_Live,1);
+        for(int Counter{3};Counter<10;Counter++){Buffer.Emplace(Counter);}
+        EXPECT_EQ(Tracked::s_Live,4);
+        std::array<Tracked,2> Batch{Tracked{10},Tracked{11}};
+        EXPECT_EQ(Buffer.Push_N(Batch),2);
+        EXPECT_EQ(Tracked::s_Live,6);
+        EXPECT_EQ(Buffer.Head().m_Value,8);
+        Data_Structure::Circular_Buffer<Tracked,4> Copy{};
+        Copy=Buffer;
+        EXPECT_EQ(Copy,Buffer);
+        EXPECT_EQ(Tracked::s_Live,10);
+    }
+    /* Destruction Released Every Live Element */
+    EXPECT_EQ(Tracked::s_Live,0);
+}
+TEST_F(Circular_Buffer_Test,TRY_POP)
+{
+    Data_Structure::Circular_Buffer<std::unique_ptr<int>,3> Buffer{};
+    /* Empty Buffer Returns Nothing Instead Of Throwing */
+    EXPECT_FALSE(Buffer.Try_Pop().has_value());
+    Buffer.Push(std::make_unique<int>(7));
+    std::optional<std::unique_ptr<int>> Element{Buffer.Try_Pop()};
+    ASSERT_TRUE(Element.has_value());
+    EXPECT_EQ(**Element,7);
+    EXPECT_TRUE(Buffer.Is_Empty());
+    EXPECT_FALSE(Buffer.Try_Pop().has_value());
+}
+TEST_F(Circular_Buffer_Test,REJECT_POLICY)
+{
+    Data_Structure::Circular_Buffer<int,3,Data_Structure::Overflow_Policy::Reject> Buffer{};
+    EXPECT_TRUE(Buffer.Push(1));
+    EXPECT_TRUE(Buffer.Push(2));
+    EXPECT_TRUE(Buffer.Push(3));
+    /* Full Buffer Refuses New Elements And Keeps The Oldest */
+    EXPECT_FALSE(Buffer.Push(4));
+    EXPECT_EQ(Buffer.Size(),3);
+    EXPECT_EQ(Buffer.Head(),1);
+    EXPECT_EQ(Buffer.Pop(),1);
+    /* Bulk Push Takes Only What Fits */
+    std::array<int,3> Batch{5,6,7};
+    EXPECT_EQ(Buffer.Push_N(Batch),1);
+    std::array<int,3> Output{};
+    EXPECT_EQ(Buffer.Pop_N(Output),3);
+    EXPECT_EQ(Output,(std::array<int,3>{2,3,5}));
+    EXPECT_THROW(Buffer.Pop(),std::runtime_error);
+    /* Refused Move Only Element Is Left Untouched */
+    Data_Structure::Circular_Buffer<std::unique_ptr<int>,1,Data_Structure::Overflow_Policy::Reject> Owners{};
+    EXPECT_TRUE(Owners.Push(std::make_unique<int>(1)));
+    std::unique_ptr<int> Element{std::make_unique<int>(2)};
+    EXPECT_FALSE(Owners.Push(std::move(Element)));
+    ASSERT_NE(Element,nullptr);
+    EXPECT_EQ(*Element,2);
+}
+TEST_F(Circular_Buffer_Test,UNCHECKED_POLICY)
+{
+    Data_Structure::Circular_Buffer<int,4,Data_Structure::Overflow_Policy::Unchecked> Buffer{};
+    for(int Round{};Round<3;Round++)
+    {
+        /* Caller Keeps Within Capacity So No Checks Are Needed */
+        for(int Counter{};Counter<4;Counter++){EXPECT_TRUE(Buffer.Push(Counter+Round));}
+        EXPECT_EQ(Buffer.Size(),4);
+        for(int Counter{};Counter<4;Counter++){EXPECT_EQ(Buffer.Pop(),Counter+Round);}
+        EXPECT_TRUE(Buffer.Is_Empty());
+    }
+    std::array<int,3> Batch{1,2,3};
+    EXPECT_EQ(Buffer.Push_N(Batch),3);
+    EXPECT_EQ(Buffer.Emplace(4),4);
+    Buffer.Commit_Read(2);
+    EXPECT_EQ(Buffer.Head(),3);
+}
+TEST_F(Circular_Buffer_Test,RANDOM_ACCESS_ITERATORS)
+{
+    using Buffer_Type=Data_Structure::Circular_Buffer<int,7>;
+    static_assert(std::random_access_iterator<Buffer_Type::iterator>);
+    static_assert(std::random_access_iterator<Buffer_Type::const_iterator>);
+    static_assert(std::random_access_iterator<Buffer_Type::reverse_iterator>);
+    Buffer_Type Buffer{};
+    /* Sorted Contents Wrapping Around End Of Storage [ 14 16 18 | 6 8 10 12 ] */
+    for(int Counter{};Counter<10;Counter++){Buffer.Push(Counter*2);}
+    ASSERT_EQ(Buffer.end()-Buffer.begin(),7);
+    /* Binary Search Jumps Straight Across The Wrap Point */
+    const Buffer_Type &Constant{Buffer};
+    auto Found{std::lower_bound(Constant.begin(),Constant.end(),13)};
+    EXPECT_EQ(Found-Constant.begin(),4);
+    EXPECT_EQ(*Found,14);
+    EXPECT_TRUE(std::binary_search(Buffer.cbegin(),Buffer.cend(),18));
+    EXPECT_FALSE(std::binary_search(Buffer.cbegin(),Buffer.cend(),7));
+    /* Jumps, Indexing And Ordering */
+    auto Iterator{Buffer.begin()};
+    std::advance(Iterator,5);
+    EXPECT_EQ(*Iterator,16);
+    EXPECT_EQ(Iterator[-5],6);
+    EXPECT_EQ(*(2+Buffer.begin()),10);
+    EXPECT_EQ(*(Buffer.end()-1),18);
+    EXPECT_LT(Buffer.begin(),Iterator);
+    Buffer_Type::const_iterator Converted{Iterator};
+    EXPECT_EQ(Converted,Constant.begin()+5);
+    /* Reverse Iteration Visits Newest First */
+    std::vector<int> Reversed(Buffer.rbegin(),Buffer.rend());
+    EXPECT_EQ(Reversed,(std::vector<int>{18,16,14,12,10,8,6}));
+    EXPECT_EQ(*Constant.crbegin(),18);
+    /* Mutating Algorithms Work In Place */
+    std::nth_element(Buffer.begin(),Buffer.begin()+3,Buffer.end(),std::greater<int>{});
+    EXPECT_EQ(Buffer[3],12);
+    std::sort(Buffer.begin(),Buffer.end());
+    EXPECT_TRUE(std::is_sorted(Buffer.begin(),Buffer.end()));
+}
+TEST_F(Circular_Buffer_Test,LOGICAL_INDEXING)
+{
+    Data_Structure::Circular_Buffer<int,5> Buffer{1,2,3,4,5};
+    Buffer.Push(6);
+    Buffer.Push(7);
+    /* Index Zero Is Always The Head Whatever Slot It Lives In */
+    for(size_t Counter{};Counter<Buffer.Size();Counter++)
+    {
+        EXPECT_EQ(Buffer[Counter],static_cast<int>(Counter)+3);
+        EXPECT_EQ(Buffer.At(Counter),static_cast<int>(Counter)+3);
+    }
+    Buffer.At(4)=70;
+    EXPECT_EQ(Buffer[4],70);
+    EXPECT_THROW(Buffer.At(5),std::runtime_error);
+    Buffer.Pop();
+    EXPECT_EQ(Buffer.At(0),4);
+    EXPECT_THROW(Buffer.At(4),std::runtime_error);
+}
 /********************************************************************
  *  END OF FILE:  Circular_Buffer_Test.cpp
 ********************************************************************/
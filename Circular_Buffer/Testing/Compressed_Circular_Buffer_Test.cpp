@@ -0,0 +1,144 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Compressed_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Compressed_Circular_Buffer Implementation
+ *  Class Name:  Compressed_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Compressed_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Compressed_Circular_Buffer;
+using Data_Structure::Simd_Level;
+/* Every Level The Running Cpu Can Decode With */
+static std::vector<Simd_Level> Supported_Levels(void)
+{
+    std::vector<Simd_Level> Levels{Simd_Level::Scalar};
+    if(Data_Structure::Best_Simd_Level()>=Simd_Level::SSE){Levels.push_back(Simd_Level::SSE);}
+    if(Data_Structure::Best_Simd_Level()>=Simd_Level::AVX2){Levels.push_back(Simd_Level::AVX2);}
+    return Levels;
+}
+/*****************************************
+--    Compressed_Circular_Buffer_Test   --
+*****************************************/
+class Compressed_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Compressed_Circular_Buffer_Test,MONOTONIC_SERIES_ROUND_TRIP_AND_RATIO)
+{
+    Compressed_Circular_Buffer<64,256> Buffer{};
+    EXPECT_TRUE(Buffer.Is_Empty());
+    EXPECT_THROW(Buffer.Newest(),std::runtime_error);
+    /* Microsecond Timestamps Every Millisecond With Jitter, Plus A Steady Counter */
+    std::mt19937 Generator{7};
+    std::uniform_int_distribution<int64_t> Jitter{-50,50};
+    std::vector<int64_t> Pushed{};
+    for(int64_t Counter{};Counter<8000;Counter++)
+    {
+        const int64_t Sample{1'700'000'000'000'000+Counter*1000+Jitter(Generator)};
+        Buffer.Push(Sample);
+        Pushed.push_back(Sample);
+    }
+    ASSERT_EQ(Buffer.Size(),Pushed.size());
+    EXPECT_EQ(Buffer.Oldest(),Pushed.front());
+    EXPECT_EQ(Buffer.Newest(),Pushed.back());
+    /* Jittered Clock Costs One To Two Bytes Per Sample */
+    EXPECT_LT(Buffer.Encoded_Bytes()*4,Buffer.Size()*sizeof(int64_t));
+    for(const Simd_Level Level:Supported_Levels())
+    {
+        std::vector<int64_t> Decoded(Buffer.Size());
+        EXPECT_EQ(Buffer.Decode(Decoded,Level),Pushed.size());
+        EXPECT_EQ(Decoded,Pushed);
+    }
+    /* Steady Counter Is One Byte Per Sample */
+    Compressed_Circular_Buffer<64,256> Counter_Buffer{};
+    for(int64_t Counter{};Counter<10000;Counter++){Counter_Buffer.Push(Counter*3);}
+    EXPECT_LT(Counter_Buffer.Encoded_Bytes()*7,Counter_Buffer.Size()*sizeof(int64_t));
+    size_t Visited{};
+    bool Ordered{true};
+    Counter_Buffer.For_Each_Block([&](std::span<const int64_t> Samples)
+    {
+        for(const int64_t Sample:Samples){Ordered&=(Sample==static_cast<int64_t>(Visited++)*3);}
+    });
+    EXPECT_TRUE(Ordered);
+    EXPECT_EQ(Visited,10000);
+}
+
+TEST_F(Compressed_Circular_Buffer_Test,EVICTS_WHOLE_OLDEST_BLOCKS)
+{
+    Compressed_Circular_Buffer<4,32> Buffer{};
+    /* One Byte Per Sample, 33 Samples Per Block */
+    for(int64_t Counter{};Counter<33*4;Counter++){Buffer.Push(Counter);}
+    EXPECT_EQ(Buffer.Block_Count(),4);
+    EXPECT_EQ(Buffer.Size(),33*4);
+    Buffer.Push(1000);
+    /* Oldest Block Went Away With All Its Samples */
+    EXPECT_EQ(Buffer.Block_Count(),4);
+    EXPECT_EQ(Buffer.Size(),33*3+1);
+    EXPECT_EQ(Buffer.Oldest(),33);
+    std::vector<int64_t> Decoded(Buffer.Size());
+    ASSERT_EQ(Buffer.Decode(Decoded),Decoded.size());
+    EXPECT_EQ(Decoded.front(),33);
+    EXPECT_EQ(Decoded[33*3-1],33*4-1);
+    EXPECT_EQ(Decoded.back(),1000);
+    /* Short Output Takes The Oldest Samples Only */
+    std::array<int64_t,40> Partial{};
+    EXPECT_EQ(Buffer.Decode(Partial),40);
+    EXPECT_EQ(Partial[39],72);
+    Buffer.Clear();
+    EXPECT_TRUE(Buffer.Is_Empty());
+    EXPECT_EQ(Buffer.Block_Count(),0);
+    Buffer.Push(-5);
+    EXPECT_EQ(Buffer.Oldest(),-5);
+}
+
+TEST_F(Compressed_Circular_Buffer_Test,EXTREME_DELTAS_DECODE_ON_EVERY_LEVEL)
+{
+    Compressed_Circular_Buffer<8,64> Buffer{};
+    std::mt19937_64 Generator{11};
+    std::vector<int64_t> Pushed{};
+    /* Mix Long Runs Of Small Steps With Full Width Jumps "Both Decoder Paths Run" */
+    for(int Counter{};Counter<600;Counter++)
+    {
+        int64_t Sample{};
+        if(Counter%50==0){Sample=static_cast<int64_t>(Generator());}
+        else if(Counter%50==1){Sample=(Counter%100==1)?std::numeric_limits<int64_t>::min():std::numeric_limits<int64_t>::max();}
+        else{Sample=static_cast<int64_t>(static_cast<uint64_t>(Pushed.back())+Generator()%5-2);}
+        Buffer.Push(Sample);
+        Pushed.push_back(Sample);
+    }
+    std::vector<int64_t> Expected(Pushed.end()-static_cast<std::ptrdiff_t>(Buffer.Size()),Pushed.end());
+    for(const Simd_Level Level:Supported_Levels())
+    {
+        std::vector<int64_t> Decoded(Buffer.Size());
+        Buffer.Decode(Decoded,Level);
+        EXPECT_EQ(Decoded,Expected);
+    }
+    /* Truncated Stream Is Reported */
+    std::array<uint8_t,2> Truncated{0x80,0x80};
+    std::array<int64_t,2> Samples{};
+    EXPECT_THROW(Data_Structure::Decode_Delta_Block(Truncated,0,Samples,Simd_Level::Scalar),std::runtime_error);
+}
+/********************************************************************
+ *  END OF FILE:  Compressed_Circular_Buffer_Test.cpp
+********************************************************************/
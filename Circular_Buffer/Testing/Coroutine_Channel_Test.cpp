@@ -0,0 +1,163 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Coroutine_Channel_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Coroutine_Channel Implementation
+ *  Class Name:  Coroutine_Channel_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Coroutine_Channel.hpp"
+#include <gtest/gtest.h>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <string>
+#include <vector>
+#ifdef COROUTINE_CHANNEL_WITH_ASIO
+#include <boost/asio/io_context.hpp>
+#endif
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Coroutine_Channel;
+/* Starts Eagerly And Frees Its Frame When Done */
+struct Detached_Task
+{
+    struct promise_type
+    {
+        Detached_Task get_return_object(){return {};}
+        std::suspend_never initial_suspend()noexcept{return {};}
+        std::suspend_never final_suspend()noexcept{return {};}
+        void return_void(){}
+        void unhandled_exception(){std::terminate();}
+        /* Every Frame Is Counted "Awaits Must Not Add Any" */
+        static inline size_t Frames{};
+        static void* operator new(size_t Size)
+        {
+            Frames++;
+            return ::operator new(Size);
+        }
+        static void operator delete(void* Memory,size_t Size)noexcept{::operator delete(Memory,Size);}
+    };
+};
+template <typename Channel_Type>
+static Detached_Task Produce(Channel_Type& Channel,int Count,bool Close)
+{
+    for(int Counter{};Counter<Count;Counter++){co_await Channel.Push(Counter);}
+    if(Close){Channel.Close();}
+}
+template <typename Channel_Type>
+static Detached_Task Consume(Channel_Type& Channel,std::vector<int>& Received,bool& Finished)
+{
+    while(auto Element{co_await Channel.Pop()}){Received.push_back(*Element);}
+    Finished=true;
+}
+/*****************************************
+-----    Coroutine_Channel_Test     ------
+*****************************************/
+class Coroutine_Channel_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Coroutine_Channel_Test,INLINE_PRODUCER_CONSUMER)
+{
+    Coroutine_Channel<int,4> Channel{};
+    std::vector<int> Received{};
+    Received.reserve(1000);
+    bool Finished{};
+    Consume(Channel,Received,Finished);
+    EXPECT_TRUE(Received.empty());
+    /* One Frame For The Producer, Nothing Per Await */
+    const size_t Before{Detached_Task::promise_type::Frames};
+    Produce(Channel,1000,true);
+    EXPECT_EQ(Detached_Task::promise_type::Frames-Before,1);
+    ASSERT_TRUE(Finished);
+    ASSERT_EQ(Received.size(),1000);
+    for(int Counter{};Counter<1000;Counter++){EXPECT_EQ(Received[Counter],Counter);}
+}
+
+TEST_F(Coroutine_Channel_Test,FULL_CHANNEL_SUSPENDS_PRODUCERS_IN_ORDER)
+{
+    Coroutine_Channel<std::string,2> Channel{};
+    std::vector<bool> Results{};
+    auto Producer{[&](std::string Element)->Detached_Task{Results.push_back(co_await Channel.Push(std::move(Element)));}};
+    Producer("a");
+    Producer("b");
+    Producer("c");
+    Producer("d");
+    /* Two Buffered, Two Waiting */
+    EXPECT_EQ(Results.size(),2);
+    EXPECT_EQ(Channel.Size(),2);
+    EXPECT_FALSE(Channel.Try_Push("x"));
+    EXPECT_EQ(Channel.Try_Pop(),"a");
+    EXPECT_EQ(Results.size(),3);
+    EXPECT_EQ(Channel.Try_Pop(),"b");
+    EXPECT_EQ(Channel.Try_Pop(),"c");
+    EXPECT_EQ(Channel.Try_Pop(),"d");
+    EXPECT_FALSE(Channel.Try_Pop().has_value());
+    EXPECT_EQ(Results,std::vector<bool>(4,true));
+}
+
+TEST_F(Coroutine_Channel_Test,CLOSE_WAKES_EVERY_WAITER)
+{
+    Coroutine_Channel<int,1> Channel{};
+    std::vector<int> First_Received{};
+    std::vector<int> Second_Received{};
+    bool First_Finished{};
+    bool Second_Finished{};
+    Consume(Channel,First_Received,First_Finished);
+    Consume(Channel,Second_Received,Second_Finished);
+    /* Direct Handoff To The Oldest Waiting Consumer */
+    EXPECT_TRUE(Channel.Try_Push(7));
+    EXPECT_EQ(First_Received,std::vector<int>{7});
+    Channel.Close();
+    EXPECT_TRUE(First_Finished);
+    EXPECT_TRUE(Second_Finished);
+    EXPECT_TRUE(Second_Received.empty());
+    EXPECT_FALSE(Channel.Try_Push(8));
+    /* Producer Waiting On A Full Channel Is Refused */
+    Coroutine_Channel<int,1> Full{};
+    std::vector<bool> Results{};
+    auto Producer{[&](int Element)->Detached_Task{Results.push_back(co_await Full.Push(Element));}};
+    Producer(1);
+    Producer(2);
+    Full.Close();
+    EXPECT_EQ(Results,(std::vector<bool>{true,false}));
+    /* Buffered Element Still Delivered After Close */
+    std::vector<int> Drained{};
+    bool Drained_Finished{};
+    Consume(Full,Drained,Drained_Finished);
+    EXPECT_EQ(Drained,std::vector<int>{1});
+    EXPECT_TRUE(Drained_Finished);
+    EXPECT_TRUE(Full.Is_Closed());
+}
+#ifdef COROUTINE_CHANNEL_WITH_ASIO
+TEST_F(Coroutine_Channel_Test,ASIO_EXECUTOR)
+{
+    boost::asio::io_context Context{};
+    Coroutine_Channel<int,4,Data_Structure::Asio_Executor<boost::asio::io_context::executor_type>> Channel{Data_Structure::Asio_Executor{Context.get_executor()}};
+    std::vector<int> Received{};
+    bool Finished{};
+    Consume(Channel,Received,Finished);
+    Produce(Channel,100,true);
+    /* Waiters Only Resume From Inside The io_context */
+    EXPECT_TRUE(Received.empty());
+    Context.run();
+    ASSERT_TRUE(Finished);
+    ASSERT_EQ(Received.size(),100);
+    for(int Counter{};Counter<100;Counter++){EXPECT_EQ(Received[Counter],Counter);}
+}
+#endif
+/********************************************************************
+ *  END OF FILE:  Coroutine_Channel_Test.cpp
+********************************************************************/
@@ -0,0 +1,323 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Dynamic_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Dynamic_Circular_Buffer Implementation
+ *  Class Name:  Dynamic_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Dynamic_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <array>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Memory Resource Counting Bytes Handed Out */
+class Counting_Resource : public std::pmr::memory_resource
+{
+public:
+    size_t m_Allocated_Bytes{};
+private:
+    void* do_allocate(size_t Bytes,size_t Alignment)override
+    {
+        m_Allocated_Bytes+=Bytes;
+        return std::pmr::new_delete_resource()->allocate(Bytes,Alignment);
+    }
+    void do_deallocate(void* Block,size_t Bytes,size_t Alignment)override
+    {
+        std::pmr::new_delete_resource()->deallocate(Block,Bytes,Alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& Object)const noexcept override{return this==&Object;}
+};
+/* Counts Live Instances, Has No Default Constructor And Copies Throw On Request */
+struct Fragile_Element
+{
+    static inline int Live{};
+    static inline int Copies_Left{-1};
+    explicit Fragile_Element(int Value):m_Value{Value}{Live++;}
+    Fragile_Element(const Fragile_Element& Object):m_Value{Object.m_Value}
+    {
+        if(Copies_Left==0){throw std::runtime_error("Copy Failed");}
+        if(Copies_Left>0){Copies_Left--;}
+        Live++;
+    }
+    /* Not noexcept So Relinearize Copies Instead Of Moving */
+    Fragile_Element(Fragile_Element&& Object):Fragile_Element(static_cast<const Fragile_Element&>(Object)){}
+    Fragile_Element& operator=(const Fragile_Element&)=default;
+    ~Fragile_Element(){Live--;}
+    bool operator==(const Fragile_Element& Object)const{return m_Value==Object.m_Value;}
+    int m_Value;
+};
+/*****************************************
+---    Dynamic_Circular_Buffer_Test     ---
+*****************************************/
+class Dynamic_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Dynamic_Circular_Buffer_Test,PUSH_BACK_OVERWRITE)
+{
+    Data_Structure::Dynamic_Circular_Buffer<int> Buffer{5};
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+    EXPECT_EQ(Buffer.Capacity(),5);
+    for(int Counter{};Counter<=10;Counter++){Buffer.Push(Counter);}
+    /* [ 10 6 7 8 9 ] */
+    EXPECT_EQ(Buffer.Head(),6);
+    EXPECT_EQ(Buffer.Tail(),6);
+    EXPECT_EQ(Buffer.Size(),5);
+    for(int Counter{6};Counter<=10;Counter++){EXPECT_EQ(Buffer.Pop(),Counter);}
+    EXPECT_THROW(Buffer.Pop(),std::runtime_error);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,INVALID_CONSTRUCTION)
+{
+    EXPECT_THROW(Data_Structure::Dynamic_Circular_Buffer<int>{0},std::runtime_error);
+    auto Initialize=[]()
+    {Data_Structure::Dynamic_Circular_Buffer<int> Buffer(2,{1,2,3});};
+    EXPECT_THROW(Initialize(),std::runtime_error);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,GROW_RELINEARIZES)
+{
+    Data_Structure::Dynamic_Circular_Buffer<int> Buffer(4,{1,2,3,4},Data_Structure::Growth_Policy::Grow);
+    /* Move Head Away From Index Zero Then Wrap */
+    EXPECT_EQ(Buffer.Pop(),1);
+    EXPECT_EQ(Buffer.Pop(),2);
+    Buffer.Push(5);
+    Buffer.Push(6);
+    EXPECT_EQ(Buffer.Readable_Spans()[1].size(),2);
+    /* Full Buffer Grows Instead Of Overwriting */
+    Buffer.Push(7);
+    EXPECT_EQ(Buffer.Capacity(),8);
+    EXPECT_EQ(Buffer.Size(),5);
+    EXPECT_EQ(Buffer.Readable_Spans()[0].size(),5);
+    EXPECT_EQ(Buffer.Readable_Spans()[1].size(),0);
+    std::vector<int> Result{};
+    for(auto &Value:Buffer){Result.push_back(Value);}
+    EXPECT_EQ(Result,(std::vector<int>{3,4,5,6,7}));
+    /* Batch Larger Than Free Space Also Grows */
+    std::array<int,10> Input{};
+    EXPECT_EQ(Buffer.Push_N(Input),10);
+    EXPECT_EQ(Buffer.Size(),15);
+    EXPECT_GE(Buffer.Capacity(),15);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,PUSH_N_POP_N_WRAP_AROUND)
+{
+    Data_Structure::Dynamic_Circular_Buffer<std::string> Buffer(3,{"A"});
+    std::array<std::string,4> Input{"B","C","D","E"};
+    EXPECT_EQ(Buffer.Push_N(Input),4);
+    EXPECT_EQ(Buffer.Size(),3);
+    std::array<std::string,3> Output{};
+    EXPECT_EQ(Buffer.Pop_N(Output),3);
+    EXPECT_EQ(Output,(std::array<std::string,3>{"C","D","E"}));
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,PMR_ALLOCATOR)
+{
+    Counting_Resource Resource{};
+    using Buffer_Type=Data_Structure::Dynamic_Circular_Buffer<int,std::pmr::polymorphic_allocator<int>>;
+    Buffer_Type Buffer(16,Data_Structure::Growth_Policy::Grow,&Resource);
+    EXPECT_EQ(Resource.m_Allocated_Bytes,16*sizeof(int));
+    for(int Counter{};Counter<17;Counter++){Buffer.Push(Counter);}
+    EXPECT_EQ(Resource.m_Allocated_Bytes,(16+32)*sizeof(int));
+    EXPECT_EQ(Buffer.get_allocator().resource(),&Resource);
+    /* Copies Keep Contents */
+    Buffer_Type Copy{Buffer};
+    EXPECT_EQ(Copy,Buffer);
+    Buffer_Type Moved{std::move(Copy)};
+    EXPECT_EQ(Moved,Buffer);
+    EXPECT_EQ(Copy.Size(),0);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,READABLE_WRITABLE_SPANS)
+{
+    Data_Structure::Dynamic_Circular_Buffer<char> Buffer{4};
+    auto Writable=Buffer.Writable_Spans();
+    EXPECT_EQ(Writable[0].size(),4);
+    Writable[0][0]='A';
+    Writable[0][1]='B';
+    Writable[0][2]='C';
+    Buffer.Commit_Write(3);
+    Buffer.Commit_Read(2);
+    Writable=Buffer.Writable_Spans();
+    EXPECT_EQ(Writable[0].size(),1);
+    EXPECT_EQ(Writable[1].size(),2);
+    EXPECT_THROW(Buffer.Commit_Write(4),std::runtime_error);
+    EXPECT_THROW(Buffer.Commit_Read(2),std::runtime_error);
+    EXPECT_EQ(Buffer.Head(),'C');
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,USE_AFTER_MOVE)
+{
+    Data_Structure::Dynamic_Circular_Buffer<int> Overwrite(2,{1,2});
+    Data_Structure::Dynamic_Circular_Buffer<int> Grow(2,{1,2},Data_Structure::Growth_Policy::Grow);
+    auto Overwrite_Target{std::move(Overwrite)};
+    auto Grow_Target{std::move(Grow)};
+    /* Moved From Buffers Have No Storage, Writes Report It Instead Of Touching Memory */
+    EXPECT_EQ(Overwrite.Capacity(),0);
+    EXPECT_THROW(Overwrite.Push(3),std::runtime_error);
+    EXPECT_THROW(Grow.Push(3),std::runtime_error);
+    std::array<int,2> Input{};
+    EXPECT_THROW(Grow.Push_N(Input),std::runtime_error);
+    EXPECT_THROW(Overwrite.Pop(),std::runtime_error);
+    EXPECT_EQ(Overwrite.Pop_N(Input),0);
+    /* Reserve And Assignment Give Storage Back */
+    Overwrite.Reserve(3);
+    Overwrite.Push(3);
+    EXPECT_EQ(Overwrite.Pop(),3);
+    Grow=Grow_Target;
+    Grow.Push(3);
+    EXPECT_EQ(Grow.Size(),3);
+    EXPECT_EQ(Grow_Target.Size(),2);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,LIVE_SLOTS_ONLY_AND_STRONG_GROW)
+{
+    Fragile_Element::Live=0;
+    {
+        Data_Structure::Dynamic_Circular_Buffer<Fragile_Element> Buffer(8,Data_Structure::Growth_Policy::Grow);
+        /* No Slot Is Constructed Up Front */
+        EXPECT_EQ(Fragile_Element::Live,0);
+        for(int Counter{};Counter<8;Counter++){Buffer.Push(Fragile_Element{Counter});}
+        EXPECT_EQ(Fragile_Element::Live,8);
+        EXPECT_EQ(Buffer.Pop().m_Value,0);
+        Buffer.Push(Fragile_Element{8});
+        /* Copy Holds Live Elements Only */
+        auto Copy{Buffer};
+        EXPECT_EQ(Fragile_Element::Live,16);
+        EXPECT_EQ(Copy,Buffer);
+        /* Growth Fails Half Way Through Relinearize "Buffer Untouched, Nothing Leaks" */
+        Fragile_Element::Copies_Left=4;
+        EXPECT_THROW(Buffer.Push(Fragile_Element{9}),std::runtime_error);
+        Fragile_Element::Copies_Left=-1;
+        EXPECT_EQ(Buffer.Capacity(),8);
+        EXPECT_EQ(Buffer,Copy);
+        EXPECT_EQ(Fragile_Element::Live,16);
+        Buffer.Push(Fragile_Element{9});
+        EXPECT_EQ(Buffer.Capacity(),16);
+        EXPECT_EQ(Buffer.Size(),9);
+    }
+    EXPECT_EQ(Fragile_Element::Live,0);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,ASSIGNMENT_ACROSS_RESOURCES)
+{
+    Counting_Resource First_Resource{};
+    Counting_Resource Second_Resource{};
+    using Buffer_Type=Data_Structure::Dynamic_Circular_Buffer<std::string,std::pmr::polymorphic_allocator<std::string>>;
+    Buffer_Type Source(4,{"A","B","C"},Data_Structure::Growth_Policy::Overwrite,&First_Resource);
+    Buffer_Type Target(2,{"X"},Data_Structure::Growth_Policy::Grow,&Second_Resource);
+    /* Polymorphic Allocator Never Propagates, Target Keeps Its Resource */
+    Target=Source;
+    EXPECT_EQ(Target,Source);
+    EXPECT_EQ(Target.Capacity(),4);
+    EXPECT_EQ(Target.get_allocator().resource(),&Second_Resource);
+    Target.Push("D");
+    Target.Push("E");
+    EXPECT_EQ(Target.Head(),"B");
+    /* Unequal Resources Move Element By Element */
+    Target=std::move(Source);
+    EXPECT_EQ(Target.get_allocator().resource(),&Second_Resource);
+    EXPECT_EQ(Target.Size(),3);
+    EXPECT_EQ(Target.Pop(),"A");
+    EXPECT_EQ(Source.Size(),0);
+    /* Equal Resources Hand The Block Over */
+    Buffer_Type Other(3,{"Q"},Data_Structure::Growth_Policy::Overwrite,&Second_Resource);
+    const size_t Allocated_Bytes{Second_Resource.m_Allocated_Bytes};
+    Target=std::move(Other);
+    EXPECT_EQ(Second_Resource.m_Allocated_Bytes,Allocated_Bytes);
+    EXPECT_EQ(Target.Pop(),"Q");
+    EXPECT_EQ(Other.Capacity(),0);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,MOVE_ONLY_EMPLACE_AND_POP_INTO)
+{
+    Data_Structure::Dynamic_Circular_Buffer<std::unique_ptr<int>> Buffer(2,Data_Structure::Growth_Policy::Grow);
+    EXPECT_THROW(Buffer.Head(),std::runtime_error);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
+    Buffer.Push(std::make_unique<int>(1));
+    EXPECT_EQ(*Buffer.Emplace(new int{2}),2);
+    EXPECT_EQ(*Buffer.Tail(),1);
+    /* Full Buffer Grows By Moving Elements Over */
+    EXPECT_EQ(*Buffer.Emplace(new int{3}),3);
+    EXPECT_EQ(Buffer.Capacity(),4);
+    EXPECT_THROW(Buffer.Tail(),std::runtime_error);
+    std::unique_ptr<int> Value{};
+    for(int Counter{1};Counter<=3;Counter++)
+    {
+        EXPECT_EQ(Buffer.Pop(Value),true);
+        EXPECT_EQ(*Value,Counter);
+    }
+    EXPECT_EQ(Buffer.Pop(Value),false);
+    /* Overwrite Policy Replaces The Oldest Element */
+    Data_Structure::Dynamic_Circular_Buffer<std::unique_ptr<int>> Ring{2};
+    Ring.Emplace(new int{1});
+    Ring.Emplace(new int{2});
+    EXPECT_EQ(*Ring.Emplace(new int{3}),3);
+    EXPECT_EQ(*Ring.Head(),2);
+    EXPECT_EQ(*Ring.Pop(),2);
+}
+
+TEST_F(Dynamic_Circular_Buffer_Test,RANDOM_ACCESS_ITERATORS)
+{
+    using Buffer_Type=Data_Structure::Dynamic_Circular_Buffer<int>;
+    static_assert(std::random_access_iterator<Buffer_Type::iterator>);
+    static_assert(std::random_access_iterator<Buffer_Type::const_iterator>);
+    static_assert(std::random_access_iterator<Buffer_Type::reverse_iterator>);
+    Buffer_Type Buffer(7);
+    /* Sorted Contents Wrapping Around End Of Data Block [ 14 16 18 | 6 8 10 12 ] */
+    for(int Counter{};Counter<10;Counter++){Buffer.Push(Counter*2);}
+    ASSERT_EQ(Buffer.end()-Buffer.begin(),7);
+    /* Binary Search Jumps Straight Across The Wrap Point */
+    const Buffer_Type &Constant{Buffer};
+    auto Found{std::lower_bound(Constant.begin(),Constant.end(),13)};
+    EXPECT_EQ(Found-Constant.begin(),4);
+    EXPECT_EQ(*Found,14);
+    EXPECT_TRUE(std::binary_search(Buffer.cbegin(),Buffer.cend(),18));
+    EXPECT_FALSE(std::binary_search(Buffer.cbegin(),Buffer.cend(),7));
+    /* Jumps, Indexing And Ordering */
+    auto Iterator{Buffer.begin()+5};
+    EXPECT_EQ(*Iterator,16);
+    EXPECT_EQ(Iterator[-5],6);
+    EXPECT_EQ(*(Buffer.end()-1),18);
+    EXPECT_LT(Buffer.begin(),Iterator);
+    Buffer_Type::const_iterator Converted{Iterator};
+    EXPECT_EQ(Converted,Constant.begin()+5);
+    EXPECT_EQ(Buffer.At(6),18);
+    EXPECT_EQ(Constant[2],10);
+    EXPECT_THROW(Buffer.At(7),std::runtime_error);
+    /* Reverse Iteration Visits Newest First */
+    std::vector<int> Reversed(Constant.crbegin(),Constant.crend());
+    EXPECT_EQ(Reversed,(std::vector<int>{18,16,14,12,10,8,6}));
+    /* Sorting In Place Across The Wrap Point */
+    std::sort(Buffer.rbegin(),Buffer.rend());
+    EXPECT_EQ(Buffer.Head(),18);
+    std::sort(Buffer.begin(),Buffer.end());
+    EXPECT_TRUE(std::is_sorted(Buffer.begin(),Buffer.end()));
+    EXPECT_EQ(Buffer.Pop(),6);
+    /* Moved From Buffer Has Nothing To Visit */
+    Buffer_Type Other{std::move(Buffer)};
+    EXPECT_EQ(Buffer.begin(),Buffer.end());
+    EXPECT_THROW(Buffer.At(0),std::runtime_error);
+    EXPECT_EQ(Other.At(0),8);
+}
+/********************************************************************
+ *  END OF FILE:  Dynamic_Circular_Buffer_Test.cpp
+********************************************************************/
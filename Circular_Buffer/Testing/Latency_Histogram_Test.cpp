@@ -0,0 +1,88 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Latency_Histogram_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Latency_Histogram Implementation
+ *  Class Name:  Latency_Histogram_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Latency_Histogram.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/*****************************************
+------    Latency_Histogram_Test     -----
+*****************************************/
+class Latency_Histogram_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Latency_Histogram_Test,EMPTY_HISTOGRAM)
+{
+    Data_Structure::Latency_Histogram Histogram{};
+    EXPECT_EQ(Histogram.Count(),0);
+    EXPECT_EQ(Histogram.Percentile(50),0);
+    EXPECT_EQ(Histogram.Max(),0);
+    EXPECT_EQ(Histogram.Mean(),0.0);
+}
+
+TEST_F(Latency_Histogram_Test,SMALL_VALUES_ARE_EXACT)
+{
+    Data_Structure::Latency_Histogram Histogram{};
+    for(uint64_t Value{1};Value<=100;Value++){Histogram.Record(Value);}
+    EXPECT_EQ(Histogram.Count(),100);
+    EXPECT_EQ(Histogram.Min(),1);
+    EXPECT_EQ(Histogram.Max(),100);
+    EXPECT_EQ(Histogram.Percentile(50),50);
+    EXPECT_EQ(Histogram.Percentile(99),99);
+    EXPECT_EQ(Histogram.Percentile(100),100);
+    EXPECT_DOUBLE_EQ(Histogram.Mean(),50.5);
+}
+
+TEST_F(Latency_Histogram_Test,LARGE_VALUES_BOUNDED_ERROR)
+{
+    Data_Structure::Latency_Histogram Histogram{};
+    for(uint64_t Value{1};Value<=1000000;Value++){Histogram.Record(Value);}
+    /* Reported Value Stays Within Bucket Width Above The Exact One */
+    for(double Percent:{50.0,90.0,99.0,99.9})
+    {
+        const double Exact{Percent*10000.0};
+        const double Reported{static_cast<double>(Histogram.Percentile(Percent))};
+        EXPECT_GE(Reported,Exact);
+        EXPECT_LE(Reported,Exact*(1.0+1.0/64.0));
+    }
+    EXPECT_EQ(Histogram.Percentile(100),1000000);
+    /* Extreme Values Land In Last Bucket Without Overflow */
+    Histogram.Record(UINT64_MAX);
+    EXPECT_EQ(Histogram.Percentile(100),UINT64_MAX);
+}
+
+TEST_F(Latency_Histogram_Test,MERGE_AND_RESET)
+{
+    Data_Structure::Latency_Histogram First{};
+    Data_Structure::Latency_Histogram Second{};
+    for(uint64_t Value{};Value<50;Value++){First.Record(Value);}
+    for(uint64_t Value{50};Value<100;Value++){Second.Record(Value);}
+    First.Merge(Second);
+    EXPECT_EQ(First.Count(),100);
+    EXPECT_EQ(First.Min(),0);
+    EXPECT_EQ(First.Max(),99);
+    EXPECT_EQ(First.Percentile(50),49);
+    First.Reset();
+    EXPECT_EQ(First.Count(),0);
+    EXPECT_EQ(First.Percentile(50),0);
+}
+/********************************************************************
+ *  END OF FILE:  Latency_Histogram_Test.cpp
+********************************************************************/
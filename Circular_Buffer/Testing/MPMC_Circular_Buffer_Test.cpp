@@ -0,0 +1,164 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: MPMC_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For MPMC_Circular_Buffer Implementation
+ *  Class Name:  MPMC_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <thread>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Copies Throw On Request, Moves Never Throw */
+struct Throwing_Copy
+{
+    static inline bool Fail{};
+    explicit Throwing_Copy(int Value):m_Value{Value}{}
+    Throwing_Copy(const Throwing_Copy& Object):m_Value{Object.m_Value}
+    {
+        if(Fail){throw std::runtime_error("Copy Failed");}
+    }
+    Throwing_Copy(Throwing_Copy&&)noexcept=default;
+    Throwing_Copy& operator=(const Throwing_Copy&)=default;
+    Throwing_Copy& operator=(Throwing_Copy&&)noexcept=default;
+    int m_Value;
+};
+/*****************************************
+-----    MPMC_Circular_Buffer_Test     ----
+*****************************************/
+class MPMC_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(MPMC_Circular_Buffer_Test,TRY_PUSH_UNTIL_FULL)
+{
+    Data_Structure::MPMC_Circular_Buffer<int,5> Buffer{};
+    int Value{};
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+    EXPECT_EQ(Buffer.Try_Pop(Value),false);
+    for(int Counter{};Counter<5;Counter++)
+    {
+        EXPECT_EQ(Buffer.Try_Push(Counter),true);
+    }
+    EXPECT_EQ(Buffer.Try_Push(5),false);
+    EXPECT_EQ(Buffer.Size(),5);
+    for(int Counter{};Counter<5;Counter++)
+    {
+        EXPECT_EQ(Buffer.Try_Pop(Value),true);
+        EXPECT_EQ(Value,Counter);
+    }
+    EXPECT_EQ(Buffer.Try_Pop(Value),false);
+}
+
+TEST_F(MPMC_Circular_Buffer_Test,PUSH_POP_WRAP_AROUND)
+{
+    Data_Structure::MPMC_Circular_Buffer<int,3> Buffer{};
+    for(int Counter{};Counter<=10;Counter++)
+    {
+        Buffer.Push(Counter);
+        Buffer.Push(Counter+100);
+        EXPECT_EQ(Buffer.Pop(),Counter);
+        EXPECT_EQ(Buffer.Pop(),Counter+100);
+    }
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(MPMC_Circular_Buffer_Test,MULTI_PRODUCER_MULTI_CONSUMER)
+{
+    constexpr uint64_t THREADS{4};
+    constexpr uint64_t ELEMENTS_PER_THREAD{50000};
+    static Data_Structure::MPMC_Circular_Buffer<uint64_t,64> Buffer{};
+    std::vector<std::vector<uint64_t>> Received(THREADS);
+    std::vector<std::thread> Threads{};
+    for(uint64_t Thread{};Thread<THREADS;Thread++)
+    {
+        Threads.emplace_back([Thread]()
+        {
+            for(uint64_t Counter{};Counter<ELEMENTS_PER_THREAD;Counter++)
+            {
+                Buffer.Push(Thread*ELEMENTS_PER_THREAD+Counter);
+            }
+        });
+        Threads.emplace_back([Thread,&Received]()
+        {
+            for(uint64_t Counter{};Counter<ELEMENTS_PER_THREAD;Counter++)
+            {
+                Received[Thread].push_back(Buffer.Pop());
+            }
+        });
+    }
+    for(auto &Thread:Threads){Thread.join();}
+    /* Every Element Delivered Exactly Once */
+    std::vector<uint64_t> All{};
+    for(auto &Values:Received){All.insert(All.end(),Values.begin(),Values.end());}
+    std::sort(All.begin(),All.end());
+    ASSERT_EQ(All.size(),THREADS*ELEMENTS_PER_THREAD);
+    for(uint64_t Counter{};Counter<All.size();Counter++)
+    {
+        EXPECT_EQ(All[Counter],Counter);
+    }
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(MPMC_Circular_Buffer_Test,MOVE_ONLY_ELEMENTS)
+{
+    Data_Structure::MPMC_Circular_Buffer<std::unique_ptr<int>,2> Buffer{};
+    auto First{std::make_unique<int>(1)};
+    EXPECT_EQ(Buffer.Try_Push(std::move(First)),true);
+    Buffer.Push(std::make_unique<int>(2));
+    /* Full Buffer Leaves Element With Caller */
+    auto Third{std::make_unique<int>(3)};
+    EXPECT_EQ(Buffer.Try_Push(std::move(Third)),false);
+    ASSERT_NE(Third,nullptr);
+    std::unique_ptr<int> Value{};
+    EXPECT_EQ(Buffer.Try_Pop(Value),true);
+    EXPECT_EQ(*Value,1);
+    EXPECT_EQ(Buffer.Try_Push(std::move(Third)),true);
+    EXPECT_EQ(*Buffer.Pop(),2);
+    EXPECT_EQ(*Buffer.Pop(),3);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(MPMC_Circular_Buffer_Test,THROWING_COPY_KEEPS_QUEUE_USABLE)
+{
+    Data_Structure::MPMC_Circular_Buffer<Throwing_Copy,2> Buffer{};
+    const Throwing_Copy Element{1};
+    /* Failed Copy Claims No Slot "Next Ticket Is Still Free For Producers And Empty For Consumers" */
+    Throwing_Copy::Fail=true;
+    EXPECT_THROW(Buffer.Try_Push(Element),std::runtime_error);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+    EXPECT_EQ(Buffer.Try_Pop().has_value(),false);
+    Throwing_Copy::Fail=false;
+    /* Several Laps Pass Over The Slot The Failed Push Would Have Used */
+    for(int Counter{};Counter<5;Counter++)
+    {
+        EXPECT_EQ(Buffer.Try_Push(Element),true);
+        EXPECT_EQ(Buffer.Try_Push(Throwing_Copy{Counter}),true);
+        EXPECT_EQ(Buffer.Try_Push(Element),false);
+        EXPECT_EQ(Buffer.Pop().m_Value,1);
+        Throwing_Copy Value{-1};
+        EXPECT_EQ(Buffer.Try_Pop(Value),true);
+        EXPECT_EQ(Value.m_Value,Counter);
+    }
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+/********************************************************************
+ *  END OF FILE:  MPMC_Circular_Buffer_Test.cpp
+********************************************************************/
@@ -0,0 +1,93 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Mirrored_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Mirrored_Circular_Buffer Implementation
+ *  Class Name:  Mirrored_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Mirrored_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <string_view>
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+#include <string>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/*****************************************
+---    Mirrored_Circular_Buffer_Test     --
+*****************************************/
+class Mirrored_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Mirrored_Circular_Buffer_Test,CAPACITY_ROUNDED_TO_PAGE)
+{
+    Data_Structure::Mirrored_Circular_Buffer Buffer{100};
+    EXPECT_GE(Buffer.Capacity(),100);
+    EXPECT_EQ(Buffer.Capacity()%4096,0);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+    EXPECT_THROW(Buffer.Pop(),std::runtime_error);
+}
+
+TEST_F(Mirrored_Circular_Buffer_Test,PUSH_POP_OVERWRITE)
+{
+    Data_Structure::Mirrored_Circular_Buffer Buffer{1};
+    const size_t Capacity{Buffer.Capacity()};
+    for(size_t Counter{};Counter<Capacity+3;Counter++)
+    {
+        Buffer.Push(static_cast<uint8_t>(Counter));
+    }
+    EXPECT_EQ(Buffer.Size(),Capacity);
+    EXPECT_EQ(Buffer.Head(),static_cast<uint8_t>(3));
+    EXPECT_EQ(Buffer.Pop(),static_cast<uint8_t>(3));
+    EXPECT_EQ(Buffer.Size(),Capacity-1);
+}
+
+TEST_F(Mirrored_Circular_Buffer_Test,READABLE_SPAN_CONTIGUOUS_ACROSS_WRAP)
+{
+    Data_Structure::Mirrored_Circular_Buffer Buffer{1};
+    const size_t Capacity{Buffer.Capacity()};
+    /* Move Head Close To The End Of The First View */
+    std::vector<uint8_t> Filler(Capacity-4,'.');
+    EXPECT_EQ(Buffer.Push_N(Filler),Filler.size());
+    Buffer.Commit_Read(Filler.size());
+    /* Frame Straddles The Wrap Point */
+    const std::string Frame{"LINE ONE\nLINE TWO\n"};
+    auto Writable=Buffer.Writable_Span();
+    EXPECT_EQ(Writable.size(),Capacity);
+    std::copy(Frame.begin(),Frame.end(),Writable.begin());
+    Buffer.Commit_Write(Frame.size());
+    /* Parser Sees One Contiguous Range */
+    auto Readable=Buffer.Readable_Span();
+    std::string_view View(reinterpret_cast<const char*>(Readable.data()),Readable.size());
+    EXPECT_EQ(View,Frame);
+    EXPECT_EQ(View.substr(0,View.find('\n')),"LINE ONE");
+    EXPECT_EQ(Buffer.Readable_Spans()[1].size(),0);
+    /* Second View Aliases The First */
+    std::vector<uint8_t> Output(Frame.size());
+    EXPECT_EQ(Buffer.Pop_N(Output),Frame.size());
+    EXPECT_EQ(std::string(Output.begin(),Output.end()),Frame);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(Mirrored_Circular_Buffer_Test,COMMIT_OUT_OF_RANGE)
+{
+    Data_Structure::Mirrored_Circular_Buffer Buffer{1};
+    EXPECT_THROW(Buffer.Commit_Read(1),std::runtime_error);
+    EXPECT_THROW(Buffer.Commit_Write(Buffer.Capacity()+1),std::runtime_error);
+}
+/********************************************************************
+ *  END OF FILE:  Mirrored_Circular_Buffer_Test.cpp
+********************************************************************/
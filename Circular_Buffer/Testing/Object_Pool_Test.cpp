@@ -0,0 +1,170 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Object_Pool_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Object_Pool Implementation
+ *  Class Name:  Object_Pool_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Object_Pool.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Object_Pool;
+using Data_Structure::Pool_Concurrency;
+using Data_Structure::Pool_Handle;
+/* Counts Live Instances And Throws On Request */
+struct Pooled_Object
+{
+    static inline int Live{};
+    explicit Pooled_Object(int Value):m_Value{Value}
+    {
+        if(Value<0){throw std::runtime_error("Negative Value");}
+        Live++;
+    }
+    ~Pooled_Object(){Live--;}
+    int m_Value;
+};
+/* Message Passed Between Threads By Handle */
+struct Message
+{
+    uint64_t m_Sequence;
+    uint64_t m_Payload[7];
+};
+/*****************************************
+---------    Object_Pool_Test     --------
+*****************************************/
+class Object_Pool_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Object_Pool_Test,ACQUIRE_RELEASE_AND_STALE_HANDLES)
+{
+    Object_Pool<std::string,4> Pool{};
+    EXPECT_EQ(Pool.Available(),4);
+    std::vector<Pool_Handle> Handles{};
+    for(int Counter{};Counter<4;Counter++)
+    {
+        const auto Handle{Pool.Acquire(std::to_string(Counter))};
+        ASSERT_TRUE(Handle.has_value());
+        Handles.push_back(*Handle);
+    }
+    EXPECT_FALSE(Pool.Acquire("x").has_value());
+    EXPECT_EQ(Pool.Available(),0);
+    EXPECT_EQ(*Pool.Get(Handles[2]),"2");
+    /* Objects Are Contiguous In Slot Order */
+    EXPECT_EQ(Pool.Get(Handles[1])-Pool.Get(Handles[0]),1);
+    Pool.Release(Handles[1]);
+    EXPECT_EQ(Pool.Get(Handles[1]),nullptr);
+    EXPECT_FALSE(Pool.Is_Live(Handles[1]));
+    EXPECT_THROW(Pool.Release(Handles[1]),std::runtime_error);
+    EXPECT_THROW(Pool.Release(Pool_Handle{}),std::runtime_error);
+    EXPECT_THROW(Pool.Release(Pool_Handle{9,1}),std::runtime_error);
+    /* Same Slot Comes Back With A New Generation, Old Handle Stays Stale */
+    const auto Reused{Pool.Acquire("reused")};
+    ASSERT_TRUE(Reused.has_value());
+    EXPECT_EQ(Reused->m_Index,Handles[1].m_Index);
+    EXPECT_NE(Reused->m_Generation,Handles[1].m_Generation);
+    EXPECT_EQ(Pool.Get(Handles[1]),nullptr);
+    EXPECT_EQ(*Pool.Get(*Reused),"reused");
+}
+
+TEST_F(Object_Pool_Test,DESTRUCTOR_AND_THROWING_CONSTRUCTOR)
+{
+    Pooled_Object::Live=0;
+    {
+        Object_Pool<Pooled_Object,3> Pool{};
+        const auto First{Pool.Acquire(1)};
+        const auto Second{Pool.Acquire(2)};
+        EXPECT_EQ(Pooled_Object::Live,2);
+        /* Failed Construction Gives The Slot Back */
+        EXPECT_THROW(Pool.Acquire(-1),std::runtime_error);
+        EXPECT_EQ(Pool.Available(),1);
+        Pool.Release(*First);
+        EXPECT_EQ(Pooled_Object::Live,1);
+        EXPECT_EQ(Pool.Get(*Second)->m_Value,2);
+    }
+    /* Pool Destroys What Was Never Released */
+    EXPECT_EQ(Pooled_Object::Live,0);
+}
+
+TEST_F(Object_Pool_Test,LOCK_FREE_CONTENDED_ACQUIRE_RELEASE)
+{
+    constexpr int THREADS{4};
+    constexpr int ROUNDS{20000};
+    Object_Pool<uint64_t,8,Pool_Concurrency::Lock_Free> Pool{};
+    std::atomic<bool> Exclusive{true};
+    std::vector<std::thread> Threads{};
+    for(int Thread{};Thread<THREADS;Thread++)
+    {
+        Threads.emplace_back([&,Thread]
+        {
+            for(int Round{};Round<ROUNDS;Round++)
+            {
+                std::optional<Pool_Handle> Handle{};
+                while(!(Handle=Pool.Acquire(0U))){std::this_thread::yield();}
+                /* No Other Thread May Touch A Slot It Did Not Acquire */
+                const uint64_t Stamp{(static_cast<uint64_t>(Thread)<<32)|static_cast<uint64_t>(Round)};
+                *Pool.Get(*Handle)=Stamp;
+                std::this_thread::yield();
+                if(*Pool.Get(*Handle)!=Stamp){Exclusive=false;}
+                Pool.Release(*Handle);
+            }
+        });
+    }
+    for(auto& Thread:Threads){Thread.join();}
+    EXPECT_TRUE(Exclusive);
+    EXPECT_EQ(Pool.Available(),8);
+}
+
+TEST_F(Object_Pool_Test,LOCK_FREE_HANDLES_THROUGH_SPSC_BUFFER)
+{
+    constexpr uint64_t MESSAGES{50000};
+    Object_Pool<Message,32,Pool_Concurrency::Lock_Free> Pool{};
+    Data_Structure::SPSC_Circular_Buffer<Pool_Handle,16> Queue{};
+    bool Intact{true};
+    std::thread Consumer{[&]
+    {
+        for(uint64_t Counter{};Counter<MESSAGES;Counter++)
+        {
+            Pool_Handle Handle{};
+            while(!Queue.Pop(Handle)){std::this_thread::yield();}
+            const Message* Received{Pool.Get(Handle)};
+            Intact&=(Received!=nullptr&&Received->m_Sequence==Counter&&Received->m_Payload[6]==Counter*7);
+            Pool.Release(Handle);
+        }
+    }};
+    for(uint64_t Counter{};Counter<MESSAGES;Counter++)
+    {
+        std::optional<Pool_Handle> Handle{};
+        while(!(Handle=Pool.Acquire())){std::this_thread::yield();}
+        Message& Sent{*Pool.Get(*Handle)};
+        Sent.m_Sequence=Counter;
+        for(uint64_t Index{};Index<7;Index++){Sent.m_Payload[Index]=Counter*(Index+1);}
+        while(!Queue.Push(*Handle)){std::this_thread::yield();}
+    }
+    Consumer.join();
+    EXPECT_TRUE(Intact);
+    EXPECT_EQ(Pool.Available(),32);
+}
+/********************************************************************
+ *  END OF FILE:  Object_Pool_Test.cpp
+********************************************************************/
@@ -0,0 +1,192 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Persistent_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Persistent_Circular_Buffer Implementation
+ *  Class Name:  Persistent_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Persistent_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Persistent_Circular_Buffer;
+using Record_List=std::vector<std::pair<uint64_t,std::vector<uint8_t>>>;
+/* Payload Derived From The Sequence So Every Record Can Be Checked Alone */
+static std::vector<uint8_t> Make_Record(uint64_t Sequence,size_t Length)
+{
+    std::vector<uint8_t> Record(Length);
+    for(size_t Index{};Index<Length;Index++){Record[Index]=static_cast<uint8_t>(Sequence*31+Index);}
+    return Record;
+}
+static Record_List Read_All(const Persistent_Circular_Buffer& Buffer)
+{
+    Record_List Records{};
+    Buffer.For_Each([&Records](uint64_t Sequence,std::span<const uint8_t> Record)
+    {
+        Records.emplace_back(Sequence,std::vector<uint8_t>(Record.begin(),Record.end()));
+    });
+    return Records;
+}
+/*****************************************
+--    Persistent_Circular_Buffer_Test     --
+*****************************************/
+class Persistent_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override
+    {
+        m_Path="/tmp/Persistent_Circular_Buffer_Test_"+std::to_string(getpid())+"_"+testing::UnitTest::GetInstance()->current_test_info()->name()+".log";
+        unlink(m_Path.c_str());
+    }
+    void TearDown()override{unlink(m_Path.c_str());}
+protected:
+    /* Flips One Byte Of Record Storage Behind The Mapping's Back */
+    void Corrupt(size_t Offset)
+    {
+        const int File_Descriptor{open(m_Path.c_str(),O_RDWR)};
+        ASSERT_GE(File_Descriptor,0);
+        const off_t Position{static_cast<off_t>(Persistent_Circular_Buffer::HEADER_SIZE+Offset)};
+        uint8_t Byte{};
+        ASSERT_EQ(pread(File_Descriptor,&Byte,1,Position),1);
+        Byte^=0x5A;
+        ASSERT_EQ(pwrite(File_Descriptor,&Byte,1,Position),1);
+        close(File_Descriptor);
+    }
+    std::string m_Path;
+};
+
+TEST_F(Persistent_Circular_Buffer_Test,APPEND_ITERATE_AND_EVICT)
+{
+    Persistent_Circular_Buffer Buffer{m_Path,1024};
+    EXPECT_TRUE(Buffer.Is_Empty());
+    EXPECT_EQ(Buffer.Next_Sequence(),1);
+    for(uint64_t Sequence{1};Sequence<=100;Sequence++)
+    {
+        const auto Record{Make_Record(Sequence,40)};
+        EXPECT_EQ(Buffer.Append(Record),Sequence);
+    }
+    /* Forty Byte Payloads Take Fifty Six Bytes, Eighteen Fit In One Lap */
+    const Record_List Records{Read_All(Buffer)};
+    ASSERT_EQ(Records.size(),Buffer.Size());
+    EXPECT_GE(Records.size(),17);
+    EXPECT_LE(Records.size(),18);
+    EXPECT_EQ(Records.back().first,100);
+    EXPECT_EQ(Buffer.First_Sequence(),Records.front().first);
+    for(size_t Index{};Index<Records.size();Index++)
+    {
+        EXPECT_EQ(Records[Index].first,Records.front().first+Index);
+        EXPECT_EQ(Records[Index].second,Make_Record(Records[Index].first,40));
+    }
+    /* Batch Gets Consecutive Sequences */
+    const auto First{Make_Record(101,0)};
+    const auto Second{Make_Record(102,7)};
+    const std::span<const uint8_t> Batch[]{First,Second};
+    EXPECT_EQ(Buffer.Append_N(Batch),101);
+    EXPECT_EQ(Buffer.Next_Sequence(),103);
+    EXPECT_EQ(Read_All(Buffer).back().second,Second);
+}
+
+TEST_F(Persistent_Circular_Buffer_Test,REOPEN_RECOVERS_EVERY_STATE)
+{
+    /* Mixed Lengths Walk The Append Position Through Every Wrap Case */
+    for(uint64_t Count{};Count<90;Count++)
+    {
+        Record_List Expected{};
+        {
+            Persistent_Circular_Buffer Buffer{m_Path,512,{Data_Structure::Sync_Mode::Manual}};
+            for(uint64_t Sequence{1};Sequence<=Count;Sequence++){Buffer.Append(Make_Record(Sequence,(Sequence*7)%50));}
+            Expected=Read_All(Buffer);
+        }
+        Persistent_Circular_Buffer Buffer{m_Path,512};
+        ASSERT_EQ(Read_All(Buffer),Expected)<<"After "<<Count<<" Records";
+        ASSERT_EQ(Buffer.Next_Sequence(),Count+1);
+        /* Reopened Log Keeps Appending Where It Left Off */
+        EXPECT_EQ(Buffer.Append(Make_Record(Count+1,3)),Count+1);
+        unlink(m_Path.c_str());
+    }
+}
+
+TEST_F(Persistent_Circular_Buffer_Test,TORN_RECORD_IS_DROPPED)
+{
+    {
+        Persistent_Circular_Buffer Buffer{m_Path,1024};
+        for(uint64_t Sequence{1};Sequence<=10;Sequence++){Buffer.Append(Make_Record(Sequence,40));}
+    }
+    /* Damage The Payload Of The Newest Record */
+    Corrupt(9*56+20);
+    {
+        Persistent_Circular_Buffer Buffer{m_Path,1024};
+        EXPECT_EQ(Buffer.Size(),9);
+        EXPECT_EQ(Buffer.Next_Sequence(),10);
+        EXPECT_EQ(Buffer.Append(Make_Record(10,40)),10);
+        /* Second Lap, Records Nineteen To Twenty Five Overwrote One To Seven */
+        for(uint64_t Sequence{11};Sequence<=25;Sequence++){Buffer.Append(Make_Record(Sequence,40));}
+        EXPECT_EQ(Buffer.First_Sequence(),8);
+    }
+    /* Damage The First Record After The Wrap, Everything Newer Goes With It */
+    Corrupt(3);
+    Persistent_Circular_Buffer Buffer{m_Path,1024};
+    const Record_List Records{Read_All(Buffer)};
+    ASSERT_EQ(Records.size(),11);
+    EXPECT_EQ(Records.front().first,8);
+    EXPECT_EQ(Records.back().first,18);
+    EXPECT_EQ(Buffer.Next_Sequence(),19);
+    EXPECT_EQ(Records[4].second,Make_Record(12,40));
+}
+
+TEST_F(Persistent_Circular_Buffer_Test,PROCESS_CRASH_KEEPS_RECORDS)
+{
+    const pid_t Child{fork()};
+    ASSERT_GE(Child,0);
+    if(Child==0)
+    {
+        /* Never Synced And Never Destroyed, Pages Live On In The Page Cache */
+        auto *Buffer{new Persistent_Circular_Buffer{m_Path,4096,{Data_Structure::Sync_Mode::Manual}}};
+        for(uint64_t Sequence{1};Sequence<=50;Sequence++){Buffer->Append(Make_Record(Sequence,24));}
+        _exit(0);
+    }
+    int Status{};
+    ASSERT_EQ(waitpid(Child,&Status,0),Child);
+    ASSERT_TRUE(WIFEXITED(Status));
+    Persistent_Circular_Buffer Buffer{m_Path,4096};
+    const Record_List Records{Read_All(Buffer)};
+    ASSERT_EQ(Records.size(),50);
+    for(uint64_t Index{};Index<50;Index++){EXPECT_EQ(Records[Index].second,Make_Record(Index+1,24));}
+}
+
+TEST_F(Persistent_Circular_Buffer_Test,POLICIES_AND_INVALID_USE)
+{
+    {
+        Persistent_Circular_Buffer Buffer{m_Path,256,{Data_Structure::Sync_Mode::Periodic,std::chrono::milliseconds{0}}};
+        EXPECT_THROW(Buffer.Append(std::vector<uint8_t>(241)),std::runtime_error);
+        EXPECT_EQ(Buffer.Append(std::vector<uint8_t>(240)),1);
+        EXPECT_EQ(Buffer.Size(),1);
+        Buffer.Flush();
+    }
+    EXPECT_THROW((Persistent_Circular_Buffer{m_Path,512}),std::runtime_error);
+    Persistent_Circular_Buffer Buffer{m_Path,256,{Data_Structure::Sync_Mode::Per_Batch}};
+    EXPECT_EQ(Buffer.Size(),1);
+    EXPECT_EQ(Buffer.Append(Make_Record(2,8)),2);
+    /* Large Record Evicted The Only Other One */
+    EXPECT_EQ(Buffer.Size(),1);
+    EXPECT_EQ(Buffer.First_Sequence(),2);
+}
+/********************************************************************
+ *  END OF FILE:  Persistent_Circular_Buffer_Test.cpp
+********************************************************************/
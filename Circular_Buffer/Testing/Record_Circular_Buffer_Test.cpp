@@ -0,0 +1,181 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Record_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Record_Circular_Buffer Implementation
+ *  Class Name:  Record_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Record_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Record_Circular_Buffer;
+/* Payload Derived From The Sequence So Every Record Can Be Checked Alone */
+static std::vector<uint8_t> Make_Record(uint64_t Sequence,size_t Length)
+{
+    std::vector<uint8_t> Record(Length);
+    for(size_t Index{};Index<Length;Index++){Record[Index]=static_cast<uint8_t>(Sequence*31+Index);}
+    return Record;
+}
+static bool Matches(std::span<const uint8_t> Record,uint64_t Sequence,size_t Length)
+{
+    const auto Expected{Make_Record(Sequence,Length)};
+    return std::equal(Record.begin(),Record.end(),Expected.begin(),Expected.end());
+}
+/*****************************************
+---    Record_Circular_Buffer_Test     ---
+*****************************************/
+class Record_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Record_Circular_Buffer_Test,RESERVE_COMMIT_PEEK_RELEASE)
+{
+    Record_Circular_Buffer<64> Buffer{};
+    EXPECT_TRUE(Buffer.Is_Empty());
+    EXPECT_FALSE(Buffer.Peek().has_value());
+    auto Room{Buffer.Reserve(20)};
+    ASSERT_TRUE(Room.has_value());
+    EXPECT_EQ(Room->size(),20);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(Room->data())%8,0);
+    /* Nothing Visible Before Commit */
+    EXPECT_FALSE(Buffer.Peek().has_value());
+    EXPECT_THROW(Buffer.Reserve(4),std::runtime_error);
+    EXPECT_THROW(Buffer.Commit(21),std::runtime_error);
+    const auto Record{Make_Record(1,5)};
+    std::copy(Record.begin(),Record.end(),Room->begin());
+    /* Trimmed Record Only Takes Header Plus Eight Bytes */
+    Buffer.Commit(5);
+    EXPECT_EQ(Buffer.Used_Bytes(),16);
+    EXPECT_THROW(Buffer.Commit(),std::runtime_error);
+    auto View{Buffer.Peek()};
+    ASSERT_TRUE(View.has_value());
+    EXPECT_TRUE(Matches(*View,1,5));
+    /* Peek Again Returns The Same Record In Place */
+    EXPECT_EQ(Buffer.Peek()->data(),View->data());
+    Buffer.Release();
+    EXPECT_THROW(Buffer.Release(),std::runtime_error);
+    EXPECT_TRUE(Buffer.Is_Empty());
+    /* Empty Records Are Still Records */
+    EXPECT_TRUE(Buffer.Push({}));
+    ASSERT_TRUE(Buffer.Peek().has_value());
+    EXPECT_TRUE(Buffer.Peek()->empty());
+    Buffer.Release();
+    EXPECT_THROW(Buffer.Reserve(57),std::runtime_error);
+    /* Record Ending Exactly At The Storage End Needs No Marker */
+    EXPECT_TRUE(Buffer.Reserve(32).has_value());
+    Buffer.Commit();
+    EXPECT_EQ(Buffer.Used_Bytes(),40);
+}
+
+TEST_F(Record_Circular_Buffer_Test,WRAP_MARKER_FREES_TAIL_BYTES)
+{
+    Record_Circular_Buffer<64> Buffer{};
+    ASSERT_TRUE(Buffer.Push(Make_Record(1,30)));
+    ASSERT_TRUE(Buffer.Peek().has_value());
+    Buffer.Release();
+    /* Full Size Record Must Start At Offset Zero, Skipped Bytes Are Still Held By The Marker */
+    EXPECT_FALSE(Buffer.Reserve(56).has_value());
+    EXPECT_EQ(Buffer.Used_Bytes(),24);
+    /* Consumer Steps Over The Marker And Finds Nothing Else */
+    EXPECT_FALSE(Buffer.Peek().has_value());
+    EXPECT_TRUE(Buffer.Is_Empty());
+    auto Room{Buffer.Reserve(56)};
+    ASSERT_TRUE(Room.has_value());
+    const auto Record{Make_Record(2,56)};
+    std::copy(Record.begin(),Record.end(),Room->begin());
+    Buffer.Commit();
+    EXPECT_EQ(Buffer.Used_Bytes(),64);
+    EXPECT_FALSE(Buffer.Push(Make_Record(3,0)));
+    ASSERT_TRUE(Buffer.Peek().has_value());
+    EXPECT_TRUE(Matches(*Buffer.Peek(),2,56));
+}
+
+TEST_F(Record_Circular_Buffer_Test,MIXED_SIZES_KEEP_ORDER)
+{
+    Record_Circular_Buffer<256> Buffer{};
+    std::deque<std::pair<uint64_t,size_t>> Pending{};
+    uint64_t Next_Push{};
+    uint64_t Popped{};
+    /* Uneven Push And Pop Rhythm Lands Records On Every Offset */
+    for(uint64_t Round{};Round<5000;Round++)
+    {
+        const size_t Length{static_cast<size_t>((Next_Push*37)%120)};
+        if(Buffer.Push(Make_Record(Next_Push,Length))){Pending.emplace_back(Next_Push++,Length);}
+        if(Round%3!=0)
+        {
+            const auto View{Buffer.Peek()};
+            if(View)
+            {
+                ASSERT_FALSE(Pending.empty());
+                ASSERT_EQ(View->size(),Pending.front().second);
+                ASSERT_TRUE(Matches(*View,Pending.front().first,Pending.front().second));
+                Buffer.Release();
+                Pending.pop_front();
+                Popped++;
+            }
+        }
+    }
+    EXPECT_GT(Popped,1000);
+    while(auto View{Buffer.Peek()})
+    {
+        ASSERT_TRUE(Matches(*View,Pending.front().first,Pending.front().second));
+        Buffer.Release();
+        Pending.pop_front();
+    }
+    EXPECT_TRUE(Pending.empty());
+    EXPECT_TRUE(Buffer.Is_Empty());
+}
+
+TEST_F(Record_Circular_Buffer_Test,PRODUCER_CONSUMER_THREADS)
+{
+    constexpr uint64_t RECORDS{100000};
+    static Record_Circular_Buffer<16384> Buffer{};
+    std::thread Producer{[]
+    {
+        for(uint64_t Sequence{};Sequence<RECORDS;Sequence++)
+        {
+            /* Eight Bytes Up To Four Kilobytes */
+            const size_t Length{8+static_cast<size_t>((Sequence*2654435761u)%4089)};
+            std::optional<std::span<uint8_t>> Room{};
+            while(!(Room=Buffer.Reserve(Length))){std::this_thread::yield();}
+            for(size_t Index{};Index<Length;Index++){(*Room)[Index]=static_cast<uint8_t>(Sequence*31+Index);}
+            Buffer.Commit();
+        }
+    }};
+    bool Intact{true};
+    for(uint64_t Sequence{};Sequence<RECORDS;Sequence++)
+    {
+        std::optional<std::span<const uint8_t>> View{};
+        while(!(View=Buffer.Peek())){std::this_thread::yield();}
+        const size_t Length{8+static_cast<size_t>((Sequence*2654435761u)%4089)};
+        Intact&=(View->size()==Length);
+        Intact&=((*View)[0]==static_cast<uint8_t>(Sequence*31));
+        Intact&=((*View)[Length-1]==static_cast<uint8_t>(Sequence*31+Length-1));
+        Buffer.Release();
+    }
+    Producer.join();
+    EXPECT_TRUE(Intact);
+    EXPECT_TRUE(Buffer.Is_Empty());
+}
+/********************************************************************
+ *  END OF FILE:  Record_Circular_Buffer_Test.cpp
+********************************************************************/
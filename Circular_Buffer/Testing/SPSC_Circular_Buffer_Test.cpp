@@ -0,0 +1,149 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: SPSC_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For SPSC_Circular_Buffer Implementation
+ *  Class Name:  SPSC_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <cstdint>
+#include <memory>
+#include <thread>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/*****************************************
+-----    SPSC_Circular_Buffer_Test     ----
+*****************************************/
+class SPSC_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(SPSC_Circular_Buffer_Test,PUSH_UNTIL_FULL)
+{
+    Data_Structure::SPSC_Circular_Buffer<int,5> Buffer{};
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+    for(int Counter{};Counter<5;Counter++)
+    {
+        EXPECT_EQ(Buffer.Push(Counter),true);
+    }
+    /* Full Buffer Rejects Instead Of Overwriting */
+    EXPECT_EQ(Buffer.Push(5),false);
+    EXPECT_EQ(Buffer.Size(),5);
+    for(int Counter{};Counter<5;Counter++)
+    {
+        EXPECT_EQ(Buffer.Pop(),Counter);
+    }
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(SPSC_Circular_Buffer_Test,PUSH_POP_WRAP_AROUND)
+{
+    Data_Structure::SPSC_Circular_Buffer<int,3> Buffer{};
+    for(int Counter{};Counter<=10;Counter++)
+    {
+        EXPECT_EQ(Buffer.Push(Counter),true);
+        EXPECT_EQ(Buffer.Push(Counter+100),true);
+        EXPECT_EQ(Buffer.Size(),2);
+        EXPECT_EQ(Buffer.Pop(),Counter);
+        EXPECT_EQ(Buffer.Pop(),Counter+100);
+    }
+    EXPECT_EQ(Buffer.Size(),0);
+}
+
+TEST_F(SPSC_Circular_Buffer_Test,EXPECT_THROW)
+{
+    Data_Structure::SPSC_Circular_Buffer<int,5> Buffer{};
+    int Value{};
+    EXPECT_EQ(Buffer.Pop(Value),false);
+    EXPECT_THROW(Buffer.Pop(),std::runtime_error);
+}
+
+TEST_F(SPSC_Circular_Buffer_Test,NO_FALSE_SHARING_LAYOUT)
+{
+    using Buffer_Type=Data_Structure::SPSC_Circular_Buffer<char,3>;
+    EXPECT_EQ(alignof(Buffer_Type)%Data_Structure::CACHE_LINE_SIZE,0);
+    /* Head Line + Tail Line + Data Line */
+    EXPECT_GE(sizeof(Buffer_Type),3*Data_Structure::CACHE_LINE_SIZE);
+}
+
+TEST_F(SPSC_Circular_Buffer_Test,CROSS_THREAD_TRANSFER)
+{
+    constexpr uint64_t TOTAL_ELEMENTS{1000000};
+    /* Throughput Is Measured By SPSC_Circular_Buffer_Benchmark, This Only Checks Delivery */
+    Data_Structure::SPSC_Circular_Buffer<uint64_t,1024> Buffer{};
+    uint64_t Sum{},Errors{};
+    std::thread Consumer([&Buffer,&Sum,&Errors]()
+    {
+        uint64_t Value{};
+        for(uint64_t Expected{};Expected<TOTAL_ELEMENTS;)
+        {
+            if(Buffer.Pop(Value))
+            {
+                /* Elements Must Arrive In Order */
+                Errors+=(Value!=Expected);
+                Sum+=Value;
+                Expected++;
+            }
+            else{std::this_thread::yield();}
+        }
+    });
+    std::thread Producer([&Buffer]()
+    {
+        for(uint64_t Counter{};Counter<TOTAL_ELEMENTS;)
+        {
+            if(Buffer.Push(Counter)){Counter++;}
+            else{std::this_thread::yield();}
+        }
+    });
+    Producer.join();
+    Consumer.join();
+    EXPECT_EQ(Errors,0);
+    EXPECT_EQ(Sum,TOTAL_ELEMENTS*(TOTAL_ELEMENTS-1)/2);
+    EXPECT_EQ(Buffer.Is_Empty(),true);
+}
+
+TEST_F(SPSC_Circular_Buffer_Test,MOVE_ONLY_AND_LIVE_SLOTS)
+{
+    Data_Structure::SPSC_Circular_Buffer<std::unique_ptr<int>,2> Buffer{};
+    EXPECT_EQ(Buffer.Push(std::make_unique<int>(1)),true);
+    EXPECT_EQ(Buffer.Push(std::make_unique<int>(2)),true);
+    /* Full Buffer Leaves Element With Caller */
+    auto Third{std::make_unique<int>(3)};
+    EXPECT_EQ(Buffer.Push(std::move(Third)),false);
+    ASSERT_NE(Third,nullptr);
+    EXPECT_EQ(*Buffer.Pop(),1);
+    std::unique_ptr<int> Value{};
+    EXPECT_EQ(Buffer.Pop(Value),true);
+    EXPECT_EQ(*Value,2);
+    EXPECT_EQ(Buffer.Pop(Value),false);
+    /* Popped Element Does Not Linger In Its Slot */
+    auto Shared{std::make_shared<int>(4)};
+    Data_Structure::SPSC_Circular_Buffer<std::shared_ptr<int>,2> Holder{};
+    EXPECT_EQ(Holder.Push(Shared),true);
+    EXPECT_EQ(Shared.use_count(),2);
+    Holder.Pop();
+    EXPECT_EQ(Shared.use_count(),1);
+    /* Elements Still Held Are Destroyed With The Buffer */
+    {
+        Data_Structure::SPSC_Circular_Buffer<std::shared_ptr<int>,2> Scoped{};
+        Scoped.Push(Shared);
+        EXPECT_EQ(Shared.use_count(),2);
+    }
+    EXPECT_EQ(Shared.use_count(),1);
+}
+/********************************************************************
+ *  END OF FILE:  SPSC_Circular_Buffer_Test.cpp
+********************************************************************/
@@ -0,0 +1,156 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Sequenced_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Sequenced_Circular_Buffer Implementation
+ *  Class Name:  Sequenced_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Sequenced_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Event Shared By Every Stage, First Stage Fills Doubled For The Last One */
+struct Pipeline_Event
+{
+    uint64_t Value{};
+    uint64_t Doubled{};
+};
+/*****************************************
+--    Sequenced_Circular_Buffer_Test     --
+*****************************************/
+class Sequenced_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Sequenced_Circular_Buffer_Test,BATCH_CLAIM_PUBLISH)
+{
+    Data_Structure::Sequenced_Circular_Buffer<int,8> Buffer{};
+    auto &First{Buffer.Add_Consumer()};
+    auto &Second{Buffer.Add_Consumer()};
+    const auto Range{Buffer.Claim(4)};
+    EXPECT_EQ(Range.m_First,0);
+    EXPECT_EQ(Range.m_Count,4);
+    for(uint64_t Sequence{Range.m_First};Sequence<Range.m_First+Range.m_Count;Sequence++){Buffer[Sequence]=static_cast<int>(Sequence*10);}
+    /* Nothing Is Visible Before Publish */
+    EXPECT_EQ(First.Available(),0);
+    Buffer.Publish(Range);
+    EXPECT_EQ(First.Available(),4);
+    /* Both Stages Read The Same Slots In Place */
+    int Sum{};
+    EXPECT_EQ(First.Try_Process([&Sum](int& Element,uint64_t){Sum+=Element;}),4);
+    EXPECT_EQ(Second.Try_Process([&Sum](int& Element,uint64_t){Sum+=Element;},3),3);
+    EXPECT_EQ(Sum,90);
+    EXPECT_EQ(First.Cursor(),4);
+    EXPECT_EQ(Second.Cursor(),3);
+    /* Slowest Stage Holds Slot 3, Only Seven More Fit */
+    EXPECT_TRUE(Buffer.Try_Claim(4).has_value());
+    EXPECT_FALSE(Buffer.Try_Claim(4).has_value());
+    EXPECT_TRUE(Buffer.Try_Claim(3).has_value());
+    EXPECT_FALSE(Buffer.Try_Claim(1).has_value());
+    EXPECT_EQ(Second.Try_Process([](int&,uint64_t){}),1);
+    EXPECT_TRUE(Buffer.Try_Claim(1).has_value());
+}
+
+TEST_F(Sequenced_Circular_Buffer_Test,DEPENDENCY_GATING)
+{
+    Data_Structure::Sequenced_Circular_Buffer<int,4> Buffer{};
+    auto &Journal{Buffer.Add_Consumer()};
+    auto &Replicate{Buffer.Add_Consumer()};
+    auto &Business{Buffer.Add_Consumer({&Journal,&Replicate})};
+    for(int Counter{};Counter<3;Counter++){Buffer.Push(Counter);}
+    EXPECT_EQ(Buffer.Published(),3);
+    EXPECT_EQ(Business.Available(),0);
+    EXPECT_EQ(Journal.Try_Process([](int&,uint64_t){}),3);
+    EXPECT_EQ(Business.Available(),0);
+    EXPECT_EQ(Replicate.Try_Process([](int&,uint64_t){},2),2);
+    EXPECT_EQ(Business.Available(),2);
+    EXPECT_EQ(Replicate.Try_Process([](int&,uint64_t){}),1);
+    uint64_t Expected{};
+    EXPECT_EQ(Business.Try_Process([&Expected](int& Element,uint64_t Sequence)
+    {
+        EXPECT_EQ(Sequence,Expected);
+        EXPECT_EQ(Element,static_cast<int>(Expected));
+        Expected++;
+    }),3);
+    /* Producer Waits For Last Stage Only, It Is Behind Every Other Stage */
+    EXPECT_TRUE(Buffer.Try_Claim(4).has_value());
+}
+
+TEST_F(Sequenced_Circular_Buffer_Test,INVALID_USE)
+{
+    Data_Structure::Sequenced_Circular_Buffer<int,4> Buffer{};
+    Data_Structure::Sequenced_Circular_Buffer<int,4> Other{};
+    auto &Foreign{Other.Add_Consumer()};
+    EXPECT_THROW(Buffer.Add_Consumer({&Foreign}),std::runtime_error);
+    EXPECT_THROW(Buffer.Claim(0),std::runtime_error);
+    EXPECT_THROW(Buffer.Claim(5),std::runtime_error);
+    const auto First{Buffer.Claim(1)};
+    const auto Second{Buffer.Claim(1)};
+    EXPECT_THROW(Buffer.Publish(Second),std::runtime_error);
+    EXPECT_THROW(Buffer.Add_Consumer(),std::runtime_error);
+    Buffer.Publish(First);
+    Buffer.Publish(Second);
+    EXPECT_EQ(Buffer.Published(),2);
+}
+
+TEST_F(Sequenced_Circular_Buffer_Test,PIPELINE_THREADS)
+{
+    constexpr uint64_t ELEMENTS{100000};
+    Data_Structure::Sequenced_Circular_Buffer<Pipeline_Event,64> Buffer{};
+    auto &Doubler{Buffer.Add_Consumer()};
+    auto &Summer{Buffer.Add_Consumer()};
+    auto &Checker{Buffer.Add_Consumer({&Doubler,&Summer})};
+    uint64_t Sum{};
+    uint64_t Checked{};
+    std::thread Doubler_Thread{[&Doubler]()
+    {
+        while(Doubler.Process([](Pipeline_Event& Event,uint64_t){Event.Doubled=Event.Value*2;})){}
+    }};
+    std::thread Summer_Thread{[&Summer,&Sum]()
+    {
+        while(Summer.Process([&Sum](Pipeline_Event& Event,uint64_t){Sum+=Event.Value;})){}
+    }};
+    std::thread Checker_Thread{[&Checker,&Checked]()
+    {
+        /* Sees Slots Only After Doubler Wrote Them */
+        while(Checker.Process([&Checked](Pipeline_Event& Event,uint64_t Sequence)
+        {
+            EXPECT_EQ(Event.Value,Sequence);
+            EXPECT_EQ(Event.Doubled,Sequence*2);
+            Checked++;
+        })){}
+    }};
+    uint64_t Sent{};
+    while(Sent<ELEMENTS)
+    {
+        /* Batches Of Changing Size Cross The Wrap Point */
+        const size_t Count{static_cast<size_t>(std::min<uint64_t>(1+(Sent%16),ELEMENTS-Sent))};
+        const auto Range{Buffer.Claim(Count)};
+        for(uint64_t Sequence{Range.m_First};Sequence<Range.m_First+Range.m_Count;Sequence++){Buffer[Sequence]={Sequence,0};}
+        Buffer.Publish(Range);
+        Sent+=Count;
+    }
+    Buffer.Close();
+    Doubler_Thread.join();
+    Summer_Thread.join();
+    Checker_Thread.join();
+    EXPECT_EQ(Sum,ELEMENTS*(ELEMENTS-1)/2);
+    EXPECT_EQ(Checked,ELEMENTS);
+}
+/********************************************************************
+ *  END OF FILE:  Sequenced_Circular_Buffer_Test.cpp
+********************************************************************/
@@ -0,0 +1,213 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Shared_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Shared_Circular_Buffer Implementation
+ *  Class Name:  Shared_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Shared_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Shared_Role;
+/* Front Of The Segment Header Up To The Initializer Pid "Layout Of SHARED_VERSION 2" */
+struct Header_Prefix
+{
+    uint64_t m_Magic;
+    uint32_t m_Version;
+    uint32_t m_Element_Size;
+    uint64_t m_Capacity;
+    uint64_t m_Data_Offset;
+    std::atomic<uint32_t> m_State;
+    std::atomic<int32_t> m_Initializer_Pid;
+};
+static_assert(Data_Structure::Shared_Circular_Buffer<>::SHARED_VERSION==2,"Header_Prefix Must Follow Shared_Header");
+/*****************************************
+---    Shared_Circular_Buffer_Test     ---
+*****************************************/
+class Shared_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override
+    {
+        /* Unique Per Process And Test So Parallel Runs Never Share A Segment */
+        m_Name="/Circular_Buffer_Test_"+std::to_string(getpid())+"_"+testing::UnitTest::GetInstance()->current_test_info()->name();
+        Data_Structure::Shared_Circular_Buffer<>::Remove(m_Name);
+    }
+    void TearDown()override{Data_Structure::Shared_Circular_Buffer<>::Remove(m_Name);}
+protected:
+    std::string m_Name;
+};
+
+TEST_F(Shared_Circular_Buffer_Test,PUSH_POP_ACROSS_MAPPINGS)
+{
+    Data_Structure::Shared_Circular_Buffer<int,8> Producer{m_Name,Shared_Role::Producer};
+    Data_Structure::Shared_Circular_Buffer<int,8> Consumer{m_Name,Shared_Role::Consumer};
+    int Element{};
+    EXPECT_TRUE(Consumer.Is_Empty());
+    EXPECT_FALSE(Consumer.Pop(Element));
+    for(int Counter{};Counter<8;Counter++){EXPECT_TRUE(Producer.Push(Counter));}
+    EXPECT_FALSE(Producer.Push(8));
+    EXPECT_EQ(Consumer.Size(),8);
+    /* Zero Copy Read Straight From The Shared Slots */
+    auto Readable{Consumer.Readable_Spans()};
+    ASSERT_EQ(Readable[0].size(),8);
+    EXPECT_EQ(Readable[0][5],5);
+    Consumer.Commit_Read(5);
+    /* Free Region Now Wraps Around The End Of The Storage */
+    auto Writable{Producer.Writable_Spans()};
+    ASSERT_EQ(Writable[0].size()+Writable[1].size(),5);
+    for(int Counter{};Counter<5;Counter++)
+    {
+        auto &Slot{Counter<static_cast<int>(Writable[0].size())?Writable[0][Counter]:Writable[1][Counter-Writable[0].size()]};
+        Slot=100+Counter;
+    }
+    Producer.Commit_Write(5);
+    int Elements[8]{};
+    EXPECT_EQ(Consumer.Pop_N(Elements),8);
+    const int Expected[8]{5,6,7,100,101,102,103,104};
+    for(int Counter{};Counter<8;Counter++){EXPECT_EQ(Elements[Counter],Expected[Counter]);}
+    EXPECT_THROW(Consumer.Commit_Read(1),std::runtime_error);
+    EXPECT_THROW(Producer.Commit_Write(9),std::runtime_error);
+    /* Each Side Only Gets Its Own Operations */
+    EXPECT_THROW(Producer.Pop(Element),std::runtime_error);
+    EXPECT_THROW(Consumer.Push(Element),std::runtime_error);
+}
+
+TEST_F(Shared_Circular_Buffer_Test,LAYOUT_MISMATCH)
+{
+    Data_Structure::Shared_Circular_Buffer<int,8> Producer{m_Name,Shared_Role::Producer};
+    using Wrong_Capacity=Data_Structure::Shared_Circular_Buffer<int,16>;
+    using Wrong_Type=Data_Structure::Shared_Circular_Buffer<uint64_t,8>;
+    EXPECT_THROW(Wrong_Capacity(m_Name,Shared_Role::Consumer),std::runtime_error);
+    EXPECT_THROW(Wrong_Type(m_Name,Shared_Role::Consumer),std::runtime_error);
+    /* Failed Attach Leaves The Role Free For A Matching One */
+    EXPECT_NO_THROW((Data_Structure::Shared_Circular_Buffer<int,8>{m_Name,Shared_Role::Consumer}));
+}
+
+TEST_F(Shared_Circular_Buffer_Test,ROLE_TAKEN_AND_REATTACH)
+{
+    {
+        Data_Structure::Shared_Circular_Buffer<int,8> Producer{m_Name,Shared_Role::Producer};
+        EXPECT_THROW((Data_Structure::Shared_Circular_Buffer<int,8>{m_Name,Shared_Role::Producer}),std::runtime_error);
+        EXPECT_TRUE(Producer.Push(1));
+        EXPECT_TRUE(Producer.Push(2));
+        EXPECT_FALSE(Producer.Peer_Attached());
+    }
+    /* A Consumer That Dies Without Detaching Leaves Its Pid Behind */
+    const pid_t Child{fork()};
+    ASSERT_GE(Child,0);
+    if(Child==0)
+    {
+        auto *Consumer{new Data_Structure::Shared_Circular_Buffer<int,8>{m_Name,Shared_Role::Consumer}};
+        int Element{};
+        _exit((Consumer->Pop(Element)&&Element==1)?0:1);
+    }
+    int Status{};
+    ASSERT_EQ(waitpid(Child,&Status,0),Child);
+    ASSERT_TRUE(WIFEXITED(Status));
+    EXPECT_EQ(WEXITSTATUS(Status),0);
+    /* Both Sides Come Back And Resume Where The Indices Were Left */
+    Data_Structure::Shared_Circular_Buffer<int,8> Consumer{m_Name,Shared_Role::Consumer};
+    Data_Structure::Shared_Circular_Buffer<int,8> Producer{m_Name,Shared_Role::Producer};
+    EXPECT_TRUE(Consumer.Peer_Attached());
+    EXPECT_EQ(Consumer.Size(),1);
+    int Element{};
+    EXPECT_TRUE(Consumer.Pop(Element));
+    EXPECT_EQ(Element,2);
+}
+
+TEST_F(Shared_Circular_Buffer_Test,FORKED_PRODUCER)
+{
+    constexpr uint64_t MESSAGES{100000};
+    /* Consumer Attaches First So The Child Only Validates The Header */
+    Data_Structure::Shared_Circular_Buffer<uint64_t,64> Consumer{m_Name,Shared_Role::Consumer};
+    const pid_t Child{fork()};
+    ASSERT_GE(Child,0);
+    if(Child==0)
+    {
+        Data_Structure::Shared_Circular_Buffer<uint64_t,64> Producer{m_Name,Shared_Role::Producer};
+        for(uint64_t Counter{};Counter<MESSAGES;)
+        {
+            if(Producer.Push(Counter)){Counter++;}
+            else{sched_yield();}
+        }
+        _exit(0);
+    }
+    uint64_t Expected{};
+    bool In_Order{true};
+    uint64_t Elements[16]{};
+    while(Expected<MESSAGES)
+    {
+        const size_t Count{Consumer.Pop_N(Elements)};
+        if(Count==0){sched_yield();continue;}
+        for(size_t Index{};Index<Count;Index++){In_Order&=(Elements[Index]==Expected++);}
+    }
+    EXPECT_TRUE(In_Order);
+    int Status{};
+    ASSERT_EQ(waitpid(Child,&Status,0),Child);
+    EXPECT_TRUE(WIFEXITED(Status)&&WEXITSTATUS(Status)==0);
+    EXPECT_TRUE(Consumer.Is_Empty());
+}
+
+TEST_F(Shared_Circular_Buffer_Test,CREATOR_DIES_MID_INITIALIZATION)
+{
+    /* Child Claims The Header And Dies Before Publishing It */
+    const pid_t Child{fork()};
+    ASSERT_GE(Child,0);
+    if(Child==0)
+    {
+        const int File_Descriptor{shm_open(m_Name.c_str(),O_RDWR|O_CREAT,S_IRUSR|S_IWUSR)};
+        if(File_Descriptor<0||ftruncate(File_Descriptor,sizeof(Header_Prefix))<0){_exit(1);}
+        void *Mapping{mmap(nullptr,sizeof(Header_Prefix),PROT_READ|PROT_WRITE,MAP_SHARED,File_Descriptor,0)};
+        if(Mapping==MAP_FAILED){_exit(1);}
+        auto *Header{static_cast<Header_Prefix*>(Mapping)};
+        Header->m_Initializer_Pid.store(static_cast<int32_t>(getpid()));
+        Header->m_State.store(1);
+        _exit(0);
+    }
+    int Status{};
+    ASSERT_EQ(waitpid(Child,&Status,0),Child);
+    ASSERT_TRUE(WIFEXITED(Status)&&WEXITSTATUS(Status)==0);
+    const int File_Descriptor{shm_open(m_Name.c_str(),O_RDWR,0)};
+    ASSERT_GE(File_Descriptor,0);
+    void *Mapping{mmap(nullptr,sizeof(Header_Prefix),PROT_READ|PROT_WRITE,MAP_SHARED,File_Descriptor,0)};
+    close(File_Descriptor);
+    ASSERT_NE(Mapping,MAP_FAILED);
+    auto *Header{static_cast<Header_Prefix*>(Mapping)};
+    /* A Live Writer Is Still Waited For, Then Reported */
+    Header->m_Initializer_Pid.store(static_cast<int32_t>(getpid()));
+    EXPECT_THROW((Data_Structure::Shared_Circular_Buffer<int,8>{m_Name,Shared_Role::Producer}),std::runtime_error);
+    /* A Dead Writer Is Detected On Timeout And The Header Is Written Again */
+    Header->m_Initializer_Pid.store(static_cast<int32_t>(Child));
+    {
+        Data_Structure::Shared_Circular_Buffer<int,8> Producer{m_Name,Shared_Role::Producer};
+        Data_Structure::Shared_Circular_Buffer<int,8> Consumer{m_Name,Shared_Role::Consumer};
+        EXPECT_EQ(Header->m_State.load(),2);
+        EXPECT_EQ(Header->m_Initializer_Pid.load(),static_cast<int32_t>(getpid()));
+        EXPECT_TRUE(Producer.Push(7));
+        int Element{};
+        EXPECT_TRUE(Consumer.Pop(Element));
+        EXPECT_EQ(Element,7);
+    }
+    munmap(Mapping,sizeof(Header_Prefix));
+}
+/********************************************************************
+ *  END OF FILE:  Shared_Circular_Buffer_Test.cpp
+********************************************************************/
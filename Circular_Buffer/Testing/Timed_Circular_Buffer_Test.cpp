@@ -0,0 +1,127 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Timed_Circular_Buffer_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Timed_Circular_Buffer Implementation
+ *  Class Name:  Timed_Circular_Buffer_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Timed_Circular_Buffer.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+using Data_Structure::Timed_Circular_Buffer;
+using Time_Point=std::chrono::steady_clock::time_point;
+using std::chrono::milliseconds;
+static Time_Point At(int64_t Milliseconds){return Time_Point{milliseconds{Milliseconds}};}
+/* Flattens Both Regions Of A Query Result */
+template <typename Regions_Type>
+static auto Flatten(const Regions_Type& Regions)
+{
+    std::vector<std::remove_const_t<typename Regions_Type::value_type::element_type>> Elements{};
+    for(const auto& Region:Regions){Elements.insert(Elements.end(),Region.begin(),Region.end());}
+    return Elements;
+}
+/*****************************************
+---    Timed_Circular_Buffer_Test     ----
+*****************************************/
+class Timed_Circular_Buffer_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Timed_Circular_Buffer_Test,RANGE_MATCHES_LINEAR_SCAN)
+{
+    Timed_Circular_Buffer<int,16> Buffer{};
+    std::deque<std::pair<int64_t,int>> Reference{};
+    /* Repeated Stamps And Every Wrap Position */
+    for(int Counter{};Counter<40;Counter++)
+    {
+        const int64_t Stamp{(Counter/2)*10};
+        Buffer.Push(At(Stamp),Counter);
+        Reference.emplace_back(Stamp,Counter);
+        if(Reference.size()>16){Reference.pop_front();}
+        ASSERT_EQ(Buffer.Size(),Reference.size());
+        for(int64_t From{-5};From<=210;From+=5)
+        {
+            for(int64_t To{From};To<=215;To+=15)
+            {
+                std::vector<int> Expected{};
+                std::vector<Time_Point> Expected_Stamps{};
+                for(const auto& [Time,Value]:Reference)
+                {
+                    if(Time>=From&&Time<To){Expected.push_back(Value);Expected_Stamps.push_back(At(Time));}
+                }
+                const auto Result{Buffer.Range(At(From),At(To))};
+                ASSERT_EQ(Flatten(Result.m_Values),Expected)<<"From "<<From<<" To "<<To<<" After "<<Counter;
+                ASSERT_EQ(Flatten(Result.m_Timestamps),Expected_Stamps);
+            }
+        }
+    }
+    EXPECT_EQ(Buffer.Oldest_Time(),At(120));
+    EXPECT_EQ(Buffer.Newest_Time(),At(190));
+    EXPECT_EQ(Flatten(Buffer.Since(At(185)).m_Values),(std::vector<int>{38,39}));
+    /* Spans Point Into The Ring Itself */
+    const auto Whole{Buffer.Range(At(0),At(1000))};
+    EXPECT_EQ(Whole.m_Values[0].size()+Whole.m_Values[1].size(),16);
+    EXPECT_EQ(&Whole.m_Values[0].front(),&Buffer.Since(At(0)).m_Values[0].front());
+}
+
+TEST_F(Timed_Circular_Buffer_Test,AGE_EVICTION)
+{
+    Timed_Circular_Buffer<int,64> Buffer{milliseconds{100}};
+    for(int Counter{};Counter<=6;Counter++){Buffer.Push(At(Counter*50),Counter);}
+    /* Newest Is At 300, Anything Before 200 Is Gone */
+    EXPECT_EQ(Buffer.Size(),3);
+    EXPECT_EQ(Buffer.Oldest_Time(),At(200));
+    EXPECT_THROW(Buffer.Push(At(299),7),std::runtime_error);
+    EXPECT_EQ(Buffer.Evict_Expired(At(350)),1);
+    EXPECT_EQ(Buffer.Evict_Before(At(301)),2);
+    EXPECT_TRUE(Buffer.Is_Empty());
+    EXPECT_THROW(Buffer.Oldest_Time(),std::runtime_error);
+    EXPECT_THROW(Buffer.Newest_Time(),std::runtime_error);
+    /* Ordering Restarts Once Empty */
+    Buffer.Push(At(0),8);
+    EXPECT_EQ(Buffer.Size(),1);
+    EXPECT_THROW((Timed_Circular_Buffer<int,4>{milliseconds{-1}}),std::runtime_error);
+    /* Without An Age Limit Only Capacity Evicts */
+    Timed_Circular_Buffer<int,4> Unlimited{};
+    for(int Counter{};Counter<6;Counter++){Unlimited.Push(At(Counter*1000000),Counter);}
+    EXPECT_EQ(Unlimited.Evict_Expired(At(1000000000)),0);
+    EXPECT_EQ(Unlimited.Size(),4);
+}
+
+TEST_F(Timed_Circular_Buffer_Test,CLOCK_STAMPED_STRINGS)
+{
+    Timed_Circular_Buffer<std::string,8> Buffer{std::chrono::hours{1}};
+    const Time_Point Start{std::chrono::steady_clock::now()};
+    for(int Counter{};Counter<10;Counter++){Buffer.Push(std::to_string(Counter));}
+    std::string Moved{"last"};
+    Buffer.Push(std::chrono::steady_clock::now(),std::move(Moved));
+    const auto Recent{Flatten(Buffer.Since(Start).m_Values)};
+    ASSERT_EQ(Recent.size(),8);
+    EXPECT_EQ(Recent.front(),"3");
+    EXPECT_EQ(Recent.back(),"last");
+    EXPECT_TRUE(Flatten(Buffer.Range(Start,Start).m_Values).empty());
+    EXPECT_TRUE(Flatten(Buffer.Since(Buffer.Newest_Time()+milliseconds{1}).m_Values).empty());
+}
+/********************************************************************
+ *  END OF FILE:  Timed_Circular_Buffer_Test.cpp
+********************************************************************/
@@ -0,0 +1,141 @@
+/*******************************************************************
+ *  FILE DESCRIPTION
+-----------------------
+ *  Author: Khaled El-Sayed @t0ti20
+ *  File: Window_Statistics_Test.cpp
+ *  Date: November 30, 2024
+ *  Description: Test Casses File For Window_Statistics Implementation
+ *  Class Name:  Window_Statistics_Test
+ *  Namespace:  None
+ *  (C) 2023 "@t0ti20". All rights reserved.
+*******************************************************************/
+/*****************************************
+-----------     INCLUDES     -------------
+*****************************************/
+#include "Window_Statistics.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+/*****************************************
+----------    GLOBAL DATA     ------------
+*****************************************/
+/* Repeatable Noise Without Pulling In <random> Engines */
+static float Noise(uint32_t& State)
+{
+    State=State*1664525u+1013904223u;
+    return static_cast<float>(State>>8)/static_cast<float>(1u<<24)*200.0f-100.0f;
+}
+/*****************************************
+-----    Window_Statistics_Test     ------
+*****************************************/
+class Window_Statistics_Test : public testing::Test
+{
+public:
+    void SetUp()override{}
+    void TearDown()override{}
+};
+
+TEST_F(Window_Statistics_Test,EMPTY_WINDOW)
+{
+    Data_Structure::Circular_Buffer<float,8> Buffer{};
+    const auto Summary{Data_Structure::Window_Statistics(Buffer)};
+    EXPECT_EQ(Summary.m_Count,0);
+    EXPECT_EQ(Summary.m_Sum,0.0);
+    EXPECT_EQ(Summary.m_Variance,0.0);
+    Data_Structure::Rolling_Window_Statistics<float,8> Rolling{};
+    EXPECT_EQ(Rolling.Count(),0);
+    EXPECT_EQ(Rolling.Variance(),0.0);
+    EXPECT_THROW(Rolling.Min(),std::runtime_error);
+    EXPECT_THROW(Rolling.Max(),std::runtime_error);
+}
+
+TEST_F(Window_Statistics_Test,EVERY_LEVEL_MATCHES_ITERATOR_WALK)
+{
+    /* Odd Size And Wrapped Contents Leave Tails In Both Segments */
+    Data_Structure::Circular_Buffer<float,37> Buffer{};
+    Data_Structure::Circular_Buffer<double,37> Wide_Buffer{};
+    uint32_t State{7};
+    for(int Counter{};Counter<58;Counter++)
+    {
+        const float Sample{Noise(State)};
+        Buffer.Push(Sample);
+        Wide_Buffer.Push(Sample);
+    }
+    ASSERT_FALSE(Buffer.Readable_Spans()[1].empty());
+    double Sum{};
+    float Minimum{Buffer[0]};
+    float Maximum{Buffer[0]};
+    for(const float Sample:Buffer)
+    {
+        Sum+=Sample;
+        Minimum=std::min(Minimum,Sample);
+        Maximum=std::max(Maximum,Sample);
+    }
+    const double Mean{Sum/37.0};
+    double Squared_Deviation{};
+    for(const float Sample:Buffer){Squared_Deviation+=(Sample-Mean)*(Sample-Mean);}
+    for(auto Level:{Data_Structure::Simd_Level::Scalar,Data_Structure::Simd_Level::SSE,Data_Structure::Simd_Level::AVX2})
+    {
+        if(Level>Data_Structure::Best_Simd_Level())
+        {
+            EXPECT_THROW(Data_Structure::Window_Statistics(Buffer,Level),std::runtime_error);
+            continue;
+        }
+        const auto Summary{Data_Structure::Window_Statistics(Buffer,Level)};
+        EXPECT_EQ(Summary.m_Count,37);
+        EXPECT_NEAR(Summary.m_Sum,Sum,1e-9);
+        EXPECT_EQ(Summary.m_Min,Minimum);
+        EXPECT_EQ(Summary.m_Max,Maximum);
+        EXPECT_NEAR(Summary.m_Mean,Mean,1e-9);
+        EXPECT_NEAR(Summary.m_Variance,Squared_Deviation/37.0,1e-6);
+        const auto Wide_Summary{Data_Structure::Window_Statistics(Wide_Buffer,Level)};
+        EXPECT_NEAR(Wide_Summary.m_Sum,Sum,1e-9);
+        EXPECT_EQ(Wide_Summary.m_Min,static_cast<double>(Minimum));
+        EXPECT_EQ(Wide_Summary.m_Max,static_cast<double>(Maximum));
+        EXPECT_NEAR(Wide_Summary.m_Variance,Squared_Deviation/37.0,1e-6);
+    }
+}
+
+TEST_F(Window_Statistics_Test,ROLLING_MATCHES_RECOMPUTE)
+{
+    Data_Structure::Rolling_Window_Statistics<float,16> Rolling{};
+    uint32_t State{11};
+    for(int Counter{};Counter<2000;Counter++)
+    {
+        Rolling.Push(Noise(State));
+        const auto Exact{Data_Structure::Window_Statistics(Rolling.Window())};
+        const auto Summary{Rolling.Summary()};
+        ASSERT_EQ(Summary.m_Count,Exact.m_Count);
+        /* Extremes Come From The Deques And Are Exact */
+        ASSERT_EQ(Summary.m_Min,Exact.m_Min);
+        ASSERT_EQ(Summary.m_Max,Exact.m_Max);
+        ASSERT_NEAR(Summary.m_Sum,Exact.m_Sum,1e-6);
+        ASSERT_NEAR(Summary.m_Mean,Exact.m_Mean,1e-6);
+        ASSERT_NEAR(Summary.m_Variance,Exact.m_Variance,1e-6);
+    }
+}
+
+TEST_F(Window_Statistics_Test,ROLLING_MONOTONIC_INPUT)
+{
+    /* Rising Then Falling Input Empties Each Deque In Turn */
+    Data_Structure::Rolling_Window_Statistics<double,4> Rolling{};
+    for(int Sample{};Sample<10;Sample++){Rolling.Push(Sample);}
+    EXPECT_EQ(Rolling.Min(),6.0);
+    EXPECT_EQ(Rolling.Max(),9.0);
+    for(int Sample{9};Sample>=0;Sample--){Rolling.Push(Sample);}
+    EXPECT_EQ(Rolling.Min(),0.0);
+    EXPECT_EQ(Rolling.Max(),3.0);
+    EXPECT_DOUBLE_EQ(Rolling.Sum(),6.0);
+    EXPECT_DOUBLE_EQ(Rolling.Mean(),1.5);
+    EXPECT_DOUBLE_EQ(Rolling.Variance(),1.25);
+    /* Constant Input Has No Spread */
+    for(int Counter{};Counter<4;Counter++){Rolling.Push(5.0);}
+    EXPECT_EQ(Rolling.Min(),5.0);
+    EXPECT_EQ(Rolling.Max(),5.0);
+    EXPECT_NEAR(Rolling.Variance(),0.0,1e-12);
+}
+/********************************************************************
+ *  END OF FILE:  Window_Statistics_Test.cpp
+********************************************************************/